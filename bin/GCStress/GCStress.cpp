@@ -68,6 +68,9 @@ WeightedTable<Operation> operationTable;
 // Not used currently, but keep for now
 bool verbose = false;
 
+// If non-zero, time this many collections on the initialized heap instead of running the stress loop
+unsigned int markBenchmarkCollectionCount = 0;
+
 
 RecyclerTestObject * CreateNewObject()
 {
@@ -243,6 +246,30 @@ void BuildOperationTable()
     operationTable.AddWeightedEntry(&SwapObjects, 5);
 }
 
+// Time a fixed number of full collections with parallel marking enabled.
+// Run with "-js -RecyclerMaxParallelism:N" for N = 1 up to the processor count to get the mark scaling curve.
+void MarkBenchmark()
+{
+    // The recycler was initialized with deferThreadStartup, so this is the only place its threads are started
+    JsUtil::ThreadService threadService(nullptr);
+    if (!recyclerInstance->EnableConcurrent(&threadService, true /* startAllThreads */))
+    {
+        wprintf(_u("Concurrent threads not available, marking in thread only\n"));
+    }
+
+    DWORD startTime = GetTickCount();
+    for (unsigned int i = 0; i < markBenchmarkCollectionCount; i++)
+    {
+        recyclerInstance->CollectNow<CollectNowForceInThread>();
+    }
+    DWORD elapsedTime = GetTickCount() - startTime;
+
+    wprintf(_u("%u collections in %u ms (%u ms per collection)\n"),
+        markBenchmarkCollectionCount, elapsedTime, elapsedTime / markBenchmarkCollectionCount);
+
+    recyclerInstance->ShutdownThread();
+}
+
 void SimpleRecyclerTest()
 {
     // Initialize the probability tables for object creation and heap operations.
@@ -272,7 +299,8 @@ void SimpleRecyclerTest()
 
         recyclerInstance = HeapNewZ(Recycler, nullptr, &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags);
 
-        recyclerInstance->Initialize(false /* forceInThread */, nullptr /* threadService */);
+        // The mark benchmark starts the concurrent and parallel mark threads itself
+        recyclerInstance->Initialize(false /* forceInThread */, nullptr /* threadService */, markBenchmarkCollectionCount != 0 /* deferThreadStartup */);
 
 #if FALSE
         // TODO: Support EnableImplicitRoots call on Recycler (or similar, e.g. constructor param)
@@ -322,6 +350,13 @@ void SimpleRecyclerTest()
         // Do an initial walk
         WalkHeap();
 
+        if (markBenchmarkCollectionCount != 0)
+        {
+            MarkBenchmark();
+            wprintf(_u("==== Test completed.\n"));
+            return;
+        }
+
         // Loop, continually doing heap operations, and periodically doing a full heap walk
         while (true)
         {
@@ -366,8 +401,9 @@ bool GetDeviceFamilyInfo(
 void usage(const WCHAR* self)
 {
     wprintf(
-        _u("usage: %s [-?|-v] [-js <jscript options from here on>]\n")
-        _u("  -v\n\tverbose logging\n"),
+        _u("usage: %s [-?|-v|-marktime <count>] [-js <jscript options from here on>]\n")
+        _u("  -v\n\tverbose logging\n")
+        _u("  -marktime <count>\n\ttime <count> collections of the initial heap instead of running the stress loop\n"),
         self);
 }
 
@@ -388,6 +424,10 @@ int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
             {
                 verbose = true;
             }
+            else if (wcscmp(argv[i], _u("-marktime")) == 0 && i + 1 < argc)
+            {
+                markBenchmarkCollectionCount = (unsigned int)_wtoi(argv[++i]);
+            }
             else if (wcscmp(argv[i], _u("-js")) == 0 || wcscmp(argv[i], _u("-JS")) == 0)
             {
                 jscriptOptions = i;
@@ -280,4 +280,137 @@ namespace CodexTest
         
         RunUtf8DecodeTestCase(testCases, utf8::DecodeUnitsIntoAndNullTerminateNoAdvance);
     }
+
+    //
+    // Throughput of the block (SIMD) paths against a character at a time loop over the same inputs.
+    // Hidden by default, run with: NativeTests.exe [CodexPerf]
+    //
+    size_t ScalarDecode(char16 *buffer, LPCUTF8 pch, LPCUTF8 end)
+    {
+        utf8::DecodeOptions options = utf8::doDefault;
+        char16 *dest = buffer;
+        while (pch < end)
+        {
+            *dest++ = utf8::Decode(pch, end, options);
+        }
+        return dest - buffer;
+    }
+
+    size_t ScalarEncode(utf8char_t *buffer, const char16 *source, charcount_t cch)
+    {
+        utf8char_t *dest = buffer;
+        const void *bufferEnd = buffer + cch * 3;
+        for (charcount_t i = 0; i < cch; i++)
+        {
+            dest = utf8::Encode<false>(source[i], dest, bufferEnd);
+        }
+        return dest - buffer;
+    }
+
+    TEST_CASE("CodexTest_AsciiBlocks_MixedContent", "[CodexTest]")
+    {
+        // Place a non-ASCII character at every position around the block boundaries, so that each block
+        // either converts entirely or falls back to the character at a time path at the right place
+        const char16 nonAscii[] = { 0x80, 0xe9, 0x7ff, 0x800, 0x3042, 0xfffd };
+        const charcount_t maxLength = 40;
+        char16 source[maxLength];
+        utf8char_t encoded[maxLength * 3 + 1];
+        utf8char_t scalarEncoded[maxLength * 3 + 1];
+        char16 decoded[maxLength + 1];
+
+        for (charcount_t length = 1; length <= maxLength; length++)
+        {
+            for (charcount_t position = 0; position < length; position++)
+            {
+                for (size_t k = 0; k < _countof(nonAscii); k++)
+                {
+                    for (charcount_t i = 0; i < length; i++)
+                    {
+                        source[i] = (char16)('a' + i % 26);
+                    }
+                    source[position] = nonAscii[k];
+
+                    size_t cb = utf8::EncodeIntoAndNullTerminate(encoded, source, length);
+                    REQUIRE(cb == ScalarEncode(scalarEncoded, source, length));
+                    REQUIRE(memcmp(encoded, scalarEncoded, cb) == 0);
+                    CHECK(utf8::CountTrueUtf8(source, length) == cb);
+
+                    LPCUTF8 pch = encoded;
+                    REQUIRE(utf8::DecodeUnitsInto(decoded, pch, encoded + cb, utf8::doDefault) == length);
+                    CHECK(pch == encoded + cb);
+                    CHECK(memcmp(decoded, source, length * sizeof(char16)) == 0);
+
+                    CHECK(utf8::ByteIndexIntoCharacterIndex(encoded, cb, utf8::doDefault) == length);
+                    size_t expectedByteIndex = position + utf8::EncodedSize(nonAscii[k]);
+                    CHECK(utf8::CharacterIndexToByteIndex(encoded, cb, position + 1, utf8::doDefault) == expectedByteIndex);
+                }
+            }
+        }
+    }
+
+    template <class Fn>
+    double MeasureGBPerSecond(size_t bytesPerIteration, Fn fn)
+    {
+        const int iterations = 200;
+        LARGE_INTEGER frequency, start, end;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&start);
+        for (int i = 0; i < iterations; i++)
+        {
+            fn();
+        }
+        QueryPerformanceCounter(&end);
+        double seconds = (double)(end.QuadPart - start.QuadPart) / frequency.QuadPart;
+        return (double)bytesPerIteration * iterations / seconds / 1e9;
+    }
+
+    void RunCodexThroughput(const char *name, const char16 *text, charcount_t textLength)
+    {
+        const charcount_t cch = 1024 * 1024;
+        char16 *source = new char16[cch];
+        for (charcount_t i = 0; i < cch; i++)
+        {
+            source[i] = text[i % textLength];
+        }
+
+        utf8char_t *encoded = new utf8char_t[cch * 3 + 1];
+        utf8char_t *scalarEncoded = new utf8char_t[cch * 3 + 1];
+        char16 *decoded = new char16[cch + 1];
+        char16 *scalarDecoded = new char16[cch + 1];
+
+        size_t cb = utf8::EncodeIntoAndNullTerminate(encoded, source, cch);
+        REQUIRE(ScalarEncode(scalarEncoded, source, cch) == cb);
+        CHECK(memcmp(encoded, scalarEncoded, cb) == 0);
+
+        LPCUTF8 pch = encoded;
+        REQUIRE(utf8::DecodeUnitsInto(decoded, pch, encoded + cb, utf8::doDefault) == cch);
+        REQUIRE(ScalarDecode(scalarDecoded, encoded, encoded + cb) == cch);
+        CHECK(memcmp(decoded, source, cch * sizeof(char16)) == 0);
+        CHECK(memcmp(scalarDecoded, source, cch * sizeof(char16)) == 0);
+
+        double decode = MeasureGBPerSecond(cb, [&]() { LPCUTF8 p = encoded; utf8::DecodeUnitsInto(decoded, p, encoded + cb, utf8::doDefault); });
+        double scalarDecode = MeasureGBPerSecond(cb, [&]() { ScalarDecode(scalarDecoded, encoded, encoded + cb); });
+        double encode = MeasureGBPerSecond(cb, [&]() { utf8::EncodeIntoAndNullTerminate(encoded, source, cch); });
+        double scalarEncode = MeasureGBPerSecond(cb, [&]() { ScalarEncode(scalarEncoded, source, cch); });
+
+        printf("%-10s decode %6.2f GB/s (scalar %6.2f GB/s), encode %6.2f GB/s (scalar %6.2f GB/s)\n",
+            name, decode, scalarDecode, encode, scalarEncode);
+
+        delete[] source;
+        delete[] encoded;
+        delete[] scalarEncoded;
+        delete[] decoded;
+        delete[] scalarDecoded;
+    }
+
+    TEST_CASE("CodexTest_Throughput", "[.][CodexPerf]")
+    {
+        const char16 ascii[] = _u("function f(a, b) { return a.length + b.indexOf('x'); }\n");
+        const char16 latin[] = _u("Fr\u00e9d\u00e9ric a mang\u00e9 une cr\u00eape br\u00fbl\u00e9e \u00e0 la f\u00eate. ");
+        const char16 cjk[] = _u("\u6f22\u5b57\u306e\u30c6\u30ad\u30b9\u30c8\u3067\u3059\u3002");
+
+        RunCodexThroughput("ascii", ascii, _countof(ascii) - 1);
+        RunCodexThroughput("latin", latin, _countof(latin) - 1);
+        RunCodexThroughput("cjk", cjk, _countof(cjk) - 1);
+    }
 };
\ No newline at end of file
@@ -0,0 +1,132 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+#include "catch.hpp"
+#include <vector>
+#include "Common\JobRanking.h"
+
+#pragma warning(disable:6262) // CATCH is using stack variables to report errors, suppressing the preFAST warning.
+
+// Definition of tests that exercise the order in which the background job processor picks queued jobs
+namespace JobRankingTest
+{
+    // Stands in for JsUtil::Job and its job manager
+    struct TestJob
+    {
+        TestJob *next;
+        int manager;
+        unsigned int hotness;
+        bool isPrioritized;
+
+        TestJob *Next() const { return next; }
+        unsigned int Hotness() const { return hotness; }
+        bool IsPrioritized() const { return isPrioritized; }
+    };
+
+    // Mimics BackgroundJobProcessor::UnlinkNextJob, and returns the order in which the jobs are picked as indexes into jobs
+    template<size_t TJobCount>
+    std::vector<size_t> PickAll(TestJob (&jobs)[TJobCount])
+    {
+        for (size_t i = 0; i < TJobCount; i++)
+        {
+            jobs[i].next = i + 1 < TJobCount ? &jobs[i + 1] : nullptr;
+        }
+
+        std::map<int, uint64> lastServiceOrder;
+        uint64 serviceOrder = 0;
+        TestJob *head = &jobs[0];
+        std::vector<size_t> order;
+        while (head)
+        {
+            TestJob *const job = JsUtil::PickRankedJob(head, [&](const TestJob *const j) { return lastServiceOrder[j->manager]; });
+            REQUIRE(job != nullptr);
+
+            // Unlink
+            if (job == head)
+            {
+                head = job->next;
+            }
+            else
+            {
+                TestJob *previous = head;
+                while (previous->next != job)
+                {
+                    previous = previous->next;
+                }
+                previous->next = job->next;
+            }
+
+            lastServiceOrder[job->manager] = ++serviceOrder;
+            order.push_back(static_cast<size_t>(job - jobs));
+        }
+        return order;
+    }
+
+    TEST_CASE("JobRanking_EmptyQueue", "[JobRanking]")
+    {
+        CHECK(JsUtil::PickRankedJob((TestJob *)nullptr, [](const TestJob *const) { return 0; }) == nullptr);
+    }
+
+    TEST_CASE("JobRanking_HotJobsFirst", "[JobRanking]")
+    {
+        // A cold function queued ahead of a hot loop body and a warm function, all from one script context
+        TestJob jobs[] =
+        {
+            { nullptr, 0, 2, false },
+            { nullptr, 0, 10000, false },
+            { nullptr, 0, 50, false },
+        };
+
+        std::vector<size_t> order = PickAll(jobs);
+        CHECK(order == std::vector<size_t>({ 1, 2, 0 }));
+    }
+
+    TEST_CASE("JobRanking_TiesInQueueOrder", "[JobRanking]")
+    {
+        TestJob jobs[] =
+        {
+            { nullptr, 0, 7, false },
+            { nullptr, 0, 7, false },
+            { nullptr, 0, 7, false },
+        };
+
+        std::vector<size_t> order = PickAll(jobs);
+        CHECK(order == std::vector<size_t>({ 0, 1, 2 }));
+    }
+
+    TEST_CASE("JobRanking_PrioritizedJobsFirstInQueueOrder", "[JobRanking]")
+    {
+        // Prioritized jobs are linked to the front of the queue, and are not reordered by hotness
+        TestJob jobs[] =
+        {
+            { nullptr, 0, 1, true },
+            { nullptr, 0, 3, true },
+            { nullptr, 0, 500, false },
+            { nullptr, 0, 1000, false },
+        };
+
+        std::vector<size_t> order = PickAll(jobs);
+        CHECK(order == std::vector<size_t>({ 0, 1, 3, 2 }));
+    }
+
+    TEST_CASE("JobRanking_ManagersTakeTurns", "[JobRanking]")
+    {
+        // Manager 0 queued a lot of hot jobs before managers 1 and 2 queued theirs. Each manager gets a turn before any manager
+        // gets a second one, and each manager's hottest job goes first.
+        TestJob jobs[] =
+        {
+            { nullptr, 0, 900, false },
+            { nullptr, 0, 800, false },
+            { nullptr, 0, 700, false },
+            { nullptr, 0, 600, false },
+            { nullptr, 1, 5, false },
+            { nullptr, 2, 1, false },
+            { nullptr, 1, 20, false },
+        };
+
+        std::vector<size_t> order = PickAll(jobs);
+        CHECK(order == std::vector<size_t>({ 0, 6, 5, 1, 4, 2, 3 }));
+    }
+}
@@ -2321,4 +2321,316 @@ namespace JsRTApiTest
     {
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringTest);
     }
+
+    void JsBatchPropertiesTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // More properties than fit in the inline slots of the literal types
+        const unsigned int count = 20;
+        JsPropertyIdRef propertyIds[count];
+        JsValueRef values[count];
+        for (unsigned int i = 0; i < count; i++)
+        {
+            char name[8];
+            sprintf_s(name, sizeof(name), "p%u", i);
+            REQUIRE(JsCreatePropertyId(name, strlen(name), &propertyIds[i]) == JsNoError);
+            REQUIRE(JsIntToNumber(i * 10, &values[i]) == JsNoError);
+        }
+
+        // Properties are defined, not set, so setters on the prototype are not called
+        JsValueRef result;
+        REQUIRE(JsRunScript(_u("Object.defineProperty(Object.prototype, 'p0', { set: function () { throw 'p0'; } })"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        JsValueRef object;
+        REQUIRE(JsCreateObjectWithProperties(propertyIds, values, count, &object) == JsNoError);
+        JsValueRef other;
+        REQUIRE(JsCreateObjectWithProperties(propertyIds, values, count, &other) == JsNoError);
+
+        JsValueRef global;
+        JsPropertyIdRef objectId;
+        JsPropertyIdRef otherId;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("object"), &objectId) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("other"), &otherId) == JsNoError);
+        REQUIRE(JsSetProperty(global, objectId, object, true) == JsNoError);
+        REQUIRE(JsSetProperty(global, otherId, other, true) == JsNoError);
+        REQUIRE(JsRunScript(_u("Object.keys(object).join() === Object.keys(other).join() && Object.keys(object).length === 20 && object.p19 === 190 && other.p0 === 0"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        bool boolValue;
+        REQUIRE(JsBooleanToBool(result, &boolValue) == JsNoError);
+        CHECK(boolValue);
+
+        JsValueRef readValues[count];
+        REQUIRE(JsGetProperties(object, propertyIds, count, readValues) == JsNoError);
+        for (unsigned int i = 0; i < count; i++)
+        {
+            int value;
+            REQUIRE(JsNumberToInt(readValues[i], &value) == JsNoError);
+            CHECK(value == (int)(i * 10));
+        }
+
+        // Properties that are missing are undefined, getters run in order
+        JsValueRef getterObject;
+        REQUIRE(JsRunScript(_u("({ get p1() { return this.p0 + 1; }, p0: 41 })"), JS_SOURCE_CONTEXT_NONE, _u(""), &getterObject) == JsNoError);
+        REQUIRE(JsGetProperties(getterObject, propertyIds, 3, readValues) == JsNoError);
+        int value;
+        REQUIRE(JsNumberToInt(readValues[1], &value) == JsNoError);
+        CHECK(value == 42);
+        JsValueType type;
+        REQUIRE(JsGetValueType(readValues[2], &type) == JsNoError);
+        CHECK(type == JsUndefined);
+
+        REQUIRE(JsCreateObjectWithProperties(nullptr, nullptr, 0, &object) == JsNoError);
+        CHECK(JsCreateObjectWithProperties(nullptr, values, 1, &object) == JsErrorNullArgument);
+        CHECK(JsGetProperties(getterObject, propertyIds, 1, nullptr) == JsErrorNullArgument);
+        CHECK(JsGetProperties(values[1], propertyIds, 1, readValues) == JsErrorArgumentNotObject);
+    }
+
+    TEST_CASE("ApiTest_JsBatchPropertiesTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsBatchPropertiesTest);
+    }
+
+    // Creates an empty directory under the temp directory for a cache test, in a buffer of MAX_PATH chars
+    void CreateCacheTestDirectory(const char * name, char * directory)
+    {
+        char tempPath[MAX_PATH];
+        REQUIRE(GetTempPathA(MAX_PATH, tempPath) != 0);
+        REQUIRE(sprintf_s(directory, MAX_PATH, "%s%s.%x", tempPath, name, GetCurrentProcessId()) > 0);
+        REQUIRE(CreateDirectoryA(directory, nullptr));
+    }
+
+    // Deletes the files matching the pattern in the directory and returns how many there were
+    int DeleteCacheTestFiles(const char * directory, const char * pattern)
+    {
+        char path[MAX_PATH];
+        REQUIRE(sprintf_s(path, MAX_PATH, "%s\\%s", directory, pattern) > 0);
+
+        int count = 0;
+        WIN32_FIND_DATAA findData;
+        HANDLE find = FindFirstFileA(path, &findData);
+        if (find != INVALID_HANDLE_VALUE)
+        {
+            do
+            {
+                REQUIRE(sprintf_s(path, MAX_PATH, "%s\\%s", directory, findData.cFileName) > 0);
+                CHECK(DeleteFileA(path));
+                count++;
+            } while (FindNextFileA(find, &findData));
+            FindClose(find);
+        }
+        return count;
+    }
+
+    int CountCacheTestFiles(const char * directory, const char * pattern)
+    {
+        char path[MAX_PATH];
+        REQUIRE(sprintf_s(path, MAX_PATH, "%s\\%s", directory, pattern) > 0);
+
+        int count = 0;
+        WIN32_FIND_DATAA findData;
+        HANDLE find = FindFirstFileA(path, &findData);
+        if (find != INVALID_HANDLE_VALUE)
+        {
+            do
+            {
+                count++;
+            } while (FindNextFileA(find, &findData));
+            FindClose(find);
+        }
+        return count;
+    }
+
+    // Runs the script in a new runtime that uses the profile cache directory (if any), calls its
+    // function f enough times to profile it, and disposes the runtime, which stores the profile
+    int RunWithProfileCache(JsRuntimeAttributes attributes, const char * directory, const char16 * script)
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &runtime) == JsNoError);
+        if (directory != nullptr)
+        {
+            REQUIRE(JsSetRuntimeProfileCacheDirectory(runtime, directory) == JsNoError);
+        }
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        // Profiles are only stored for scripts with a url and a host source context
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, 1, _u("profileCacheTest.js"), &result) == JsNoError);
+        REQUIRE(JsRunScript(_u("var sum = 0; for (var i = 0; i < 100; i++) { sum += f({ x: i }); } sum"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        int sum;
+        REQUIRE(JsNumberToInt(result, &sum) == JsNoError);
+
+        REQUIRE(JsSetCurrentContext(nullptr) == JsNoError);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+        return sum;
+    }
+
+    void JsProfileCacheTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        if (attributes & JsRuntimeAttributeDisableNativeCodeGeneration)
+        {
+            // Without the JIT there is no dynamic profile to store
+            return;
+        }
+
+        const char16 * script = _u("function f(o) { return o.x + 1; }");
+        const char16 * changedScript = _u("function f(o) { var y = o.x; return y * 2 + 1; }");
+
+        char directory[MAX_PATH];
+        CreateCacheTestDirectory("ChakraProfileCacheTest", directory);
+
+        // Miss: nothing is loaded, the profile is stored when the runtime goes away
+        CHECK(RunWithProfileCache(attributes, directory, script) == 5050);
+        CHECK(CountCacheTestFiles(directory, "*.cpf") == 1);
+
+        // Hit: the stored profile is loaded and stored again
+        CHECK(RunWithProfileCache(attributes, directory, script) == 5050);
+        CHECK(CountCacheTestFiles(directory, "*.cpf") == 1);
+
+        // The function changed under the same url: its profile no longer matches and is not used
+        CHECK(RunWithProfileCache(attributes, directory, changedScript) == 10000);
+
+        // A corrupt entry is ignored and replaced
+        char entryPath[MAX_PATH];
+        WIN32_FIND_DATAA findData;
+        REQUIRE(sprintf_s(entryPath, MAX_PATH, "%s\\*.cpf", directory) > 0);
+        HANDLE find = FindFirstFileA(entryPath, &findData);
+        REQUIRE(find != INVALID_HANDLE_VALUE);
+        FindClose(find);
+        REQUIRE(sprintf_s(entryPath, MAX_PATH, "%s\\%s", directory, findData.cFileName) > 0);
+        HANDLE file = CreateFileA(entryPath, GENERIC_WRITE, 0, nullptr, TRUNCATE_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        REQUIRE(file != INVALID_HANDLE_VALUE);
+        DWORD written;
+        CHECK(WriteFile(file, "CHPF", 4, &written, nullptr));
+        CloseHandle(file);
+        CHECK(RunWithProfileCache(attributes, directory, script) == 5050);
+
+        // The cache belongs to the runtime it was set on: a runtime without one neither loads nor stores
+        CHECK(DeleteCacheTestFiles(directory, "*.cpf") == 1);
+        CHECK(RunWithProfileCache(attributes, nullptr, script) == 5050);
+        CHECK(CountCacheTestFiles(directory, "*.cpf") == 0);
+
+        CHECK(JsSetRuntimeProfileCacheDirectory(runtime, "") == JsErrorInvalidArgument);
+        CHECK(JsSetRuntimeProfileCacheDirectory(runtime, nullptr) == JsNoError);
+
+        DeleteCacheTestFiles(directory, "*");
+        CHECK(RemoveDirectoryA(directory));
+    }
+
+    TEST_CASE("ApiTest_JsProfileCacheTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsProfileCacheTest);
+    }
+
+    // Runs the script with JsRun, which uses the byte code cache of the runtime, and returns its result
+    int RunWithByteCodeCache(const char * script)
+    {
+        JsValueRef scriptVal = JS_INVALID_REFERENCE;
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(script, strlen(script), &scriptVal) == JsNoError);
+        REQUIRE(JsCreateString("byteCodeCacheTest.js", strlen("byteCodeCacheTest.js"), &sourceUrl) == JsNoError);
+        REQUIRE(JsRun(scriptVal, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &result) == JsNoError);
+
+        int value;
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        return value;
+    }
+
+    // Opens the only entry of the cache directory
+    HANDLE OpenByteCodeCacheEntry(const char * directory, DWORD access)
+    {
+        char entryPath[MAX_PATH];
+        WIN32_FIND_DATAA findData;
+        REQUIRE(sprintf_s(entryPath, MAX_PATH, "%s\\*.cbc", directory) > 0);
+        HANDLE find = FindFirstFileA(entryPath, &findData);
+        REQUIRE(find != INVALID_HANDLE_VALUE);
+        FindClose(find);
+        REQUIRE(sprintf_s(entryPath, MAX_PATH, "%s\\%s", directory, findData.cFileName) > 0);
+
+        HANDLE file = CreateFileA(entryPath, access, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        REQUIRE(file != INVALID_HANDLE_VALUE);
+        return file;
+    }
+
+    // Entries are only written on a miss: back date the entry so that a rewrite shows up
+    void BackdateByteCodeCacheEntry(const char * directory)
+    {
+        HANDLE file = OpenByteCodeCacheEntry(directory, FILE_WRITE_ATTRIBUTES);
+        FILETIME oldTime = { 0x10000000, 0x01000000 };
+        CHECK(SetFileTime(file, nullptr, nullptr, &oldTime));
+        CloseHandle(file);
+    }
+
+    bool IsByteCodeCacheEntryBackdated(const char * directory)
+    {
+        HANDLE file = OpenByteCodeCacheEntry(directory, GENERIC_READ);
+        FILETIME writeTime;
+        CHECK(GetFileTime(file, nullptr, nullptr, &writeTime));
+        CloseHandle(file);
+        return writeTime.dwHighDateTime == 0x01000000 && writeTime.dwLowDateTime == 0x10000000;
+    }
+
+    void JsByteCodeCacheTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const char * script = "function f(n) { var s = 0; for (var i = 1; i <= n; i++) { s += i; } return s; } f(100)";
+
+        char directory[MAX_PATH];
+        CreateCacheTestDirectory("ChakraByteCodeCacheTest", directory);
+        REQUIRE(JsSetRuntimeByteCodeCacheDirectory(runtime, directory) == JsNoError);
+
+        // Miss: the script is compiled and its byte code stored
+        CHECK(RunWithByteCodeCache(script) == 5050);
+        CHECK(CountCacheTestFiles(directory, "*.cbc") == 1);
+        CHECK(CountCacheTestFiles(directory, "*.tmp") == 0);
+
+        // Hit: the entry is used as is
+        BackdateByteCodeCacheEntry(directory);
+        CHECK(RunWithByteCodeCache(script) == 5050);
+        CHECK(IsByteCodeCacheEntryBackdated(directory));
+
+        // The deferred function f is deserialized on first use and maps the source through the
+        // script value, which has to survive a collection
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int value;
+        REQUIRE(JsRunScript(_u("f(10) + f.toString().length"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        CHECK(value == 55 + 79);
+
+        // Invalidated: an entry that doesn't match the engine version is ignored and replaced
+        HANDLE file = OpenByteCodeCacheEntry(directory, GENERIC_WRITE);
+        DWORD written;
+        CHECK(SetFilePointer(file, 4, nullptr, FILE_BEGIN) == 4);
+        CHECK(WriteFile(file, "\xff\xff\xff\xff", 4, &written, nullptr));
+        CloseHandle(file);
+        BackdateByteCodeCacheEntry(directory);
+        CHECK(RunWithByteCodeCache(script) == 5050);
+        CHECK(!IsByteCodeCacheEntryBackdated(directory));
+        CHECK(CountCacheTestFiles(directory, "*.cbc") == 1);
+
+        // The replaced entry is used again
+        BackdateByteCodeCacheEntry(directory);
+        CHECK(RunWithByteCodeCache(script) == 5050);
+        CHECK(IsByteCodeCacheEntryBackdated(directory));
+
+        // A different script gets its own entry
+        CHECK(RunWithByteCodeCache("function g() { return 7; } g()") == 7);
+        CHECK(CountCacheTestFiles(directory, "*.cbc") == 2);
+
+        // Without the cache nothing is stored
+        REQUIRE(JsSetRuntimeByteCodeCacheDirectory(runtime, nullptr) == JsNoError);
+        CHECK(DeleteCacheTestFiles(directory, "*.cbc") == 2);
+        CHECK(RunWithByteCodeCache(script) == 5050);
+        CHECK(CountCacheTestFiles(directory, "*.cbc") == 0);
+
+        DeleteCacheTestFiles(directory, "*");
+        CHECK(RemoveDirectoryA(directory));
+    }
+
+    TEST_CASE("ApiTest_JsByteCodeCacheTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsByteCodeCacheTest);
+    }
 }
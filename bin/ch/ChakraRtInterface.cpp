@@ -147,6 +147,8 @@ bool ChakraRTInterface::LoadChakraDll(ArgInfo* argInfo, HINSTANCE *outLibrary)
     m_jsApiHooks.pfJsrtParse = (JsAPIHooks::JsrtParse)GetChakraCoreSymbol(library, "JsParse");
     m_jsApiHooks.pfJsrtSerialize = (JsAPIHooks::JsrtSerialize)GetChakraCoreSymbol(library, "JsSerialize");
     m_jsApiHooks.pfJsrtRunSerialized = (JsAPIHooks::JsrtRunSerialized)GetChakraCoreSymbol(library, "JsRunSerialized");
+    m_jsApiHooks.pfJsrtSetRuntimeByteCodeCacheDirectory = (JsAPIHooks::JsrtSetRuntimeByteCodeCacheDirectory)GetChakraCoreSymbol(library, "JsSetRuntimeByteCodeCacheDirectory");
+    m_jsApiHooks.pfJsrtSetRuntimeProfileCacheDirectory = (JsAPIHooks::JsrtSetRuntimeProfileCacheDirectory)GetChakraCoreSymbol(library, "JsSetRuntimeProfileCacheDirectory");
     m_jsApiHooks.pfJsrtGetStringLength = (JsAPIHooks::JsrtGetStringLength)GetChakraCoreSymbol(library, "JsGetStringLength");
     m_jsApiHooks.pfJsrtCreateString = (JsAPIHooks::JsrtCreateString)GetChakraCoreSymbol(library, "JsCreateString");
     m_jsApiHooks.pfJsrtCreateStringUtf16 = (JsAPIHooks::JsrtCreateStringUtf16)GetChakraCoreSymbol(library, "JsCreateStringUtf16");
@@ -77,6 +77,8 @@ struct JsAPIHooks
     typedef JsErrorCode(WINAPI *JsrtParse)(JsValueRef script, JsSourceContext sourceContext, JsValueRef sourceUrl, JsParseScriptAttributes parseAttributes, JsValueRef *result);
     typedef JsErrorCode(WINAPI *JsrtSerialize)(JsValueRef script, JsValueRef *buffer, JsParseScriptAttributes parseAttributes);
     typedef JsErrorCode(WINAPI *JsrtRunSerialized)(JsValueRef buffer, JsSerializedLoadScriptCallback scriptLoadCallback, JsSourceContext sourceContext, JsValueRef sourceUrl, JsValueRef * result);
+    typedef JsErrorCode(WINAPI *JsrtSetRuntimeByteCodeCacheDirectory)(JsRuntimeHandle runtime, const char *directory);
+    typedef JsErrorCode(WINAPI *JsrtSetRuntimeProfileCacheDirectory)(JsRuntimeHandle runtime, const char *directory);
     typedef JsErrorCode(WINAPI *JsrtGetStringLength)(JsValueRef value, int *stringLength);
     typedef JsErrorCode(WINAPI *JsrtCopyString)(JsValueRef value, char* buffer, size_t bufferSize, size_t* length);
     typedef JsErrorCode(WINAPI *JsrtCreateString)(const char *content, size_t length, JsValueRef *value);
@@ -173,6 +175,8 @@ struct JsAPIHooks
     JsrtParse pfJsrtParse;
     JsrtSerialize pfJsrtSerialize;
     JsrtRunSerialized pfJsrtRunSerialized;
+    JsrtSetRuntimeByteCodeCacheDirectory pfJsrtSetRuntimeByteCodeCacheDirectory;
+    JsrtSetRuntimeProfileCacheDirectory pfJsrtSetRuntimeProfileCacheDirectory;
     JsrtGetStringLength pfJsrtGetStringLength;
     JsrtCreateString pfJsrtCreateString;
     JsrtCreateStringUtf16 pfJsrtCreateStringUtf16;
@@ -400,6 +404,8 @@ class ChakraRTInterface
     static JsErrorCode WINAPI JsParse(JsValueRef script, JsSourceContext sourceContext, JsValueRef sourceUrl, JsParseScriptAttributes parseAttributes, JsValueRef *result) { return HOOK_JS_API(Parse(script, sourceContext, sourceUrl, parseAttributes, result)); }
     static JsErrorCode WINAPI JsSerialize(JsValueRef script, JsValueRef *buffer, JsParseScriptAttributes parseAttributes) { return HOOK_JS_API(Serialize(script, buffer, parseAttributes)); }
     static JsErrorCode WINAPI JsRunSerialized(JsValueRef buffer, JsSerializedLoadScriptCallback scriptLoadCallback, JsSourceContext sourceContext, JsValueRef sourceUrl, JsValueRef * result) { return HOOK_JS_API(RunSerialized(buffer, scriptLoadCallback, sourceContext, sourceUrl, result)); }
+    static JsErrorCode WINAPI JsSetRuntimeByteCodeCacheDirectory(JsRuntimeHandle runtime, const char *directory) { return HOOK_JS_API(SetRuntimeByteCodeCacheDirectory(runtime, directory)); }
+    static JsErrorCode WINAPI JsSetRuntimeProfileCacheDirectory(JsRuntimeHandle runtime, const char *directory) { return HOOK_JS_API(SetRuntimeProfileCacheDirectory(runtime, directory)); }
     static JsErrorCode WINAPI JsGetStringLength(JsValueRef value, int *stringLength) { return HOOK_JS_API(GetStringLength(value, stringLength)); }
     static JsErrorCode WINAPI JsCopyString(JsValueRef value, char* buffer, size_t bufferSize, size_t* length) { return HOOK_JS_API(CopyString(value, buffer, bufferSize, length)); }
     static JsErrorCode WINAPI JsCreateString(const char *content, size_t length, JsValueRef *value) { return HOOK_JS_API(CreateString(content, length, value)); }
@@ -527,6 +527,21 @@ HRESULT RunScript(const char* fileName, LPCSTR fileContents, JsFinalizeCallback
     return hr;
 }
 
+// Passes the directory given by a host flag to JsSetRuntimeByteCodeCacheDirectory or JsSetRuntimeProfileCacheDirectory
+static JsErrorCode SetRuntimeCacheDirectory(JsRuntimeHandle runtime, LPCWSTR directory,
+    JsErrorCode (WINAPI *setCacheDirectory)(JsRuntimeHandle runtime, const char *directory))
+{
+    char *narrowDirectory = nullptr;
+    if (FAILED(WideStringToNarrowDynamic(directory, &narrowDirectory)))
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    JsErrorCode errorCode = setCacheDirectory(runtime, narrowDirectory);
+    free(narrowDirectory);
+    return errorCode;
+}
+
 static HRESULT CreateRuntime(JsRuntimeHandle *runtime)
 {
     HRESULT hr = E_FAIL;
@@ -576,6 +591,16 @@ static HRESULT CreateRuntime(JsRuntimeHandle *runtime)
     IfJsErrorFailLog(ChakraRTInterface::JsSetRuntimeMemoryLimit(*runtime, memoryLimit));
 #endif
 
+    if (HostConfigFlags::flags.ByteCodeCacheIsEnabled)
+    {
+        IfJsErrorFailLog(SetRuntimeCacheDirectory(*runtime, HostConfigFlags::flags.ByteCodeCache, ChakraRTInterface::JsSetRuntimeByteCodeCacheDirectory));
+    }
+
+    if (HostConfigFlags::flags.ProfileCacheIsEnabled)
+    {
+        IfJsErrorFailLog(SetRuntimeCacheDirectory(*runtime, HostConfigFlags::flags.ProfileCache, ChakraRTInterface::JsSetRuntimeProfileCacheDirectory));
+    }
+
     hr = S_OK;
 Error:
     return hr;
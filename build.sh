@@ -49,6 +49,7 @@ PRINT_USAGE() {
     echo " -n, --ninja           Build with ninja instead of make."
     echo "     --no-icu          Compile without unicode/icu/intl support."
     echo "     --no-jit          Disable JIT"
+    echo "     --perf-trace      Enable perf symbol maps (SIGUSR2) and -PerfJitDump (Linux)"
     echo "     --libs-only       Do not build CH and GCStress"
     echo "     --lto             Enables LLVM Full LTO"
     echo "     --lto-thin        Enables LLVM Thin LTO - xcode 8+ or clang 3.9+"
@@ -65,6 +66,9 @@ PRINT_USAGE() {
     echo "                       Disable FEATUREs from JSRT experimental features."
     echo "     --valgrind        Enable Valgrind support"
     echo "                       !!! Disables Concurrent GC (lower performance)"
+    echo "     --virtual-arraybuffer"
+    echo "                       Guard-page ArrayBuffers for asm.js/WebAssembly (Linux x64),"
+    echo "                       JIT code relies on faults instead of bound checks"
     echo " -v, --verbose         Display verbose output including all options"
     echo "     --wb-check CPPFILE"
     echo "                       Write-barrier check given CPPFILE (git path)"
@@ -72,6 +76,8 @@ PRINT_USAGE() {
     echo "                       Write-barrier analyze given CPPFILE (git path)"
     echo "     --wb-args=PLUGIN_ARGS"
     echo "                       Write-barrier clang plugin args"
+    echo "     --write-watch     Support write watch for concurrent GC (Linux 6.7+),"
+    echo "                       select it with -ForceSoftwareWriteBarrier-"
     echo " -y                    Automatically answer Yes to questions asked by \
 script (at your own risk)"
     echo ""
@@ -111,6 +117,9 @@ WB_ANALYZE=
 WB_ARGS=
 TARGET_PATH=0
 VALGRIND=0
+WRITE_WATCH=
+VIRTUAL_ARRAYBUFFER=
+PERF_TRACE=
 # -DCMAKE_EXPORT_COMPILE_COMMANDS=ON useful for clang-query tool
 CMAKE_EXPORT_COMPILE_COMMANDS="-DCMAKE_EXPORT_COMPILE_COMMANDS=ON"
 LIBS_ONLY_BUILD=
@@ -243,6 +252,10 @@ while [[ $# -gt 0 ]]; do
         NO_JIT="-DNO_JIT_SH=1"
         ;;
 
+    --perf-trace)
+        PERF_TRACE="-DENABLE_PERF_TRACE_SH=1"
+        ;;
+
     --with-intl)
         # todo: remove me! this is temporary
         # until new setting settles and we re-configure CI
@@ -348,6 +361,14 @@ while [[ $# -gt 0 ]]; do
         VALGRIND="-DENABLE_VALGRIND_SH=1"
         ;;
 
+    --virtual-arraybuffer)
+        VIRTUAL_ARRAYBUFFER="-DENABLE_VIRTUAL_ARRAYBUFFER_SH=1"
+        ;;
+
+    --write-watch)
+        WRITE_WATCH="-DENABLE_WRITE_WATCH_SH=1"
+        ;;
+
     -y | -Y)
         ALWAYS_YES=1
         ;;
@@ -610,7 +631,7 @@ echo $EXTRA_DEFINES
 cmake $CMAKE_GEN $CC_PREFIX $ICU_PATH $LTO $STATIC_LIBRARY $ARCH $TARGET_OS \
     $ENABLE_CC_XPLAT_TRACE $EXTRA_DEFINES -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $INTL_ICU \
     $WITHOUT_FEATURES $WB_FLAG $WB_ARGS $CMAKE_EXPORT_COMPILE_COMMANDS $LIBS_ONLY_BUILD\
-    $VALGRIND $BUILD_RELATIVE_DIRECTORY
+    $VALGRIND $WRITE_WATCH $VIRTUAL_ARRAYBUFFER $PERF_TRACE $BUILD_RELATIVE_DIRECTORY
 
 _RET=$?
 if [[ $? == 0 ]]; then
@@ -222,7 +222,7 @@ CodeGenNumberThreadAllocator::Integrate()
             Js::Throw::OutOfMemory();
         }
 #if DBG && GLOBAL_ENABLE_WRITE_BARRIER
-        if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(RecyclerVerifyMark))
+        if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(RecyclerVerifyMark))
         {
             Recycler::WBSetBitRange(record.blockAddress, BlockSize / sizeof(void*));
         }
@@ -123,6 +123,9 @@ void CodeGenWorkItem::OnAddToJitQueue()
     Assert(!this->isInJitQueue);
     this->isInJitQueue = true;
     VerifyJitMode();
+#ifdef BGJIT_STATS
+    this->jitQueueTime = Js::Tick::Now();
+#endif
 
     this->entryPointInfo->SetCodeGenQueued();
     if(IS_JS_ETW(EventEnabledJSCRIPT_FUNCTION_JIT_QUEUED()))
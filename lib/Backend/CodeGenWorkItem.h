@@ -28,7 +28,7 @@ struct CodeGenWorkItem : public JsUtil::Job
     virtual void GetEntryPointAddress(void** entrypoint, ptrdiff_t *size) = 0;
     virtual uint GetInterpretedCount() const = 0;
     virtual void Delete() = 0;
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     virtual void RecordNativeMap(uint32 nativeOffset, uint32 statementIndex) = 0;
 #endif
 #if DBG_DUMP
@@ -93,6 +93,11 @@ struct CodeGenWorkItem : public JsUtil::Job
     QueuedFullJitWorkItem *queuedFullJitWorkItem;
     EmitBufferAllocation<VirtualAllocWrapper, PreReservedVirtualAllocWrapper> *allocation;
 
+#ifdef BGJIT_STATS
+public:
+    Js::Tick jitQueueTime;                      // when the work item was added to the jit queue
+#endif
+
 #ifdef IR_VIEWER
 public:
     bool isRejitIRViewerFunction;               // re-JIT function for IRViewer object generation
@@ -239,7 +244,7 @@ struct JsFunctionCodeGen sealed : public CodeGenWorkItem
         HeapDelete(this);
     }
 
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     void RecordNativeMap(uint32 nativeOffset, uint32 statementIndex) override
     {
         Js::FunctionEntryPointInfo* info = (Js::FunctionEntryPointInfo*) this->GetEntryPoint();
@@ -306,7 +311,7 @@ struct JsLoopBodyCodeGen sealed : public CodeGenWorkItem
         return loopHeader->interpretCount;
     }
 
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     void RecordNativeMap(uint32 nativeOffset, uint32 statementIndex) override
     {
         this->GetEntryPoint()->RecordNativeMap(nativeOffset, statementIndex);
@@ -279,7 +279,7 @@ Encoder::Encode()
         }
     }
 #endif
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     if (this->m_func->DoRecordNativeMap())
     {
         // Record PragmaInstr offsets and throw maps
@@ -812,7 +812,7 @@ Encoder::Encode()
 
 bool Encoder::DoTrackAllStatementBoundary() const
 {
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     return this->m_func->DoRecordNativeMap();
 #else
     return false;
@@ -2114,7 +2114,7 @@ Func::GetVtableName(INT_PTR address)
 }
 #endif
 
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
 bool Func::DoRecordNativeMap() const
 {
 #if defined(VTUNE_PROFILING)
@@ -2123,6 +2123,12 @@ bool Func::DoRecordNativeMap() const
         return true;
     }
 #endif
+#if PERFMAP_TRACE_ENABLED
+    if (PlatformAgnostic::PerfTrace::IsJitDumpEnabled())
+    {
+        return true;
+    }
+#endif
 #if DBG_DUMP
     return PHASE_DUMP(Js::EncoderPhase, this) && Js::Configuration::Global.flags.Verbose;
 #else
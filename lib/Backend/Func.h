@@ -609,7 +609,7 @@ static const unsigned __int64 c_debugFillPattern8 = 0xcececececececece;
 #if DBG_DUMP || defined(ENABLE_IR_VIEWER)
     LPCSTR GetVtableName(INT_PTR address);
 #endif
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     bool DoRecordNativeMap() const;
 #endif
 
@@ -4,27 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 #include "Backend.h"
 
-#if ENABLE_DEBUG_CONFIG_OPTIONS
-
-#define TESTTRACE_PHASE_INSTR(phase, instr, ...) \
-    if(PHASE_TESTTRACE(phase, this->func)) \
-    { \
-        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE]; \
-        Output::Print( \
-            _u("Testtrace: %s function %s (%s): "), \
-            Js::PhaseNames[phase], \
-            instr->m_func->GetJITFunctionBody()->GetDisplayName(), \
-            instr->m_func->GetDebugNumberSet(debugStringBuffer)); \
-        Output::Print(__VA_ARGS__); \
-        Output::Flush(); \
-    }
-
-#else // ENABLE_DEBUG_CONFIG_OPTIONS
-
-#define TESTTRACE_PHASE_INSTR(phase, instr, ...)
-
-#endif // ENABLE_DEBUG_CONFIG_OPTIONS
-
 #if DBG_DUMP
 #define DO_MEMOP_TRACE() (PHASE_TRACE(Js::MemOpPhase, this->func) ||\
         PHASE_TRACE(Js::MemSetPhase, this->func) ||\
@@ -411,6 +390,8 @@ GlobOpt::ForwardPass()
         ProcessMemOp();
     }
 
+    this->ScalarReplaceObjectLiterals();
+
     this->noImplicitCallUsesToInsert = nullptr;
     this->intConstantToStackSymMap = nullptr;
     this->intConstantToValueMap = nullptr;
@@ -7,6 +7,27 @@ class BackwardPass;
 class LoopCount;
 class GlobOpt;
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+
+#define TESTTRACE_PHASE_INSTR(phase, instr, ...) \
+    if(PHASE_TESTTRACE(phase, this->func)) \
+    { \
+        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE]; \
+        Output::Print( \
+            _u("Testtrace: %s function %s (%s): "), \
+            Js::PhaseNames[phase], \
+            instr->m_func->GetJITFunctionBody()->GetDisplayName(), \
+            instr->m_func->GetDebugNumberSet(debugStringBuffer)); \
+        Output::Print(__VA_ARGS__); \
+        Output::Flush(); \
+    }
+
+#else // ENABLE_DEBUG_CONFIG_OPTIONS
+
+#define TESTTRACE_PHASE_INSTR(phase, instr, ...)
+
+#endif // ENABLE_DEBUG_CONFIG_OPTIONS
+
 #if ENABLE_DEBUG_CONFIG_OPTIONS && DBG_DUMP
 
 #define GOPT_TRACE_OPND(opnd, ...) \
@@ -646,6 +667,11 @@ class GlobOpt
     void                    GetMemOpSrcInfo(Loop* loop, IR::Instr* instr, IR::RegOpnd*& base, IR::RegOpnd*& index, IRType& arrayType);
     bool                    HasMemOp(Loop * loop);
 
+    // GlobOptEscapeAnalysis.cpp
+    bool                    DoScalarReplacement() const;
+    void                    ScalarReplaceObjectLiterals();
+    bool                    TryScalarReplaceObjectLiteral(IR::Instr * newObjInstr, BasicBlock * block, const uint * referenceCounts);
+
 private:
     void                    ChangeValueType(BasicBlock *const block, Value *const value, const ValueType newValueType, const bool preserveSubclassInfo, const bool allowIncompatibleType = false) const;
     void                    ChangeValueInfo(BasicBlock *const block, Value *const value, ValueInfo *const newValueInfo, const bool allowIncompatibleType = false, const bool compensated = false) const;
@@ -0,0 +1,420 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "Backend.h"
+
+// Scalar replacement of object literals
+//
+// An object literal whose only uses are loads and stores of its own properties, all of them in the block that
+// allocates it, never escapes and is never observed as an object. Each store is turned into a copy to a new
+// stack sym, each load into a copy from the sym holding the last value stored to that property, and the
+// allocation goes away.
+//
+// The interpreter would need the object back if we bailed out while it is live, and the bailout record has no way
+// to rebuild a replaced object. So nothing is replaced in a function that can bail out.
+
+template <typename Fn>
+static void
+ForEachStackSymReference(IR::Opnd * opnd, Fn fn)
+{
+    if (opnd == nullptr)
+    {
+        return;
+    }
+
+    switch (opnd->GetKind())
+    {
+    case IR::OpndKindReg:
+        if (opnd->AsRegOpnd()->m_sym)
+        {
+            fn(opnd->AsRegOpnd()->m_sym);
+        }
+        break;
+
+    case IR::OpndKindSym:
+    {
+        Sym * sym = opnd->AsSymOpnd()->m_sym;
+        fn(sym->IsStackSym() ? sym->AsStackSym() : sym->AsPropertySym()->m_stackSym);
+        break;
+    }
+
+    case IR::OpndKindIndir:
+        ForEachStackSymReference(opnd->AsIndirOpnd()->GetBaseOpnd(), fn);
+        ForEachStackSymReference(opnd->AsIndirOpnd()->GetIndexOpnd(), fn);
+        break;
+
+    case IR::OpndKindList:
+        for (int i = 0; i < opnd->AsListOpnd()->Count(); i++)
+        {
+            ForEachStackSymReference(opnd->AsListOpnd()->Item(i), fn);
+        }
+        break;
+    }
+}
+
+template <typename Fn>
+static void
+ForEachStackSymReference(IR::Instr * instr, Fn fn)
+{
+    ForEachStackSymReference(instr->GetDst(), fn);
+    ForEachStackSymReference(instr->GetSrc1(), fn);
+    ForEachStackSymReference(instr->GetSrc2(), fn);
+
+    if (instr->IsByteCodeUsesInstr())
+    {
+        IR::ByteCodeUsesInstr * byteCodeUsesInstr = instr->AsByteCodeUsesInstr();
+        if (byteCodeUsesInstr->GetByteCodeUpwardExposedUsed())
+        {
+            FOREACH_BITSET_IN_SPARSEBV(symId, byteCodeUsesInstr->GetByteCodeUpwardExposedUsed())
+            {
+                fn(instr->m_func->m_symTable->FindStackSym(symId));
+            }
+            NEXT_BITSET_IN_SPARSEBV;
+        }
+        if (byteCodeUsesInstr->propertySymUse)
+        {
+            fn(byteCodeUsesInstr->propertySymUse->m_stackSym);
+        }
+    }
+}
+
+static int
+FindLiteralProperty(const Js::PropertyIdArray * propIds, Js::PropertyId propertyId)
+{
+    for (uint32 i = 0; i < propIds->count; i++)
+    {
+        if (propIds->elements[i] == propertyId)
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+bool
+GlobOpt::DoScalarReplacement() const
+{
+    return !PHASE_OFF(Js::ScalarReplacementPhase, this->func) &&
+        !this->func->HasTry() &&
+        !this->func->IsJitInDebugMode() &&
+        !this->func->GetJITFunctionBody()->IsCoroutine() &&
+        !this->func->GetJITFunctionBody()->IsAsmJsMode();
+}
+
+void
+GlobOpt::ScalarReplaceObjectLiterals()
+{
+    if (!this->DoScalarReplacement())
+    {
+        return;
+    }
+
+    bool hasObjectLiteral = false;
+    bool canBailOut = false;
+    FOREACH_INSTR_IN_FUNC(instr, this->func)
+    {
+        hasObjectLiteral = hasObjectLiteral || instr->m_opcode == Js::OpCode::NewScObjectLiteral;
+        canBailOut = canBailOut || instr->HasBailOutInfo() || instr->HasAuxBailOut();
+    }
+    NEXT_INSTR_IN_FUNC;
+
+    if (!hasObjectLiteral)
+    {
+        return;
+    }
+
+    if (canBailOut)
+    {
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        FOREACH_INSTR_IN_FUNC(instr, this->func)
+        {
+            if (instr->m_opcode == Js::OpCode::NewScObjectLiteral)
+            {
+                TESTTRACE_PHASE_INSTR(Js::ScalarReplacementPhase, instr, _u("Not replacing object literal, the function can bail out\n"));
+            }
+        }
+        NEXT_INSTR_IN_FUNC;
+#endif
+        return;
+    }
+
+    // Count every reference to every sym, so that the scan of a single block can tell whether it has seen all the
+    // uses of the literal
+    const SymID maxSymId = this->func->m_symTable->GetMaxSymID();
+    uint * referenceCounts = JitAnewArrayZ(this->tempAlloc, uint, maxSymId + 1);
+    FOREACH_INSTR_IN_FUNC(instr, this->func)
+    {
+        ForEachStackSymReference(instr, [&](StackSym * sym)
+        {
+            referenceCounts[sym->m_id]++;
+        });
+    }
+    NEXT_INSTR_IN_FUNC;
+
+    SList<IR::Instr *> candidates(this->tempAlloc);
+    FOREACH_BLOCK_IN_FUNC(block, this->func)
+    {
+        // Collect the block's literals first, replacing one edits the instructions that follow it
+        FOREACH_INSTR_IN_BLOCK(instr, block)
+        {
+            if (instr->m_opcode == Js::OpCode::NewScObjectLiteral &&
+                instr->GetDst()->IsRegOpnd() &&
+                instr->GetDst()->AsRegOpnd()->m_sym->IsSingleDef() &&
+                instr->GetDst()->GetType() == TyVar)
+            {
+                candidates.Prepend(instr);
+            }
+        }
+        NEXT_INSTR_IN_BLOCK;
+
+        FOREACH_SLIST_ENTRY(IR::Instr *, newObjInstr, &candidates)
+        {
+            this->TryScalarReplaceObjectLiteral(newObjInstr, block, referenceCounts);
+        }
+        NEXT_SLIST_ENTRY;
+        candidates.Clear();
+    }
+    NEXT_BLOCK_IN_FUNC;
+}
+
+bool
+GlobOpt::TryScalarReplaceObjectLiteral(IR::Instr * newObjInstr, BasicBlock * block, const uint * referenceCounts)
+{
+    StackSym * objSym = newObjInstr->GetDst()->AsRegOpnd()->m_sym;
+
+    const Js::PropertyIdArray * propIds =
+        newObjInstr->m_func->GetJITFunctionBody()->ReadPropertyIdArrayFromAuxData(newObjInstr->GetSrc1()->AsIntConstOpnd()->AsUint32());
+    if (propIds->count == 0 || propIds->has__proto__ || propIds->hadDuplicates)
+    {
+        TESTTRACE_PHASE_INSTR(Js::ScalarReplacementPhase, newObjInstr, _u("Not replacing object literal, its properties are not supported\n"));
+        return false;
+    }
+
+    // Copies of the literal to other single def syms are followed as well
+    BVSparse<JitArenaAllocator> aliasSyms(this->tempAlloc);
+    aliasSyms.Set(objSym->m_id);
+
+    BVFixed * initializedProperties = BVFixed::New(propIds->count, this->tempAlloc);
+    uint referencesExpected = referenceCounts[objSym->m_id];
+    uint referencesSeen = 1;
+    IR::Instr * lastUseInstr = newObjInstr;
+
+    auto countReferences = [&](IR::Instr * instr) -> uint
+    {
+        uint count = 0;
+        ForEachStackSymReference(instr, [&](StackSym * sym)
+        {
+            if (aliasSyms.Test(sym->m_id))
+            {
+                count++;
+            }
+        });
+        return count;
+    };
+    auto referencesAlias = [&](IR::Opnd * opnd) -> bool
+    {
+        bool found = false;
+        ForEachStackSymReference(opnd, [&](StackSym * sym)
+        {
+            found = found || aliasSyms.Test(sym->m_id);
+        });
+        return found;
+    };
+
+    for (IR::Instr * instr = newObjInstr->m_next;
+        referencesSeen < referencesExpected && instr != block->GetLastInstr()->m_next;
+        instr = instr->m_next)
+    {
+        const uint referenceCount = countReferences(instr);
+        if (referenceCount == 0)
+        {
+            continue;
+        }
+
+        const char16 * rejectReason = nullptr;
+        switch (instr->m_opcode)
+        {
+        case Js::OpCode::InitFld:
+        case Js::OpCode::StFld:
+        case Js::OpCode::StFldStrict:
+        {
+            // obj.p = value, with p one of the literal's own data properties
+            if (referenceCount != 1 ||
+                !instr->GetDst()->IsSymOpnd() ||
+                !instr->GetDst()->AsSymOpnd()->m_sym->IsPropertySym() ||
+                referencesAlias(instr->GetSrc1()) ||
+                instr->GetSrc2() != nullptr ||
+                !(instr->GetSrc1()->IsRegOpnd() || instr->GetSrc1()->IsAddrOpnd()) ||
+                instr->GetSrc1()->GetType() != TyVar)
+            {
+                rejectReason = _u("it escapes");
+                break;
+            }
+            const int index = FindLiteralProperty(propIds, instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_propertyId);
+            if (index < 0)
+            {
+                rejectReason = _u("it escapes");
+                break;
+            }
+            initializedProperties->Set(index);
+            break;
+        }
+
+        case Js::OpCode::LdFld:
+        {
+            // value = obj.p, once p has been stored to
+            if (referenceCount != 1 ||
+                !referencesAlias(instr->GetSrc1()) ||
+                !instr->GetSrc1()->IsSymOpnd() ||
+                !instr->GetSrc1()->AsSymOpnd()->m_sym->IsPropertySym() ||
+                !instr->GetDst()->IsRegOpnd() ||
+                instr->GetDst()->GetType() != TyVar)
+            {
+                rejectReason = _u("it escapes");
+                break;
+            }
+            const int index = FindLiteralProperty(propIds, instr->GetSrc1()->AsSymOpnd()->m_sym->AsPropertySym()->m_propertyId);
+            if (index < 0 || !initializedProperties->Test(index))
+            {
+                rejectReason = _u("it escapes");
+            }
+            break;
+        }
+
+        case Js::OpCode::Ld_A:
+        {
+            if (referenceCount != 1 ||
+                !instr->GetSrc1()->IsRegOpnd() ||
+                !instr->GetDst()->IsRegOpnd())
+            {
+                rejectReason = _u("it escapes");
+                break;
+            }
+            StackSym * copySym = instr->GetDst()->AsRegOpnd()->m_sym;
+            if (!copySym->IsSingleDef() || copySym->GetType() != TyVar)
+            {
+                rejectReason = _u("it escapes");
+                break;
+            }
+            aliasSyms.Set(copySym->m_id);
+            referencesExpected += referenceCounts[copySym->m_id];
+            referencesSeen++;
+            break;
+        }
+
+        case Js::OpCode::ByteCodeUses:
+            // Only there to keep the literal alive for bailouts, and there are none
+            if (referencesAlias(instr->GetDst()))
+            {
+                rejectReason = _u("it escapes");
+            }
+            break;
+
+        default:
+            rejectReason = _u("it escapes");
+            break;
+        }
+
+        if (rejectReason)
+        {
+            TESTTRACE_PHASE_INSTR(Js::ScalarReplacementPhase, newObjInstr, _u("Not replacing object literal, %s\n"), rejectReason);
+            return false;
+        }
+
+        referencesSeen += referenceCount;
+        lastUseInstr = instr;
+    }
+
+    if (referencesSeen != referencesExpected)
+    {
+        // Used before it's allocated, in another block or after the end of this one
+        TESTTRACE_PHASE_INSTR(Js::ScalarReplacementPhase, newObjInstr, _u("Not replacing object literal, it escapes its block\n"));
+        return false;
+    }
+
+    TESTTRACE_PHASE_INSTR(Js::ScalarReplacementPhase, newObjInstr, _u("Replacing object literal with %u properties\n"), propIds->count);
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (PHASE_TRACE(Js::ScalarReplacementPhase, this->func))
+    {
+        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+        Output::Print(_u("ScalarReplacement: function %s (%s): replaced object literal s%u with %u properties"),
+            newObjInstr->m_func->GetJITFunctionBody()->GetDisplayName(),
+            newObjInstr->m_func->GetDebugNumberSet(debugStringBuffer),
+            objSym->m_id,
+            propIds->count);
+        newObjInstr->DumpByteCodeOffset();
+        Output::Print(_u("\n"));
+        Output::Flush();
+    }
+#endif
+
+    // Rewrite the uses. The syms holding the property values are only assigned once.
+    StackSym ** propertySyms = JitAnewArrayZ(this->tempAlloc, StackSym *, propIds->count);
+    IR::Instr * endInstr = lastUseInstr->m_next;
+    IR::Instr * instrNext;
+    for (IR::Instr * instr = newObjInstr->m_next; instr != endInstr; instr = instrNext)
+    {
+        instrNext = instr->m_next;
+
+        switch (instr->m_opcode)
+        {
+        case Js::OpCode::InitFld:
+        case Js::OpCode::StFld:
+        case Js::OpCode::StFldStrict:
+        {
+            if (!referencesAlias(instr->GetDst()))
+            {
+                break;
+            }
+            const int index = FindLiteralProperty(propIds, instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_propertyId);
+            StackSym * propertySym = StackSym::New(TyVar, instr->m_func);
+            propertySyms[index] = propertySym;
+            instr->ReplaceDst(IR::RegOpnd::New(propertySym, TyVar, instr->m_func));
+            instr->m_opcode = Js::OpCode::Ld_A;
+            break;
+        }
+
+        case Js::OpCode::LdFld:
+        {
+            if (!referencesAlias(instr->GetSrc1()))
+            {
+                break;
+            }
+            const int index = FindLiteralProperty(propIds, instr->GetSrc1()->AsSymOpnd()->m_sym->AsPropertySym()->m_propertyId);
+            Assert(propertySyms[index]);
+            instr->ReplaceSrc1(IR::RegOpnd::New(propertySyms[index], TyVar, instr->m_func));
+            instr->m_opcode = Js::OpCode::Ld_A;
+            break;
+        }
+
+        case Js::OpCode::Ld_A:
+            if (referencesAlias(instr->GetSrc1()))
+            {
+                instr->Remove();
+            }
+            break;
+
+        case Js::OpCode::ByteCodeUses:
+        {
+            IR::ByteCodeUsesInstr * byteCodeUsesInstr = instr->AsByteCodeUsesInstr();
+            if (byteCodeUsesInstr->GetByteCodeUpwardExposedUsed())
+            {
+                FOREACH_BITSET_IN_SPARSEBV(symId, &aliasSyms)
+                {
+                    byteCodeUsesInstr->Clear(symId);
+                }
+                NEXT_BITSET_IN_SPARSEBV;
+            }
+            if (byteCodeUsesInstr->propertySymUse && aliasSyms.Test(byteCodeUsesInstr->propertySymUse->m_stackSym->m_id))
+            {
+                byteCodeUsesInstr->propertySymUse = nullptr;
+            }
+            break;
+        }
+        }
+    }
+
+    newObjInstr->Remove();
+    return true;
+}
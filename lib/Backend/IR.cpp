@@ -1967,7 +1967,7 @@ PragmaInstr::New(Js::OpCode opcode, uint32 index, Func *func)
 ///
 ///----------------------------------------------------------------------------
 
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
 void
 PragmaInstr::Record(uint32 nativeBufferOffset)
 {
@@ -990,7 +990,7 @@ class PragmaInstr : public Instr
     virtual void            Dump(IRDumpFlags flags) override;
 
 #endif
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     void Record(uint32 nativeBufferOffset);
 #endif
     PragmaInstr * ClonePragma();
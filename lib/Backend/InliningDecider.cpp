@@ -464,6 +464,10 @@ bool InliningDecider::GetBuiltInInfoCommon(
 
     case Js::JavascriptBuiltInFunction::JavascriptString_Link:
     case Js::JavascriptBuiltInFunction::JavascriptString_LocaleCompare:
+
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Get:
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Set:
+    case Js::JavascriptBuiltInFunction::JavascriptSet_Add:
         goto CallDirectCommon;
 
     case Js::JavascriptBuiltInFunction::JavascriptArray_Join:
@@ -490,6 +494,8 @@ bool InliningDecider::GetBuiltInInfoCommon(
     case Js::JavascriptBuiltInFunction::JavascriptArray_Includes:
     case Js::JavascriptBuiltInFunction::JavascriptObject_HasOwnProperty:
     case Js::JavascriptBuiltInFunction::JavascriptArray_IsArray:
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Has:
+    case Js::JavascriptBuiltInFunction::JavascriptSet_Has:
         *returnType = ValueType::Boolean;
         goto CallDirectCommon;
 
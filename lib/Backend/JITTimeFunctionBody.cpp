@@ -241,6 +241,7 @@ JITTimeFunctionBody::InitializeJITFunctionData(
     jitBody->nameLength = functionBody->GetDisplayNameLength() + 1; // +1 for null terminator
     jitBody->displayName = (char16 *)functionBody->GetDisplayName();
     jitBody->objectLiteralTypesAddr = (intptr_t)functionBody->GetObjectLiteralTypesWithLock();
+    jitBody->objectLiteralSitesAddr = (intptr_t)functionBody->GetObjectLiteralSitesWithLock();
     jitBody->literalRegexCount = functionBody->GetLiteralRegexCount();
     jitBody->literalRegexes = (intptr_t*)functionBody->GetLiteralRegexesWithLock();
 
@@ -848,6 +849,17 @@ JITTimeFunctionBody::GetObjectLiteralTypeRef(uint index) const
     return m_bodyData.objectLiteralTypesAddr + index * MachPtr;
 }
 
+intptr_t
+JITTimeFunctionBody::GetObjectLiteralSiteAddr(uint index) const
+{
+    // Allocation sites are only created once the literal has been allocated in the interpreter
+    if (m_bodyData.objectLiteralSitesAddr == 0)
+    {
+        return 0;
+    }
+    return m_bodyData.objectLiteralSitesAddr + index * sizeof(Js::AllocationSiteInfo);
+}
+
 intptr_t
 JITTimeFunctionBody::GetConstantVar(Js::RegSlot location) const
 {
@@ -166,6 +166,7 @@ class JITTimeFunctionBody
     intptr_t GetCallCountStatsAddr() const;
     intptr_t GetFormalsPropIdArrayAddr() const;
     intptr_t GetObjectLiteralTypeRef(uint index) const;
+    intptr_t GetObjectLiteralSiteAddr(uint index) const;
     intptr_t GetLiteralRegexAddr(uint index) const;
     uint GetNestedFuncIndexForSlotIdInCachedScope(uint index) const;
     const AsmJsJITInfo * GetAsmJsInfo() const;
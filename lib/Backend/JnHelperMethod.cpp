@@ -14,6 +14,10 @@
 #endif
 #include "Math/CrtSSE2Math.h"
 #include "Library/JavascriptGeneratorFunction.h"
+#include "Library/SameValueComparer.h"
+#include "Library/MapOrSetDataTable.h"
+#include "Library/JavascriptMap.h"
+#include "Library/JavascriptSet.h"
 #include "RuntimeMathPch.h"
 
 namespace IR
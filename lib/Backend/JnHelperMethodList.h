@@ -301,6 +301,11 @@ HELPERCALL(AllocMemForSparseArraySegmentBase, (void (*)(size_t, Recycler*))Js::J
 HELPERCALL(AllocMemForFrameDisplay, (void (*)(size_t, Recycler*))Js::JavascriptOperators::JitRecyclerAlloc<Js::FrameDisplay>, 0)
 HELPERCALL(AllocMemForVarArray, Js::JavascriptOperators::AllocMemForVarArray, 0)
 HELPERCALL(AllocMemForJavascriptRegExp, (void (*)(size_t, Recycler*))Js::JavascriptOperators::JitRecyclerAlloc<Js::JavascriptRegExp>, 0)
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+HELPERCALL(AllocMemForScObjectPretenured, (void (*)(size_t, Recycler*))Js::JavascriptOperators::JitRecyclerAllocWithBarrier<Js::DynamicObject>, 0)
+HELPERCALL(AllocMemForVarArrayPretenured, Js::JavascriptOperators::AllocMemForVarArrayWithBarrier, 0)
+#endif
+HELPERCALL(RecordAllocationSiteSample, Js::AllocationSiteInfo::RecordJitAllocationSample, 0)
 HELPERCALL(NewJavascriptObjectNoArg, Js::JavascriptOperators::NewJavascriptObjectNoArg, 0)
 HELPERCALL(NewJavascriptArrayNoArg, Js::JavascriptOperators::NewJavascriptArrayNoArg, 0)
 HELPERCALL(NewScObjectNoArg, Js::JavascriptOperators::NewScObjectNoArg, 0)
@@ -477,6 +482,11 @@ HELPERCALL(GlobalObject_ParseInt, Js::GlobalObject::EntryParseInt, 0)
 HELPERCALL(String_PadStart, Js::JavascriptString::EntryPadStart, 0)
 HELPERCALL(String_PadEnd, Js::JavascriptString::EntryPadEnd, 0)
 HELPERCALL(Object_HasOwnProperty, Js::JavascriptObject::EntryHasOwnProperty, 0)
+HELPERCALL(Map_Get, Js::JavascriptMap::EntryGet, 0)
+HELPERCALL(Map_Has, Js::JavascriptMap::EntryHas, 0)
+HELPERCALL(Map_Set, Js::JavascriptMap::EntrySet, 0)
+HELPERCALL(Set_Add, Js::JavascriptSet::EntryAdd, 0)
+HELPERCALL(Set_Has, Js::JavascriptSet::EntryHas, 0)
 
 HELPERCALL(RegExp_SplitResultUsed, Js::RegexHelper::RegexSplitResultUsed, 0)
 HELPERCALL(RegExp_SplitResultUsedAndMayBeTemp, Js::RegexHelper::RegexSplitResultUsedAndMayBeTemp, 0)
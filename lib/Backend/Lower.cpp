@@ -106,7 +106,7 @@ Lowerer::Lower()
 #if DBG && GLOBAL_ENABLE_WRITE_BARRIER
     // TODO: (leish)(swb) implement for arm
 #if defined(_M_IX86) || defined(_M_AMD64)
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(VerifyBarrierBit))
     {
         // find out all write barrier setting instr, call Recycler::WBSetBit for verification purpose
         // should do this in LowererMD::GenerateWriteBarrier, however, can't insert call instruction there
@@ -3436,11 +3436,26 @@ Lowerer::GenerateFastBrSrNeq(IR::Instr * instr, IR::Instr ** pInstrPrev)
 }
 
 void
-Lowerer::GenerateDynamicObjectAlloc(IR::Instr * newObjInstr, uint inlineSlotCount, uint slotCount, IR::RegOpnd * newObjDst, IR::Opnd * typeSrc)
+Lowerer::GenerateDynamicObjectAlloc(IR::Instr * newObjInstr, uint inlineSlotCount, uint slotCount, IR::RegOpnd * newObjDst, IR::Opnd * typeSrc, bool pretenure)
 {
     size_t headerAllocSize = sizeof(Js::DynamicObject) + inlineSlotCount * sizeof(Js::Var);
     IR::SymOpnd * tempObjectSymOpnd;
-    bool isZeroed = GenerateRecyclerOrMarkTempAlloc(newObjInstr, newObjDst, IR::HelperAllocMemForScObject, headerAllocSize, &tempObjectSymOpnd);
+    bool isZeroed;
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+    if (pretenure)
+    {
+        Assert(!newObjInstr->dstIsTempObject);
+        GenerateRecyclerAlloc(IR::HelperAllocMemForScObjectPretenured, headerAllocSize, newObjDst, newObjInstr, false, true /* pretenure */);
+        tempObjectSymOpnd = nullptr;
+        isZeroed = true;
+    }
+    else
+#else
+    Assert(!pretenure);
+#endif
+    {
+        isZeroed = GenerateRecyclerOrMarkTempAlloc(newObjInstr, newObjDst, IR::HelperAllocMemForScObject, headerAllocSize, &tempObjectSymOpnd);
+    }
 
     if (tempObjectSymOpnd && !PHASE_OFF(Js::HoistMarkTempInitPhase, this->m_func) && this->outerMostLoopLabel)
     {
@@ -3462,7 +3477,16 @@ Lowerer::GenerateDynamicObjectAlloc(IR::Instr * newObjInstr, uint inlineSlotCoun
         size_t auxSlotsAllocSize = (slotCount - inlineSlotCount) * sizeof(Js::Var);
         IR::RegOpnd* auxSlots = IR::RegOpnd::New(TyMachPtr, m_func);
 
-        GenerateRecyclerAllocAligned(IR::HelperAllocMemForVarArray, auxSlotsAllocSize, auxSlots, newObjInstr);
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+        if (pretenure)
+        {
+            GenerateRecyclerAllocAligned(IR::HelperAllocMemForVarArrayPretenured, auxSlotsAllocSize, auxSlots, newObjInstr, false, true /* pretenure */);
+        }
+        else
+#endif
+        {
+            GenerateRecyclerAllocAligned(IR::HelperAllocMemForVarArray, auxSlotsAllocSize, auxSlots, newObjInstr);
+        }
         GenerateMemInit(newObjDst, Js::DynamicObject::GetOffsetOfAuxSlots(), auxSlots, newObjInstr, isZeroed);
 
         IR::IndirOpnd* newObjAuxSlots = IR::IndirOpnd::New(newObjDst, Js::DynamicObject::GetOffsetOfAuxSlots(), TyMachPtr, m_func);
@@ -3497,7 +3521,9 @@ Lowerer::LowerNewScObjectLiteral(IR::Instr *newObjInstr)
 {
     Func * func = m_func;
     IR::IntConstOpnd * literalObjectIdOpnd = newObjInstr->UnlinkSrc2()->AsIntConstOpnd();
-    intptr_t literalTypeRef = newObjInstr->m_func->GetJITFunctionBody()->GetObjectLiteralTypeRef(literalObjectIdOpnd->AsUint32());
+    uint literalObjectId = literalObjectIdOpnd->AsUint32();
+    intptr_t literalTypeRef = newObjInstr->m_func->GetJITFunctionBody()->GetObjectLiteralTypeRef(literalObjectId);
+    intptr_t allocationSiteAddr = newObjInstr->m_func->GetJITFunctionBody()->GetObjectLiteralSiteAddr(literalObjectId);
 
     IR::LabelInstr * helperLabel = nullptr;
     IR::LabelInstr * allocLabel = nullptr;
@@ -3578,11 +3604,78 @@ Lowerer::LowerNewScObjectLiteral(IR::Instr *newObjInstr)
         inlineSlotCapacity,
         slotCapacity,
         dstOpnd,
-        literalTypeOpnd);
+        literalTypeOpnd,
+        ShouldPretenureObjectLiteral(newObjInstr, literalObjectId, allocationSiteAddr));
+
+    if (allocationSiteAddr != 0 && !newObjInstr->dstIsTempObject)
+    {
+        GenerateAllocationSiteSample(newObjInstr, dstOpnd, allocationSiteAddr);
+    }
 
     newObjInstr->Remove();
 }
 
+bool
+Lowerer::ShouldPretenureObjectLiteral(IR::Instr * newObjInstr, uint literalObjectId, intptr_t allocationSiteAddr)
+{
+    // TODO: OOP JIT, allocation site feedback is only read by the in-proc jit
+    if (allocationSiteAddr == 0 || newObjInstr->dstIsTempObject || m_func->IsOOPJIT())
+    {
+        return false;
+    }
+
+    const Js::AllocationSiteInfo * allocationSite = (const Js::AllocationSiteInfo *)allocationSiteAddr;
+    bool pretenure = false;
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+    // Pretenured objects live in card-tracked heap blocks, so only jitted code that emits write barriers may allocate them
+    pretenure = allocationSite->ShouldPretenure() && !PHASE_OFF(Js::PretenurePhase, newObjInstr->m_func);
+#endif
+
+    if (PHASE_TRACE(Js::PretenurePhase, newObjInstr->m_func))
+    {
+        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+        uint survivedCount = allocationSite->GetSurvivedCount();
+        uint decidedCount = survivedCount + allocationSite->GetDiedCount();
+        Output::Print(_u("Pretenure: function %s (%s): object literal %u: %u of %u decided samples survived (%u%%)%s.\n"),
+            newObjInstr->m_func->GetJITFunctionBody()->GetDisplayName(), newObjInstr->m_func->GetDebugNumberSet(debugStringBuffer),
+            literalObjectId, survivedCount, decidedCount, decidedCount == 0 ? 0 : survivedCount * 100 / decidedCount,
+            pretenure ? _u(", pretenured") : _u(""));
+        Output::Flush();
+    }
+
+    return pretenure;
+}
+
+void
+Lowerer::GenerateAllocationSiteSample(IR::Instr * newObjInstr, IR::RegOpnd * newObjDst, intptr_t allocationSiteAddr)
+{
+    Func * func = newObjInstr->m_func;
+
+    // Generate:
+    //     subs temp, [allocationSite->sampleCountdown], 1
+    //     bcs $sample
+    //     mov [allocationSite->sampleCountdown], temp
+    //     b $continue
+    //   $sample:
+    //     AllocationSiteInfo::RecordJitAllocationSample(allocationSite, newObjDst, scriptContext)
+    //   $continue:
+
+    IR::MemRefOpnd * countdownOpnd = IR::MemRefOpnd::New(
+        (char *)allocationSiteAddr + Js::AllocationSiteInfo::GetOffsetOfSampleCountdown(), TyUint32, func);
+    const IR::AutoReuseOpnd autoReuseCountdownOpnd(countdownOpnd, func);
+
+    IR::Instr * onSampleInsertBeforeInstr;
+    InsertDecUInt32PreventOverflow(countdownOpnd, countdownOpnd, newObjInstr, &onSampleInsertBeforeInstr);
+
+    LoadScriptContext(onSampleInsertBeforeInstr);
+    m_lowererMD.LoadHelperArgument(onSampleInsertBeforeInstr, newObjDst);
+    m_lowererMD.LoadHelperArgument(onSampleInsertBeforeInstr, IR::AddrOpnd::New(allocationSiteAddr, IR::AddrOpndKindDynamicMisc, func));
+    IR::Instr * callInstr = IR::Instr::New(Js::OpCode::Call, func);
+    callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::HelperRecordAllocationSiteSample, func));
+    onSampleInsertBeforeInstr->InsertBefore(callInstr);
+    m_lowererMD.LowerCall(callInstr, 0);
+}
+
 IR::Instr*
 Lowerer::LowerProfiledNewScArray(IR::JitProfilingInstr* arrInstr)
 {
@@ -4953,7 +5046,7 @@ bool Lowerer::TryLowerNewScObjectWithFixedCtorCache(IR::Instr* newObjInstr, IR::
 }
 
 void
-Lowerer::GenerateRecyclerAllocAligned(IR::JnHelperMethod allocHelper, size_t allocSize, IR::RegOpnd* newObjDst, IR::Instr* insertionPointInstr, bool inOpHelper)
+Lowerer::GenerateRecyclerAllocAligned(IR::JnHelperMethod allocHelper, size_t allocSize, IR::RegOpnd* newObjDst, IR::Instr* insertionPointInstr, bool inOpHelper, bool pretenure)
 {
     IR::LabelInstr * allocDoneLabel = nullptr;
 
@@ -4962,7 +5055,7 @@ Lowerer::GenerateRecyclerAllocAligned(IR::JnHelperMethod allocHelper, size_t all
         IR::LabelInstr * allocHelperLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
         allocDoneLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, inOpHelper);
 
-        this->m_lowererMD.GenerateFastRecyclerAlloc(allocSize, newObjDst, insertionPointInstr, allocHelperLabel, allocDoneLabel);
+        this->m_lowererMD.GenerateFastRecyclerAlloc(allocSize, newObjDst, insertionPointInstr, allocHelperLabel, allocDoneLabel, pretenure);
 
         // $allocHelper:
         insertionPointInstr->InsertBefore(allocHelperLabel);
@@ -23547,10 +23640,10 @@ Lowerer::LowerConvPrimStr(IR::Instr * instr)
 }
 
 void
-Lowerer::GenerateRecyclerAlloc(IR::JnHelperMethod allocHelper, size_t allocSize, IR::RegOpnd* newObjDst, IR::Instr* insertionPointInstr, bool inOpHelper)
+Lowerer::GenerateRecyclerAlloc(IR::JnHelperMethod allocHelper, size_t allocSize, IR::RegOpnd* newObjDst, IR::Instr* insertionPointInstr, bool inOpHelper, bool pretenure)
 {
     size_t alignedSize = HeapInfo::GetAlignedSizeNoCheck(allocSize);
-    this->GenerateRecyclerAllocAligned(allocHelper, alignedSize, newObjDst, insertionPointInstr, inOpHelper);
+    this->GenerateRecyclerAllocAligned(allocHelper, alignedSize, newObjDst, insertionPointInstr, inOpHelper, pretenure);
 }
 
 void
@@ -1665,6 +1665,14 @@ NativeCodeGenerator::CheckCodeGenDone(
             entryPointInfo->GetNativeEntrypoint());
         jsMethod = entryPointInfo->jsMethod;
 
+#ifdef DYNAMIC_PROFILE_CACHE
+        if (entryPointInfo->GetJitMode() == ExecutionMode::FullJit && functionBody->HasDynamicProfileInfo())
+        {
+            // Saved with the profile, the next run queues the full JIT job on the first call
+            functionBody->GetAnyDynamicProfileInfo()->RecordFullJit();
+        }
+#endif
+
         Assert(!functionBody->NeedEnsureDynamicProfileInfo() || jsMethod == Js::DynamicProfileInfo::EnsureDynamicProfileInfoThunk || functionBody->GetIsAsmjsMode());
         if (functionBody->GetIsAsmjsMode() && functionBody->NeedEnsureDynamicProfileInfo())
         {
@@ -1799,6 +1807,14 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
 
     CodeGenWorkItem *const codeGenWork = static_cast<CodeGenWorkItem *>(job);
 
+#ifdef BGJIT_STATS
+    // Must be interlocked because work items of the same script context may be processed by several threads concurrently
+    InterlockedExchangeAdd64(
+        reinterpret_cast<volatile LONG64 *>(&scriptContext->jitQueueWaitTime),
+        (Js::Tick::Now() - codeGenWork->jitQueueTime).ToMicroseconds());
+    InterlockedIncrement(&scriptContext->jitQueueWaitCount);
+#endif
+
     switch (codeGenWork->Type())
     {
     case JsLoopBodyWorkItemType:
@@ -3393,22 +3409,56 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
     AutoOptionalCriticalSection autoLock(lock ? Processor()->GetCriticalSection() : nullptr);
     scriptContext->GetThreadContext()->RegisterCodeGenRecyclableData(recyclableData);
 
+    // Rank the work item by how many times its code has run so far. For loop bodies, that is the number of iterations, so hot
+    // loop bodies are jitted ahead of functions that were only called a few times.
+    codeGenWorkItem->SetHotness(codeGenWorkItem->GetInterpretedCount());
+
     // If we have added a lot of jobs that are still waiting to be jitted, remove the oldest job
     // to ensure we do not spend time jitting stale work items.
     const ExecutionMode jitMode = codeGenWorkItem->GetJitMode();
     if(jitMode == ExecutionMode::FullJit &&
         queuedFullJitWorkItemCount >= (unsigned int)CONFIG_FLAG(JitQueueThreshold))
     {
-        CodeGenWorkItem *const workItemRemoved = queuedFullJitWorkItems.Tail()->WorkItem();
+        // With a ranked queue, remove the coldest work item that was not prioritized instead
+        QueuedFullJitWorkItem *queuedFullJitWorkItemRemoved = queuedFullJitWorkItems.Tail();
+        if(CONFIG_FLAG_RELEASE(RankedJitQueue))
+        {
+            for(QueuedFullJitWorkItem *queuedFullJitWorkItem = queuedFullJitWorkItemRemoved->Previous();
+                queuedFullJitWorkItem;
+                queuedFullJitWorkItem = queuedFullJitWorkItem->Previous())
+            {
+                const CodeGenWorkItem *const workItem = queuedFullJitWorkItem->WorkItem();
+                if(!workItem->IsPrioritized() &&
+                    (queuedFullJitWorkItemRemoved->WorkItem()->IsPrioritized() ||
+                        workItem->Hotness() < queuedFullJitWorkItemRemoved->WorkItem()->Hotness()))
+                {
+                    queuedFullJitWorkItemRemoved = queuedFullJitWorkItem;
+                }
+            }
+        }
+
+        CodeGenWorkItem *const workItemRemoved = queuedFullJitWorkItemRemoved->WorkItem();
         Assert(workItemRemoved->GetJitMode() == ExecutionMode::FullJit);
         if(Processor()->RemoveJob(workItemRemoved))
         {
-            queuedFullJitWorkItems.UnlinkFromEnd();
+            queuedFullJitWorkItems.Unlink(queuedFullJitWorkItemRemoved);
             --queuedFullJitWorkItemCount;
             workItemRemoved->OnRemoveFromJitQueue(this);
+#ifdef BGJIT_STATS
+            scriptContext->jitQueueEvictCount++;
+#endif
         }
     }
     Processor()->AddJob(codeGenWorkItem, prioritize);   // This one can throw (really unlikely though), OOM specifically.
+#ifdef BGJIT_STATS
+    const uint jitQueueDepth = this->NumJobsAddedToProcessor();
+    scriptContext->jitQueueDepthTotal += jitQueueDepth;
+    scriptContext->jitQueueAddCount++;
+    if(jitQueueDepth > scriptContext->jitQueueMaxDepth)
+    {
+        scriptContext->jitQueueMaxDepth = jitQueueDepth;
+    }
+#endif
     if(jitMode == ExecutionMode::FullJit)
     {
         QueuedFullJitWorkItem *const queuedFullJitWorkItem = codeGenWorkItem->EnsureQueuedFullJitWorkItem();
@@ -109,7 +109,7 @@ Opnd::IsWriteBarrierTriggerableValue()
     }
 
 #if DBG
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(VerifyBarrierBit))
     {
         return true; // No further optimization if we are in verification
     }
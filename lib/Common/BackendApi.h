@@ -235,6 +235,7 @@ enum VTableValue {
     VtableInvalid,
     VtablePropertyString,
     VtableLazyJSONString,
+    VtableOneByteString,
     VtableLiteralStringWithPropertyStringPtr,
     VtableJavascriptBoolean,
     VtableJavascriptArray,
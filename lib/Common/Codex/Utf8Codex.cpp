@@ -2,6 +2,15 @@
 // Copyright (C) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
+// The intrinsics headers go first, pal.h redefines some of the names they use
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define CODEX_SIMD_SSE2 1
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#include <arm_neon.h>
+#define CODEX_SIMD_NEON 1
+#endif
+
 #include "Utf8Codex.h"
 
 #ifndef _WIN32
@@ -38,6 +47,78 @@ namespace utf8
         return (reinterpret_cast<size_t>(pb) & mAlignmentMask) == 0 && (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
     }
 
+#if defined(CODEX_SIMD_SSE2) || defined(CODEX_SIMD_NEON)
+#define CODEX_SIMD 1
+    // ASCII runs are converted a block of 16 code units at a time. SSE2 and NEON are part of the baseline of
+    // the x86, x64 and ARM64 targets, so no runtime dispatch is needed; the loads have no alignment requirement.
+    const size_t SimdBlockSize = 16;
+
+    inline bool IsAsciiBlock(LPCUTF8 pch)
+    {
+#ifdef CODEX_SIMD_SSE2
+        return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pch))) == 0;
+#else
+        return vmaxvq_u8(vld1q_u8(pch)) < 0x80;
+#endif
+    }
+
+    // Widens a block of ASCII bytes into code units. Returns false, without writing, if any byte is not ASCII.
+    inline bool WidenAsciiBlock(LPCUTF8 pch, char16 *dest)
+    {
+#ifdef CODEX_SIMD_SSE2
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pch));
+        if (_mm_movemask_epi8(bytes) != 0)
+        {
+            return false;
+        }
+        __m128i zero = _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8), _mm_unpackhi_epi8(bytes, zero));
+#else
+        uint8x16_t bytes = vld1q_u8(pch);
+        if (vmaxvq_u8(bytes) >= 0x80)
+        {
+            return false;
+        }
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest), vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + 8), vmovl_high_u8(bytes));
+#endif
+        return true;
+    }
+
+    // Narrows a block of code units below 0x80 into bytes. Returns false, without writing, if any code unit
+    // is not ASCII.
+    template <bool countBytesOnly>
+    inline bool NarrowAsciiBlock(const char16 *source, LPUTF8 dest)
+    {
+#ifdef CODEX_SIMD_SSE2
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 8));
+        __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi16(static_cast<short>(0xFF80)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xFFFF)
+        {
+            return false;
+        }
+        if (!countBytesOnly)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_packus_epi16(low, high));
+        }
+#else
+        uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t *>(source));
+        uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t *>(source + 8));
+        if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80)
+        {
+            return false;
+        }
+        if (!countBytesOnly)
+        {
+            vst1q_u8(dest, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+        }
+#endif
+        return true;
+    }
+#endif
+
     inline size_t EncodedBytes(char16 prefix)
     {
          CodexAssert(0 == (prefix & 0xFF00)); // prefix must really be a byte. We use char16 for as a convenience for the API.
@@ -366,9 +447,16 @@ namespace utf8
         LPCUTF8 p = pbUtf8;
         char16 *dest = buffer;
 
+LFastPath:
+#ifdef CODEX_SIMD
+        while (static_cast<size_t>(pbEnd - p) >= SimdBlockSize && WidenAsciiBlock(p, dest))
+        {
+            p += SimdBlockSize;
+            dest += SimdBlockSize;
+        }
+#endif
         if (!ShouldFastPath(p, dest)) goto LSlowPath;
 
-LFastPath:
         while (p + 3 < pbEnd)
         {
             unsigned bytes = *(unsigned *)p;
@@ -396,6 +484,10 @@ namespace utf8
                 break;
             }
 
+#ifdef CODEX_SIMD
+            // Back to the block loop as soon as an ASCII run may start
+            if (p < pbEnd && *p < 0x80 && static_cast<size_t>(pbEnd - p) >= SimdBlockSize) goto LFastPath;
+#endif
             if (ShouldFastPath(p, dest)) goto LFastPath;
         }
 
@@ -440,9 +532,25 @@ namespace utf8
 
         CodexAssertOrFailFast(dest <= bufferEnd);
 
+LFastPath:
+#ifdef CODEX_SIMD
+        while (cch >= SimdBlockSize)
+        {
+            if (!countBytesOnly)
+            {
+                CodexAssertOrFailFast(dest + SimdBlockSize <= bufferEnd);
+            }
+            if (!NarrowAsciiBlock<countBytesOnly>(source, dest))
+            {
+                break;
+            }
+            dest += SimdBlockSize;
+            source += SimdBlockSize;
+            cch -= SimdBlockSize;
+        }
+#endif
         if (!ShouldFastPath(dest, source)) goto LSlowPath;
 
-LFastPath:
         while (cch >= 4)
         {
             uint32 first = ((const uint32 *)source)[0];
@@ -467,6 +575,9 @@ namespace utf8
             while (cch-- > 0)
             {
                 dest = Encode<countBytesOnly>(*source++, dest, bufferEnd);
+#ifdef CODEX_SIMD
+                if (cch >= SimdBlockSize && *source < 0x80) goto LFastPath;
+#endif
                 if (ShouldFastPath(dest, source)) goto LFastPath;
             }
         }
@@ -479,6 +590,9 @@ namespace utf8
                 // EncodeTrueUtf8 will consume the low surrogate code unit too by decrementing cch
                 // and incrementing source
                 dest = EncodeTrueUtf8<countBytesOnly>(*source++, &source, &cch, dest, bufferEnd);
+#ifdef CODEX_SIMD
+                if (cch >= SimdBlockSize && *source < 0x80) goto LFastPath;
+#endif
                 if (ShouldFastPath(dest, source)) goto LFastPath;
             }
         }
@@ -535,9 +649,17 @@ namespace utf8
         LPCUTF8 pchEndMinus4 = pch + (cbLength - 4);
         charcount_t i = cchIndex - cchStartIndex;
 
+LFastPath:
+#ifdef CODEX_SIMD
+        while (i > SimdBlockSize && static_cast<size_t>(pchEnd - pchCurrent) >= SimdBlockSize && IsAsciiBlock(pchCurrent))
+        {
+            pchCurrent += SimdBlockSize;
+            i -= SimdBlockSize;
+        }
+#endif
         // Avoid using a reinterpret_cast to start a misaligned read.
         if (!IsAligned(pchCurrent)) goto LSlowPath;
-LFastPath:
+
         // Skip 4 bytes at a time.
         while (pchCurrent < pchEndMinus4 && i > 4)
         {
@@ -556,6 +678,9 @@ namespace utf8
             Decode(pchCurrent, pchEnd, localOptions);
             i--;
 
+#ifdef CODEX_SIMD
+            if (i > SimdBlockSize && static_cast<size_t>(pchEnd - pchCurrent) >= SimdBlockSize && *pchCurrent < 0x80) goto LFastPath;
+#endif
             // Try to return to the fast path avoiding misaligned reads.
             if (i > 4 && IsAligned(pchCurrent)) goto LFastPath;
         }
@@ -571,10 +696,17 @@ namespace utf8
         LPCUTF8 pchEndMinus4 = pch + (cbIndex - 4);
         charcount_t i = 0;
 
+LFastPath:
+#ifdef CODEX_SIMD
+        while (static_cast<size_t>(pchEnd - pchCurrent) >= SimdBlockSize && IsAsciiBlock(pchCurrent))
+        {
+            pchCurrent += SimdBlockSize;
+            i += SimdBlockSize;
+        }
+#endif
         // Avoid using a reinterpret_cast to start a misaligned read.
         if (!IsAligned(pchCurrent)) goto LSlowPath;
 
-LFastPath:
         // Skip 4 bytes at a time.
         while (pchCurrent < pchEndMinus4)
         {
@@ -595,6 +727,9 @@ namespace utf8
             if (s == pchCurrent) break;
             i++;
 
+#ifdef CODEX_SIMD
+            if (static_cast<size_t>(pchEnd - pchCurrent) >= SimdBlockSize && *pchCurrent < 0x80) goto LFastPath;
+#endif
             // Try to return to the fast path avoiding misaligned reads.
             if (IsAligned(pchCurrent)) goto LFastPath;
         }
@@ -102,6 +102,8 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 // Data Structures 2
 
 #include "DataStructures/QuickSort.h"
+#include "DataStructures/TimSort.h"
+#include "DataStructures/RadixSort.h"
 #include "DataStructures/StringBuilder.h"
 #include "DataStructures/WeakReferenceDictionary.h"
 #include "DataStructures/LeafValueDictionary.h"
@@ -0,0 +1,38 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JsUtil
+{
+    // Picks the job to process next from a queue of jobs starting with firstJob (see BackgroundJobProcessor::UnlinkNextJob).
+    //
+    // Prioritized jobs are always at the front of the queue and are processed in queue order. Otherwise, a job of the job manager
+    // that was served least recently is picked, so that a job manager that queues a lot of jobs cannot starve the others, and of
+    // that job manager's jobs, the hottest one. Ties go to the job that was queued first.
+    //
+    // TJob needs Next(), IsPrioritized() and Hotness(). getServiceOrder(job) returns when a job of the job's manager was last
+    // picked for processing, lower values having been served less recently.
+    template<class TJob, class TGetServiceOrder>
+    TJob *PickRankedJob(TJob *const firstJob, const TGetServiceOrder getServiceOrder)
+    {
+        TJob *nextJob = firstJob;
+        if(!nextJob || nextJob->IsPrioritized())
+        {
+            return nextJob;
+        }
+
+        for(TJob *job = nextJob->Next(); job; job = job->Next())
+        {
+            const auto jobServiceOrder = getServiceOrder(job);
+            const auto nextJobServiceOrder = getServiceOrder(nextJob);
+            if(jobServiceOrder < nextJobServiceOrder ||
+                (jobServiceOrder == nextJobServiceOrder && job->Hotness() > nextJob->Hotness()))
+            {
+                nextJob = job;
+            }
+        }
+        return nextJob;
+    }
+}
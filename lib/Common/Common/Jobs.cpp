@@ -25,6 +25,7 @@
 #include "Common/ThreadService.h"
 #include "Common/Jobs.h"
 #include "Common/Jobs.inl"
+#include "Common/JobRanking.h"
 #include "Core/CommonMinMax.h"
 #include "Memory/RecyclerWriteBarrierManager.h"
 
@@ -34,14 +35,15 @@ namespace JsUtil
     // Job
     // -------------------------------------------------------------------------------------------------------------------------
 
-    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical)
+    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical), isPrioritized(false), hotness(0)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
     {
     }
 
-    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical)
+    Job::Job(JobManager *const manager, const bool isCritical)
+        : manager(manager), isCritical(isCritical), isPrioritized(false), hotness(0)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
@@ -59,18 +61,38 @@ namespace JsUtil
         return isCritical;
     }
 
+    bool Job::IsPrioritized() const
+    {
+        return isPrioritized;
+    }
+
+    void Job::SetIsPrioritized(const bool isPrioritized)
+    {
+        this->isPrioritized = isPrioritized;
+    }
+
+    unsigned int Job::Hotness() const
+    {
+        return hotness;
+    }
+
+    void Job::SetHotness(const unsigned int hotness)
+    {
+        this->hotness = hotness;
+    }
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobManager
     // -------------------------------------------------------------------------------------------------------------------------
 
     JobManager::JobManager(JobProcessor *const processor)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(false)
+        : processor(processor), numJobsAddedToProcessor(0), lastServiceOrder(0), isWaitable(false)
     {
         Assert(processor);
     }
 
     JobManager::JobManager(JobProcessor *const processor, const bool isWaitable)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(isWaitable)
+        : processor(processor), numJobsAddedToProcessor(0), lastServiceOrder(0), isWaitable(isWaitable)
     {
         Assert(processor);
     }
@@ -80,6 +102,11 @@ namespace JsUtil
         return processor;
     }
 
+    unsigned int JobManager::NumJobsAddedToProcessor() const
+    {
+        return numJobsAddedToProcessor;
+    }
+
     void JobManager::LastJobProcessed()
     {
     }
@@ -278,6 +305,7 @@ namespace JsUtil
         {
             if (job->Manager() == manager)
             {
+                job->SetIsPrioritized(true);
                 if (!lastJob)
                     lastJob = job;
             }
@@ -310,6 +338,7 @@ namespace JsUtil
             Js::Throw::OutOfMemory();  // Overflow: job counts we use are int32's.
         ++job->Manager()->numJobsAddedToProcessor;
 
+        job->SetIsPrioritized(prioritize);
         if (prioritize)
             jobs.LinkToBeginning(job);
         else
@@ -614,7 +643,13 @@ namespace JsUtil
         threadId(GetCurrentThreadContextId()),
         threadService(threadService),
         threadCount(0),
-        maxThreadCount(0)
+        maxThreadCount(0),
+        serviceOrder(0),
+        activeThreadLimit(UINT_MAX),
+        isSamplingCpuTimes(FALSE),
+        lastCpuSampleTickCount(0),
+        lastIdleCpuTime(0),
+        lastTotalCpuTime(0)
     {
         if (!threadService->HasCallback())
         {
@@ -761,7 +796,8 @@ namespace JsUtil
     {
         Assert(criticalSection.IsLocked());
 
-        if(NumberOfThreadsWaitingForJobs ())
+        const uint threadsWaitingForJobs = NumberOfThreadsWaitingForJobs();
+        if(threadsWaitingForJobs && this->threadCount - threadsWaitingForJobs < this->activeThreadLimit)
         {
             if (threadService->HasCallback())
             {
@@ -790,6 +826,91 @@ namespace JsUtil
         }
     }
 
+    bool BackgroundJobProcessor::SampleIdleProcessorCount(uint *const idleProcessorCount)
+    {
+        // Called by a thread after it processed a job, outside the lock. Reading the system's processor times may be slow (it
+        // reads /proc/stat on Linux), so it must not hold up threads that are adding or picking jobs.
+
+        Assert(idleProcessorCount);
+
+        if(this->threadCount <= 1 || CONFIG_FLAG(ForceMaxJitThreadCount) || !CONFIG_FLAG_RELEASE(AdaptiveJitThreadCount))
+        {
+            return false;
+        }
+
+        // The processor times are only sampled every so often, and by one thread at a time. The sample fields are only
+        // accessed by the thread that is sampling.
+        const DWORD CpuSampleIntervalMilliseconds = 100;
+        const DWORD tickCount = ::GetTickCount();
+        if(tickCount - this->lastCpuSampleTickCount < CpuSampleIntervalMilliseconds ||
+            InterlockedCompareExchange(&this->isSamplingCpuTimes, TRUE, FALSE) != FALSE)
+        {
+            return false;
+        }
+
+        bool sampled = false;
+        ULONGLONG idleCpuTime;
+        ULONGLONG totalCpuTime;
+        if(PlatformAgnostic::SystemInfo::GetSystemCpuTimes(&idleCpuTime, &totalCpuTime))
+        {
+            if(this->lastTotalCpuTime != 0 && totalCpuTime > this->lastTotalCpuTime && idleCpuTime >= this->lastIdleCpuTime)
+            {
+                const uint64 idleCpuTimeDelta = idleCpuTime - this->lastIdleCpuTime;
+                const uint64 totalCpuTimeDelta = totalCpuTime - this->lastTotalCpuTime;
+                const uint64 processorCount = AutoSystemInfo::Data.GetNumberOfLogicalProcessors();
+                *idleProcessorCount = static_cast<uint>(
+                    min(processorCount, (idleCpuTimeDelta * processorCount + totalCpuTimeDelta / 2) / totalCpuTimeDelta));
+                sampled = true;
+            }
+
+            this->lastIdleCpuTime = idleCpuTime;
+            this->lastTotalCpuTime = totalCpuTime;
+        }
+        // else, not supported on this platform. Try again after the interval rather than on every job.
+
+        this->lastCpuSampleTickCount = tickCount;
+        InterlockedExchange(&this->isSamplingCpuTimes, FALSE);
+        return sampled;
+    }
+
+    void BackgroundJobProcessor::UpdateActiveThreadLimit(const uint idleProcessorCount)
+    {
+        Assert(criticalSection.IsLocked());
+
+        // Threads that are currently processing jobs keep the processors they are running on, and additional threads may be
+        // woken up for as many processors as are idle. At least one thread is always allowed to process jobs.
+        const uint busyThreadCount = this->threadCount - NumberOfThreadsWaitingForJobs();
+        this->activeThreadLimit = max(1u, min(this->threadCount, busyThreadCount + idleProcessorCount));
+    }
+
+    bool BackgroundJobProcessor::HasTooManyActiveThreads()
+    {
+        // Called by a thread that is about to pick a job, before it goes back to waiting for jobs
+
+        Assert(criticalSection.IsLocked());
+
+        return this->threadCount - NumberOfThreadsWaitingForJobs() > this->activeThreadLimit;
+    }
+
+    Job * BackgroundJobProcessor::UnlinkNextJob()
+    {
+        Assert(criticalSection.IsLocked());
+
+        // Critical jobs that are left in the queue after Close are processed in queue order
+        Job *const nextJob =
+            IsClosed() || !CONFIG_FLAG_RELEASE(RankedJitQueue)
+                ? jobs.Head()
+                : PickRankedJob(jobs.Head(), [](const Job *const job) { return job->Manager()->lastServiceOrder; });
+        if(!nextJob)
+        {
+            return nullptr;
+        }
+
+        jobs.Unlink(nextJob);
+        nextJob->Manager()->lastServiceOrder = ++this->serviceOrder;
+        return nextJob;
+    }
+
     Job * BackgroundJobProcessor::GetCurrentJobOfManager(JobManager *const manager)
     {
         Assert(criticalSection.IsLocked());
@@ -1043,11 +1164,12 @@ namespace JsUtil
             criticalSection.Enter();
             while (!IsClosed() || (jobs.Head() && jobs.Head()->IsCritical()))
             {
-                Job *job = jobs.UnlinkFromBeginning();
+                // Leave the remaining jobs to the other threads when there are not enough idle processors for this thread
+                Job *job = !IsClosed() && HasTooManyActiveThreads() ? nullptr : UnlinkNextJob();
 
                 if(!job)
                 {
-                    // No jobs in queue, wait for one
+                    // No jobs in queue, or too many active threads, wait for a new job
 
                     Assert(!IsClosed());
                     Assert(!threadData->isWaitingForJobs);
@@ -1077,7 +1199,14 @@ namespace JsUtil
 
                 const bool succeeded = Process(job, threadData);
 
+                uint idleProcessorCount;
+                const bool sampledIdleProcessorCount = SampleIdleProcessorCount(&idleProcessorCount);
+
                 criticalSection.Enter();
+                if(sampledIdleProcessorCount)
+                {
+                    UpdateActiveThreadLimit(idleProcessorCount);
+                }
                 threadData->currentJob = 0;
                 JobManager *const manager = job->Manager();
                 JobProcessed(manager, job, succeeded); // the job may be deleted during this and should not be used afterwards
@@ -44,6 +44,14 @@ namespace JsUtil
         // JobManager::JobProcessed(succeeded = false).
         const bool isCritical;
 
+        // Set when the job was explicitly moved or added to the front of the queue. Prioritized jobs are processed in queue
+        // order, ahead of jobs that are ranked by hotness.
+        bool isPrioritized;
+
+        // How hot the code associated with the job is, as determined by the job manager when the job is queued. The background
+        // job processor processes hotter jobs of a job manager first (see BackgroundJobProcessor::UnlinkNextJob).
+        unsigned int hotness;
+
     private:
         Job(const bool isCritical = false);
     public:
@@ -65,6 +73,17 @@ namespace JsUtil
     public:
         JobManager *Manager() const;
         bool IsCritical() const;
+        bool IsPrioritized() const;
+        unsigned int Hotness() const;
+        void SetHotness(const unsigned int hotness);
+
+    private:
+        void SetIsPrioritized(const bool isPrioritized);
+
+        friend JobProcessor;
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+        friend BackgroundJobProcessor;
+#endif
     };
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -87,6 +106,10 @@ namespace JsUtil
         JobProcessor *const processor;
         unsigned int numJobsAddedToProcessor;
 
+        // Value of the job processor's service counter when a job of this manager was last picked for processing. Used to
+        // pick jobs from job managers in round-robin order so that one job manager cannot starve the others.
+        uint64 lastServiceOrder;
+
         // Only job managers derived from WaitableJobManager support waiting for a job or the job manager's queued jobs
         const bool isWaitable;
 
@@ -98,6 +121,9 @@ namespace JsUtil
     public:
         JobProcessor *Processor() const;
 
+        // Must be called from inside the lock
+        unsigned int NumJobsAddedToProcessor() const;
+
     protected:
         // Called by the job processor (outside the lock) to process a job. A job manager may choose to return false to indicate
         // a failure. Throwing OutOfMemoryException or OperationAbortedException also indicate a processing failure.
@@ -457,6 +483,17 @@ namespace JsUtil
         unsigned int maxThreadCount;
         ParallelThreadData **parallelThreadData;
 
+        // Incremented each time a job is picked for processing, see JobManager::lastServiceOrder
+        uint64 serviceOrder;
+
+        // Number of threads that may process jobs concurrently, adjusted to the number of idle processors in the system. See
+        // SampleIdleProcessorCount and UpdateActiveThreadLimit.
+        unsigned int activeThreadLimit;
+        volatile LONG isSamplingCpuTimes;
+        volatile DWORD lastCpuSampleTickCount;
+        uint64 lastIdleCpuTime;
+        uint64 lastTotalCpuTime;
+
 #if DBG_DUMP
         static  char16 const * const  DebugThreadNames[16];
 #endif
@@ -476,6 +513,10 @@ namespace JsUtil
         bool AreAllThreadsWaitingForJobs();
         uint NumberOfThreadsWaitingForJobs ();
         Job* GetCurrentJobOfManager(JobManager *const manager);
+        Job* UnlinkNextJob();
+        bool SampleIdleProcessorCount(uint *const idleProcessorCount);
+        void UpdateActiveThreadLimit(const uint idleProcessorCount);
+        bool HasTooManyActiveThreads();
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
 
         void InitializeThreadCount();
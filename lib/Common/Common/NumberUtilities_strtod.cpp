@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #include "CommonCommonPch.h"
 #include "DataStructures/BigInt.h"
+#include "Common/NumberUtilities_powers.h"
 
 namespace Js
 {
@@ -889,6 +890,118 @@ static double AdjustDbl(double dbl, const EncodedChar *prgch, int32 cch, int32 l
 }
 
 
+/***************************************************************************
+Fast string to double for up to 19 significant digits (Daniel Lemire, "Number
+Parsing at a Gigabyte per Second", Software: Practice and Experience, 2021).
+
+luMan * 10^lwExp is multiplied by a 128 bit approximation of 5^lwExp; the
+truncated product is precise enough to round correctly unless it lies next to
+a halfway point, which the caller resolves with big numbers.
+***************************************************************************/
+static inline int CbitZeroLeft64(uint64 lu)
+{
+    Assert(lu != 0);
+    uint32 luHi = (uint32)(lu >> 32);
+    return 0 != luHi ? Js::NumberUtilities::CbitZeroLeft(luHi) : 32 + Js::NumberUtilities::CbitZeroLeft((uint32)lu);
+}
+
+static inline void SetDblBits(double *pdbl, uint64 lu)
+{
+    Js::NumberUtilities::LuHiDbl(*pdbl) = (uint32)(lu >> 32);
+    Js::NumberUtilities::LuLoDbl(*pdbl) = (uint32)lu;
+}
+
+// Full 64 x 64 bit product. Returns the high 64 bits and stores the low 64 bits in *pluLo.
+static inline uint64 MulLu64(uint64 lu1, uint64 lu2, uint64 *pluLo)
+{
+    uint64 luLL = (lu1 & 0xFFFFFFFF) * (lu2 & 0xFFFFFFFF);
+    uint64 luLH = (lu1 & 0xFFFFFFFF) * (lu2 >> 32);
+    uint64 luHL = (lu1 >> 32) * (lu2 & 0xFFFFFFFF);
+    uint64 luHH = (lu1 >> 32) * (lu2 >> 32);
+    uint64 luMid = (luLL >> 32) + (luLH & 0xFFFFFFFF) + (luHL & 0xFFFFFFFF);
+
+    *pluLo = (luMid << 32) | (luLL & 0xFFFFFFFF);
+    return luHH + (luLH >> 32) + (luHL >> 32) + (luMid >> 32);
+}
+
+_Success_(return)
+static BOOL FEiselLemire(uint64 luMan, int32 lwExp, _Out_ double *pdbl)
+{
+    Assert(luMan != 0);
+    Assert(lwExp >= kwPowersOfFiveMinExp10 && lwExp <= kwPowersOfFiveMaxExp10);
+
+    // Normalize the mantissa and multiply it with the high half of 5^lwExp.
+    const int cbitZero = CbitZeroLeft64(luMan);
+    luMan <<= cbitZero;
+
+    const uint64 *pluPow = g_rgluPowersOfFive[lwExp - kwPowersOfFiveMinExp10];
+    uint64 luLo;
+    uint64 luHi = MulLu64(luMan, pluPow[0], &luLo);
+
+    // If the bits below the 55 we keep are all ones, the low half of 5^lwExp may carry into them.
+    if ((luHi & 0x1FF) == 0x1FF)
+    {
+        uint64 luLoLo;
+        uint64 luLoHi = MulLu64(luMan, pluPow[1], &luLoLo);
+        luLo += luLoHi;
+        if (luLoHi > luLo)
+            luHi++;
+
+        // The product is still inexact. Leave it to the slow path.
+        if (luLo == 0xFFFFFFFFFFFFFFFF && (lwExp < -27 || lwExp > 55))
+            return FALSE;
+    }
+
+    // Keep 54 bits (one more than the mantissa for rounding) and compute the biased exponent.
+    // 217706 / 2^16 approximates log2(10).
+    const int iUpper = (int)(luHi >> 63);
+    const int cbitShift = iUpper + 9;
+    uint64 luRes = luHi >> cbitShift;
+    int32 wExp2 = ((217706 * lwExp) >> 16) + 63 + iUpper - cbitZero + 1023;
+
+    if (wExp2 <= 0)
+    {
+        // Denormal or zero.
+        if (-wExp2 + 1 >= 64)
+        {
+            *pdbl = 0;
+            return TRUE;
+        }
+        luRes >>= -wExp2 + 1;
+        luRes += (luRes & 1);
+        luRes >>= 1;
+        // Rounding may have carried into the smallest normal.
+        wExp2 = (luRes < (1ull << 52)) ? 0 : 1;
+        luRes &= ~(1ull << 52);
+        SetDblBits(pdbl, ((uint64)wExp2 << 52) | luRes);
+        return TRUE;
+    }
+
+    // Exactly halfway between two doubles: round to even. This can only happen for small exponents,
+    // when the product has no bits below the ones we kept.
+    if (luLo <= 1 && lwExp >= -4 && lwExp <= 23 && (luRes & 3) == 1 && (luRes << cbitShift) == luHi)
+        luRes &= ~1ull;
+
+    luRes += (luRes & 1);
+    luRes >>= 1;
+    if (luRes >= (2ull << 52))
+    {
+        luRes = (1ull << 52);
+        wExp2++;
+    }
+    luRes &= ~(1ull << 52);
+
+    if (wExp2 >= 0x7FF)
+    {
+        // Overflow to infinity.
+        SetDblBits(pdbl, 0x7FF0000000000000ull);
+        return TRUE;
+    }
+
+    SetDblBits(pdbl, ((uint64)wExp2 << 52) | luRes);
+    return TRUE;
+}
+
 /***************************************************************************
 String to Double.
 ***************************************************************************/
@@ -1173,6 +1286,23 @@ double Js::NumberUtilities::StrToDbl( const EncodedChar *psz, const EncodedChar
 #endif //!DBG
     }
 
+    // Up to 19 digits fit in 64 bits, which is enough for the Eisel-Lemire algorithm.
+    if (cchDig <= 19 && lwExp >= kwPowersOfFiveMinExp10 && lwExp <= kwPowersOfFiveMaxExp10)
+    {
+        uint64 luMan = 0;
+        for (pch = pchMinDig; pch < pchLimDig; pch++)
+        {
+            if (*pch != '.')
+            {
+                Assert(Js::NumberUtilities::IsDigit(*pch));
+                luMan = luMan * 10 + (*pch - '0');
+            }
+        }
+
+        if (FEiselLemire(luMan, lwExp, &dbl))
+            goto LDone;
+    }
+
     lwExp += cchDig;
     if (lwExp >= klwMaxExp10)
     {
@@ -1880,6 +2010,203 @@ static BOOL FDblToRgbFast(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb
 }
 
 
+/***************************************************************************
+Shortest digits after Grisu3 (Florian Loitsch, "Printing Floating-Point Numbers
+Quickly and Accurately with Integers", PLDI 2010).
+
+Works with 64 bit integers only and produces the shortest digits that convert
+back to dbl. Unlike Grisu3 it does not pick the closest last digit: it uses
+the rule of FDblToRgbFast instead (the upper digit if the bounds differ by one
+in the last digit, otherwise the one halfway between them rounded up), so that
+the output matches the big number code digit for digit. It gives up whenever
+it cannot be certain of the last digit of either bound; the caller then falls
+back to FDblToRgbFast and FDblToRgbPrecise.
+***************************************************************************/
+struct DIYFP
+{
+    uint64 luSig;
+    int wExp;
+};
+
+// Rounded high half of the product.
+static inline DIYFP DiyFpMul(DIYFP x, DIYFP y)
+{
+    uint64 luLo;
+    uint64 luHi = MulLu64(x.luSig, y.luSig, &luLo);
+    DIYFP res;
+    res.luSig = luHi + (luLo >> 63);
+    res.wExp = x.wExp + y.wExp + 64;
+    return res;
+}
+
+static inline DIYFP DiyFpNormalize(DIYFP x)
+{
+    Assert(x.luSig != 0);
+    const int cbit = CbitZeroLeft64(x.luSig);
+    x.luSig <<= cbit;
+    x.wExp -= cbit;
+    return x;
+}
+
+static const uint32 g_rgluTens[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Generates the digits of the upper bound into prgb, up to and including the first one in which the
+// bounds numLow and numHigh differ, then picks the last digit.
+_Success_(return)
+static BOOL FGrisuDigitGen(DIYFP numLow, DIYFP numHigh, __out_ecount(kcbMaxRgb) byte *prgb, int *pcb, int *pwKappa)
+{
+    Assert(numLow.wExp == numHigh.wExp);
+    Assert(numLow.luSig < numHigh.luSig);
+    Assert(numHigh.wExp >= -60 && numHigh.wExp <= -32);
+
+    // The boundaries are imprecise by one unit, widen them to get an interval that
+    // certainly contains both of them.
+    uint64 luUnit = 1;
+    const uint64 luTooHigh = numHigh.luSig + luUnit;
+    uint64 luUnsafe = luTooHigh - (numLow.luSig - luUnit);
+    const int cbitOne = -numHigh.wExp;
+    const uint64 luOne = 1ull << cbitOne;
+    uint32 luIntegrals = (uint32)(luTooHigh >> cbitOne);
+    uint64 luFractionals = luTooHigh & (luOne - 1);
+
+    // Find the biggest power of ten that is at most luIntegrals.
+    int wKappa = ((64 - cbitOne + 1) * 1233 >> 12) + 1;
+    Assert(wKappa > 0 && wKappa <= 10);
+    if (luIntegrals < g_rgluTens[wKappa - 1])
+        wKappa--;
+    Assert(wKappa > 0);
+    uint32 luDivisor = g_rgluTens[wKappa - 1];
+
+    int cb = 0;
+    uint64 luRest;
+    uint64 luTenKappa;
+    for (;;)
+    {
+        if (wKappa > 0)
+        {
+            prgb[cb++] = (byte)(luIntegrals / luDivisor);
+            luIntegrals %= luDivisor;
+            wKappa--;
+            luRest = ((uint64)luIntegrals << cbitOne) + luFractionals;
+            if (luRest < luUnsafe)
+            {
+                luTenKappa = (uint64)luDivisor << cbitOne;
+                break;
+            }
+            luDivisor /= 10;
+        }
+        else
+        {
+            luFractionals *= 10;
+            luUnit *= 10;
+            luUnsafe *= 10;
+            prgb[cb++] = (byte)(luFractionals >> cbitOne);
+            luFractionals &= luOne - 1;
+            wKappa--;
+            if (luFractionals < luUnsafe)
+            {
+                luRest = luFractionals;
+                luTenKappa = luOne;
+                break;
+            }
+        }
+        if (cb >= kcbMaxRgb)
+            return FALSE;
+    }
+
+    // The exact upper bound lies in (luTooHigh - 2 * luUnit, luTooHigh) and the exact lower bound
+    // lies in (luTooHigh - luUnsafe, luTooHigh - luUnsafe + 2 * luUnit). The last digit is the one
+    // of the upper bound only if the upper bound is certainly not below the digits.
+    if (luRest < 2 * luUnit)
+        return FALSE;
+
+    // Find how many steps of the last digit it takes to get below the lower bound; that gives
+    // the last digit of the lower bound. Give up unless it is certain.
+    const byte bHigh = prgb[cb - 1];
+    uint64 cStep = (luUnsafe - luRest) / luTenKappa;
+    if (cStep * luTenKappa < luUnsafe - luRest)
+        cStep++;
+    if (cStep == 0 || cStep > bHigh || luUnsafe - (luRest + (cStep - 1) * luTenKappa) < 2 * luUnit)
+        return FALSE;
+
+    // Pick the digit the way FDblToRgbFast does: the upper one if the bounds differ by one in the
+    // last digit, otherwise the one halfway between them rounded up.
+    prgb[cb - 1] = bHigh - (byte)(cStep / 2);
+    Assert(prgb[cb - 1] != 0);
+
+    *pcb = cb;
+    *pwKappa = wKappa;
+    return TRUE;
+}
+
+_Success_(return)
+static BOOL FDblToRgbGrisu(double dbl, __out_ecount(kcbMaxRgb) byte *prgb, int *pwExp10, byte **ppbLim)
+{
+    // Caller should take care of 0, negative and non-finite values.
+    Assert(Js::NumberUtilities::IsFinite(dbl));
+    Assert(0 < dbl);
+
+    const uint64 luBits = ((uint64)Js::NumberUtilities::LuHiDbl(dbl) << 32) | Js::NumberUtilities::LuLoDbl(dbl);
+    const int wBiasedExp = (int)(luBits >> 52);
+    DIYFP num;
+    num.luSig = luBits & 0x000FFFFFFFFFFFFFull;
+    if (wBiasedExp != 0)
+    {
+        num.luSig |= 0x0010000000000000ull;
+        num.wExp = wBiasedExp - 1075;
+    }
+    else
+    {
+        num.wExp = -1074;
+    }
+
+    // The boundaries halfway to the neighboring doubles, the same ones FDblToRgbFast uses. The
+    // lower one is closer for normalized powers of two.
+    DIYFP numHigh;
+    numHigh.luSig = (num.luSig << 1) + 1;
+    numHigh.wExp = num.wExp - 1;
+    numHigh = DiyFpNormalize(numHigh);
+
+    DIYFP numLow;
+    if ((luBits & 0x000FFFFFFFFFFFFFull) == 0 && wBiasedExp != 0)
+    {
+        numLow.luSig = (num.luSig << 2) - 1;
+        numLow.wExp = num.wExp - 2;
+    }
+    else
+    {
+        numLow.luSig = (num.luSig << 1) - 1;
+        numLow.wExp = num.wExp - 1;
+    }
+    numLow.luSig <<= numLow.wExp - numHigh.wExp;
+    numLow.wExp = numHigh.wExp;
+
+    // Pick the cached power of ten that brings the binary exponent of the products into [-60, -32],
+    // so that their integral parts fit in 32 bits.
+    const int wExpMin = -60 - (numHigh.wExp + 64);
+    const int k = (int)ceil((wExpMin + 63) * 0.30102999566398114);
+    const int iPow = (-kwCachedPowersMinExp10 + k - 1) / kwCachedPowersStepExp10 + 1;
+    Assert(iPow >= 0 && iPow < _countof(g_rgcachedPowers));
+    const CachedPower &power = g_rgcachedPowers[iPow];
+
+    DIYFP numPow;
+    numPow.luSig = power.luSig;
+    numPow.wExp = power.wExp2;
+
+    int cb;
+    int wKappa;
+    if (!FGrisuDigitGen(DiyFpMul(numLow, numPow), DiyFpMul(numHigh, numPow), prgb, &cb, &wKappa))
+        return FALSE;
+
+    // The digits are those of dbl * 10^power.wExp10, with the last one worth 10^wKappa.
+    *pwExp10 = cb + wKappa - power.wExp10;
+    *ppbLim = prgb + cb;
+    return TRUE;
+}
+
 static BOOL FormatDigits(_In_reads_(pbLim - pbSrc) byte *pbSrc, byte *pbLim, int wExp10, _Out_writes_(cchDst) OLECHAR *pchDst, int cchDst)
 {
     AssertArrMem(pbSrc, pbLim - pbSrc);
@@ -2313,7 +2640,8 @@ int Js::NumberUtilities::FDblToStr(double dbl, Js::NumberUtilities::FormatType f
         }
 
         // in case we restrict the number of digits, do not push for a higher bound
-        if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim, nDigits) &&
+        if (!(nDigits == -1 && FDblToRgbGrisu(dbl, rgb, &wExp10, &pbLim)) &&
+            !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim, nDigits) &&
             !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim, nDigits != -1 ? 0 : 1))
         {
             AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
@@ -2449,7 +2777,8 @@ BOOL Js::NumberUtilities::FNonZeroFiniteDblToStr(double dbl, __out_ecount(cchDst
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
 #endif //DBG
 
-    if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
+    if (!FDblToRgbGrisu(dbl, rgb, &wExp10, &pbLim) &&
+        !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
         !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
     {
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
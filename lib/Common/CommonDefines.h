@@ -213,13 +213,14 @@
 #if ENABLE_CONCURRENT_GC
 // Write-barrier refers to a software write barrier implementation using a card table.
 // Write watch refers to a hardware backed write-watch feature supported by the Windows memory manager.
+// (On Linux the PAL can emulate it with userfaultfd write-protect when built with ENABLE_WRITE_WATCH.)
 // Both are used for detecting changes to memory for concurrent and partial GC.
 // RECYCLER_WRITE_BARRIER controls the former, RECYCLER_WRITE_WATCH controls the latter.
 // GLOBAL_ENABLE_WRITE_BARRIER controls the smart pointer wrapper at compile time, every Field annotation on the
 // recycler allocated class will take effect if GLOBAL_ENABLE_WRITE_BARRIER is 1, otherwise only the class declared
 // with FieldWithBarrier annotations use the WriteBarrierPtr<>, see WriteBarrierMacros.h and RecyclerPointers.h for detail
 #define RECYCLER_WRITE_BARRIER                      // Write Barrier support
-#ifdef _WIN32
+#if defined(_WIN32) || ENABLE_WRITE_WATCH
 #define RECYCLER_WRITE_WATCH                        // Support hardware write watch
 #endif
 
@@ -279,10 +280,8 @@
 #endif
 #endif
 
-// Only enable background parser in debug build.
-#ifdef DBG
+// Background parser shares the JIT job processor threads; it is off at runtime unless -ParallelParse is set
 #define ENABLE_BACKGROUND_PARSING 1
-#endif
 
 #endif
 
@@ -290,16 +289,26 @@
 #ifdef _WIN32
 #define ENABLE_OOP_NATIVE_CODEGEN 1     // Out of process JIT
 #endif
+// xplat-todo: out of process JIT needs a transport other than the MIDL RPC stubs JITServer/JITClient are
+// generated from (ChakraJIT.idl), dual mapped code pages in place of SectionAllocWrapper and
+// PreReservedSectionAllocWrapper, and JIT server process lifetime management in JITManager.
 
 // ToDo (SaAgarwa): Disable VirtualTypedArray on ARM64 till we make sure it works correctly
 #if _WIN64 && !defined(_M_ARM64)
 #define ENABLE_FAST_ARRAYBUFFER 1
+#elif defined(__linux__) && defined(_M_X64) && ENABLE_VIRTUAL_ARRAYBUFFER
+// xplat: out-of-bounds faults are recovered through the PAL access violation filter
+#define ENABLE_FAST_ARRAYBUFFER 1
 #endif
 #endif
 
 // Other features
 // #define CHAKRA_CORE_DOWN_COMPAT 1
 
+#if ENABLE_PROFILE_INFO
+#define DYNAMIC_PROFILE_CACHE       // File backed dynamic profile cache the host sets up with JsSetRuntimeProfileCacheDirectory
+#endif
+
 // todo:: Enable vectorcall on NTBUILD. OS#13609380
 #if defined(_WIN32) && !defined(NTBUILD) && defined(_M_IX86)
 #define VECTORCALL __vectorcall
@@ -442,6 +451,11 @@
 #endif
 #endif // ENABLE_DEBUG_CONFIG_OPTIONS
 
+// Dynamic profile (de)serialization, shared by DynamicProfileStorage and the profile cache
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(DYNAMIC_PROFILE_CACHE)
+#define DYNAMIC_PROFILE_SERIALIZATION
+#endif
+
 ////////
 //Time Travel flags
 //Include TTD code in the build when building for Chakra (except NT/Edge) or for debug/test builds
@@ -86,5 +86,6 @@ using namespace Memory;
 #include "Memory/VirtualAllocWrapper.h"
 #include "Memory/MemoryTracking.h"
 #include "Memory/AllocationPolicyManager.h"
+#include "Memory/SignalSafeRangeTable.h"
 #include "Memory/PageAllocator.h"
 #include "Memory/ArenaAllocator.h"
@@ -173,6 +173,7 @@ PHASE(All)
                     PHASE(FixedFieldGuardCheck)
                     PHASE(FixedNewObj)
                         PHASE(JitAllocNewObj)
+                            PHASE(Pretenure)
                     PHASE(FixedCtorInlining)
                     PHASE(FixedCtorCalls)
                     PHASE(FixedScriptMethodInlining)
@@ -184,6 +185,7 @@ PHASE(All)
                 PHASE(MemOp)
                     PHASE(MemSet)
                     PHASE(MemCopy)
+                PHASE(ScalarReplacement)
                 PHASE(IncrementalBailout)
             PHASE(DeadStore)
                 PHASE(ReverseCopyProp)
@@ -274,6 +276,7 @@ PHASE(All)
                 PHASE(BackgroundFinishMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
+                PHASE(ParallelMarkSteal)
             PHASE(PartialCollect)
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
@@ -299,6 +302,7 @@ PHASE(All)
         PHASE(BailOut)
         PHASE(RegexQc)
         PHASE(RegexOptBT)
+        PHASE(RegexTierUp)
         PHASE(InlineCache)
         PHASE(PolymorphicInlineCache)
         PHASE(MissingPropertyCache)
@@ -420,6 +424,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold (32)
 #define DEFAULT_CONFIG_Prejit               (false)
 #define DEFAULT_CONFIG_DeferNested          (true)
+#define DEFAULT_CONFIG_ParallelParse        (false)
 #define DEFAULT_CONFIG_DeferTopLevelTillFirstCall (true)
 #define DEFAULT_CONFIG_DirectCallTelemetryStats (false)
 #define DEFAULT_CONFIG_errorStackTrace      (true)
@@ -473,6 +478,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_StringCacheMissPenalty (10)
 #define DEFAULT_CONFIG_StringCacheMissThreshold (-100)
 #define DEFAULT_CONFIG_StringCacheMissReset (-5000)
+#define DEFAULT_CONFIG_OneByteStrings (true)
+#define DEFAULT_CONFIG_MinOneByteStringLength (16)
 
 #define DEFAULT_CONFIG_CloneInlinedPolymorphicCaches (true)
 #define DEFAULT_CONFIG_HighPrecisionDate    (false)
@@ -491,6 +498,7 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_MaxJitThreadCount        (2)
 #define DEFAULT_CONFIG_ForceMaxJitThreadCount   (false)
+#define DEFAULT_CONFIG_AdaptiveJitThreadCount   (true)
 
 #ifdef RECYCLER_PAGE_HEAP
 #define DEFAULT_CONFIG_PageHeap             ((Js::Number) PageHeapMode::PageHeapModeOff)
@@ -518,6 +526,12 @@ PHASE(All)
 #define DEFAULT_CONFIG_RegexBytecodeDebug   (false)
 #define DEFAULT_CONFIG_RegexOptimize        (true)
 #define DEFAULT_CONFIG_DynamicRegexMruListSize (16)
+#define DEFAULT_CONFIG_RegexTierUpThreshold (64)
+#define DEFAULT_CONFIG_RecyclerMaxParallelism (4)
+#define DEFAULT_CONFIG_AllocationSiteSampling (true)
+#define DEFAULT_CONFIG_AllocationSiteSampleInterval (64)
+#define DEFAULT_CONFIG_AllocationSitePretenurePercent (90)
+#define DEFAULT_CONFIG_RecyclerSparseBlockPercent (25)
 #define DEFAULT_CONFIG_GoptCleanupThreshold  (25)
 #define DEFAULT_CONFIG_AsmGoptCleanupThreshold  (500)
 #define DEFAULT_CONFIG_OptimizeForManyInstances (false)
@@ -629,11 +643,13 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeCount (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_RankedJitQueue         (true)
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
 #define DEFAULT_CONFIG_MinTemplatizedJitRunCount      (100)     // Minimum number of times a function needs to be interpreted before it is jitted
 #define DEFAULT_CONFIG_MinAsmJsInterpreterRunCount      (10)     // Minimum number of times a function needs to be Asm interpreted before it is jitted
+#define DEFAULT_CONFIG_MinWasmLoopInterpreterRunCount    (0)     // Minimum number of times a wasm function with loops needs to be Asm interpreted before it is jitted
 #define DEFAULT_CONFIG_MinTemplatizedJitLoopRunCount      (500)     // Minimum number of times a function needs to be interpreted before it is jitted
 #define DEFAULT_CONFIG_MaxTemplatizedJitRunCount      (-1)     // Maximum number of times a function can be TJ before it is jitted
 #define DEFAULT_CONFIG_MaxAsmJsInterpreterRunCount      (-1)     // Maximum number of times a function can be Asm interpreted before it is jitted
@@ -950,6 +966,8 @@ FLAGNR(Number,  ConstructorCallsRequiredToFinalizeCachedType, "Number of calls t
 FLAGNR(Number,  StringCacheMissPenalty, "Number of string cache hits per miss needed to be worth using cache", DEFAULT_CONFIG_StringCacheMissPenalty)
 FLAGNR(Number,  StringCacheMissThreshold, "Point at which we disable string property cache", DEFAULT_CONFIG_StringCacheMissThreshold)
 FLAGNR(Number,  StringCacheMissReset, "Point at which we try to start using string cache after giving up", DEFAULT_CONFIG_StringCacheMissReset)
+FLAGR (Boolean, OneByteStrings, "Store Latin-1 strings from UTF-8 API input and JSON.parse with one byte per character", DEFAULT_CONFIG_OneByteStrings)
+FLAGR (Number,  MinOneByteStringLength, "Minimum length of strings stored with one byte per character", DEFAULT_CONFIG_MinOneByteStringLength)
 #ifdef SECURITY_TESTING
 FLAGNR(Boolean, CrashOnException      , "Removes the top-level exception handler, allowing jc.exe to crash on an unhandled exception.  No effect on IE. (default: false)", false)
 #endif
@@ -960,6 +978,7 @@ FLAGNR(Phases,  DebugBreakOnPhaseBegin, "Break into debugger at the beginning of
 
 FLAGNR(Boolean, DebugWindow           , "Send console output to debugger window", false)
 FLAGNR(Boolean, DeferNested           , "Enable deferred parsing of nested function", DEFAULT_CONFIG_DeferNested)
+FLAGR (Boolean, ParallelParse         , "Parse function bodies on the background job processor threads", DEFAULT_CONFIG_ParallelParse)
 FLAGNR(Boolean, DeferTopLevelTillFirstCall      , "Enable tracking of deferred top level functions in a script file, until the first function of the script context is parsed.", DEFAULT_CONFIG_DeferTopLevelTillFirstCall)
 FLAGNR(Number,  DeferParse            , "Minimum size of defer-parsed script (non-zero only: use /nodeferparse do disable", 0)
 FLAGNR(Boolean, DirectCallTelemetryStats, "Enables logging stats for direct call telemetry", DEFAULT_CONFIG_DirectCallTelemetryStats)
@@ -998,6 +1017,7 @@ FLAGNR(String,  DynamicProfileMutator , "Type of local, temp, return, param, loo
 FLAGNR(Boolean, ExecuteByteCodeBufferReturnsInvalidByteCode, "Serialized byte code execution always returns SCRIPT_E_INVALID_BYTECODE", false)
 FLAGR(Number, ExpirableCollectionGCCount, "Number of GCs during which Expirable object profiling occurs", DEFAULT_CONFIG_ExpirableCollectionGCCount)
 FLAGR (Number,  ExpirableCollectionTriggerThreshold, "Threshold at which Expirable Object Collection is triggered (In Percentage)", DEFAULT_CONFIG_ExpirableCollectionTriggerThreshold)
+FLAGNR(Number,  RegexTierUpThreshold  , "Number of matches after which a regex pattern is promoted to the hot matching tier", DEFAULT_CONFIG_RegexTierUpThreshold)
 FLAGR(Boolean, SkipSplitOnNoResult, "If the result of Regex split isn't used, skip executing the regex. (Perf optimization)", DEFAULT_CONFIG_SkipSplitWhenResultIgnored)
 #ifdef TEST_ETW_EVENTS
 FLAGNR(String,  TestEtwDll            , "Path of the TestEtwEventSink DLL", nullptr)
@@ -1195,6 +1215,7 @@ FLAGNR(Number,  AsmJsInlineAdjust       , "Adjustment in the maximum size in byt
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGR (Boolean, RankedJitQueue        , "Process the hottest queued jit work items first, taking turns between script contexts, and evict the coldest work item when the jit queue is full", DEFAULT_CONFIG_RankedJitQueue)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
@@ -1228,6 +1249,7 @@ FLAGNR(Number,  LoopBodySizeThresholdToDisableOpts, "Minimum bytecode size of a
 
 FLAGNR(Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
 FLAGNR(Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
+FLAGR (Boolean, AdaptiveJitThreadCount, "Only let as many parallel jit threads process work items as there are idle processors", DEFAULT_CONFIG_AdaptiveJitThreadCount)
 
 FLAGNR(Number,  MinInterpretCount     , "Minimum number of times a function must be interpreted", 0)
 FLAGNR(Number,  MinSimpleJitRunCount  , "Minimum number of times a function must be run in simple jit", 0)
@@ -1243,6 +1265,7 @@ FLAGNR(Number,  CopyOnAccessArraySegmentCacheSize, "Size of copy-on-access array
 
 FLAGNR(Number, MinTemplatizedJitRunCount, "Minimum number of times a function must be Templatized Jitted", DEFAULT_CONFIG_MinTemplatizedJitRunCount)
 FLAGNR(Number, MinAsmJsInterpreterRunCount, "Minimum number of times a function must be Asm Interpreted", DEFAULT_CONFIG_MinAsmJsInterpreterRunCount)
+FLAGNR(Number, MinWasmLoopInterpreterRunCount, "Minimum number of times a wasm function with loops must be Asm Interpreted", DEFAULT_CONFIG_MinWasmLoopInterpreterRunCount)
 
 FLAGNR(Number, MinTemplatizedJitLoopRunCount, "Minimum LoopCount run of the Templatized Jit function to run FullJited", DEFAULT_CONFIG_MinTemplatizedJitLoopRunCount)
 FLAGNRA(Number, MaxTemplatizedJitRunCount, Mtjrc, "Maximum number of times a function must be templatized jit", DEFAULT_CONFIG_MaxTemplatizedJitRunCount)
@@ -1357,9 +1380,14 @@ FLAGNR(Boolean, RecyclerTrackStress, "Stress tracked object handling by simulati
 FLAGNR(Boolean, RecyclerInduceFalsePositives, "Stress recycler by forcing false positive object marks", false)
 #endif // RECYCLER_STRESS
 FLAGNR(Boolean, RecyclerForceMarkInterior, "Force all the mark as interior", DEFAULT_CONFIG_RecyclerForceMarkInterior)
+FLAGNR(Boolean, AllocationSiteSampling, "Sample how many of the objects allocated at each object literal survive collections", DEFAULT_CONFIG_AllocationSiteSampling)
+FLAGNR(Number,  AllocationSiteSampleInterval, "Number of objects allocated at an object literal per survival sample", DEFAULT_CONFIG_AllocationSiteSampleInterval)
+FLAGNR(Number,  AllocationSitePretenurePercent, "Percentage of survival samples that must survive before the jit pretenures an object literal", DEFAULT_CONFIG_AllocationSitePretenurePercent)
+FLAGNR(Number,  RecyclerSparseBlockPercent, "Small heap blocks with fewer live objects than this percentage are allocated from last, so they can empty out and be freed (0 to disable)", DEFAULT_CONFIG_RecyclerSparseBlockPercent)
 #if ENABLE_CONCURRENT_GC
 FLAGNR(Number,  RecyclerPriorityBoostTimeout, "Adjust priority boost timeout", 5000)
 FLAGNR(Number,  RecyclerThreadCollectTimeout, "Adjust thread collect timeout", 1000)
+FLAGR (Number,  RecyclerMaxParallelism, "Maximum number of threads (including the calling thread) used for parallel marking (1-16, further limited by the number of processors)", DEFAULT_CONFIG_RecyclerMaxParallelism)
 FLAGRA(Boolean, EnableConcurrentSweepAlloc, ecsa, "Turns off the feature to allow allocations during concurrent sweep.", true)
 #endif
 #ifdef RECYCLER_PAGE_HEAP
@@ -1488,6 +1516,9 @@ FLAGNR(Boolean, DisableDebugObject, "Disable test only Debug object properties",
 FLAGNR(Boolean, DumpHeap, "enable Debug.dumpHeap even when DisableDebugObject is set", DEFAULT_CONFIG_DumpHeap)
 FLAGNR(String, autoProxy, "enable creating proxy for each object creation", _u("__msTestHandler"))
 FLAGNR(Number,  PerfHintLevel, "Specifies the perf-hint level (1,2) 1 == critical, 2 == only noisy", DEFAULT_CONFIG_PerfHintLevel)
+#if PERFMAP_TRACE_ENABLED
+FLAGR(Boolean, PerfJitDump, "Write jitted code to /tmp/jit-<pid>.dump as it is committed, for perf inject --jit", false)
+#endif
 #ifdef INTERNAL_MEM_PROTECT_HEAP_ALLOC
 FLAGNR(Boolean, MemProtectHeap, "Use the mem protect heap as the default heap", DEFAULT_CONFIG_MemProtectHeap)
 #endif
@@ -1564,7 +1595,11 @@ FLAGR(Number, JITServerMaxInactivePageAllocatorCount, "Max inactive page allocat
 
 FLAGNR(Boolean, StrictWriteBarrierCheck, "Check write barrier setting on none write barrier pages", DEFAULT_CONFIG_StrictWriteBarrierCheck)
 FLAGNR(Boolean, WriteBarrierTest, "Always return true while checking barrier to test recycler regardless of annotation", DEFAULT_CONFIG_WriteBarrierTest)
+#if defined(RECYCLER_WRITE_WATCH) && !defined(_WIN32)
+FLAGR (Boolean, ForceSoftwareWriteBarrier, "Use the software write barrier instead of write watch to find pages written during concurrent marking", DEFAULT_CONFIG_ForceSoftwareWriteBarrier)
+#else
 FLAGNR(Boolean, ForceSoftwareWriteBarrier, "Use to turn off write watch to test software write barrier on windows", DEFAULT_CONFIG_ForceSoftwareWriteBarrier)
+#endif
 FLAGNR(Boolean, VerifyBarrierBit, "Verify software write barrier bit is set while marking", DEFAULT_CONFIG_VerifyBarrierBit)
 FLAGNR(Boolean, EnableBGFreeZero, "Use to turn off background freeing and zeroing to simulate linux", DEFAULT_CONFIG_EnableBGFreeZero)
 FLAGNR(Boolean, KeepRecyclerTrackData, "Keep recycler track data after sweep until reuse", DEFAULT_CONFIG_KeepRecyclerTrackData)
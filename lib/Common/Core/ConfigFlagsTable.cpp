@@ -542,6 +542,23 @@ namespace Js
         }
     #endif
 
+    #if defined(RECYCLER_WRITE_WATCH) && !defined(_WIN32)
+        // Write watch is emulated by the PAL and depends on kernel support. Without it, keep using the software write barrier.
+        if(!ForceSoftwareWriteBarrier)
+        {
+            void * writeWatchProbe = ::VirtualAlloc(nullptr, AutoSystemInfo::PageSize, MEM_RESERVE | MEM_WRITE_WATCH, PAGE_READWRITE);
+            if(writeWatchProbe == nullptr)
+            {
+                Output::Print(_u("WARNING: write watch is not supported by this kernel, using the software write barrier\n"));
+                ForceSoftwareWriteBarrier = true;
+            }
+            else
+            {
+                ::VirtualFree(writeWatchProbe, 0, MEM_RELEASE);
+            }
+        }
+    #endif
+
     #if ENABLE_DEBUG_CONFIG_OPTIONS && !DISABLE_JIT
         bool dontEnforceLimitsForSimpleJitAfterOrFullJitAfter = false;
         if((IsEnabled(MinInterpretCountFlag) || IsEnabled(MaxInterpretCountFlag)) &&
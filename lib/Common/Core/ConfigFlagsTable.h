@@ -857,6 +857,13 @@ namespace Js
 #define REGEX_CONFIG_FLAG(flag) (DEFAULT_CONFIG_##flag)
 #endif
 
+#if defined(RECYCLER_WRITE_WATCH) && !defined(_WIN32)
+// Linux builds that emulate write watch choose between it and the software write barrier at run time, in release builds as well
+#define CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() CONFIG_FLAG_RELEASE(ForceSoftwareWriteBarrier)
+#else
+#define CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() CONFIG_FLAG(ForceSoftwareWriteBarrier)
+#endif
+
 #ifdef SUPPORT_INTRUSIVE_TESTTRACES
 #define PHASE_PRINT_INTRUSIVE_TESTTRACE1(phase, ...) \
     PHASE_PRINT_TESTTRACE1(phase, __VA_ARGS__)
@@ -25,6 +25,13 @@ class PageStack
     bool Push(T item);
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
+    uint TransferFullChunks(PageStack<T> * targetStack, uint maxChunkCount);
+
+    // True if there are full chunks below the current one, which can be handed to another stack
+    bool HasFullChunks() const
+    {
+        return this->currentChunk != nullptr && this->currentChunk->nextChunk != nullptr;
+    }
 
     void Abort();
     void Release();
@@ -44,7 +51,7 @@ class PageStack
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 15;    // Not counting original stack, so this supports 16-way parallel
 
 private:
     Chunk * CreateChunk();
@@ -356,6 +363,54 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+uint PageStack<T>::TransferFullChunks(PageStack<T> * targetStack, uint maxChunkCount)
+{
+    // Move up to [maxChunkCount] of the full chunks below the current chunk to [targetStack],
+    // linking them below its current chunk. Only the current chunk of a stack can be partially filled,
+    // so the moved chunks are full on both sides and Pop will pick them up once the current chunk is drained.
+    // The caller is responsible for making sure neither stack is being used by another thread.
+
+    Assert(targetStack != this);
+    Assert(this->currentChunk != nullptr);
+
+    uint transferCount = 0;
+    while (transferCount < maxChunkCount && this->currentChunk->nextChunk != nullptr)
+    {
+        Chunk * chunk = this->currentChunk->nextChunk;
+        this->currentChunk->nextChunk = chunk->nextChunk;
+
+        if (targetStack->currentChunk == nullptr)
+        {
+            // Target stack was never initialized (or was released by a split); the chunk becomes its current chunk.
+            chunk->nextChunk = nullptr;
+            targetStack->currentChunk = chunk;
+            targetStack->chunkStart = chunk->entries;
+            targetStack->chunkEnd = &chunk->entries[EntriesPerChunk];
+            targetStack->nextEntry = targetStack->chunkEnd;
+        }
+        else
+        {
+            chunk->nextChunk = targetStack->currentChunk->nextChunk;
+            targetStack->currentChunk->nextChunk = chunk;
+        }
+
+        transferCount++;
+    }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount -= transferCount;
+    targetStack->pageCount += transferCount;
+#endif
+#if DBG
+    this->count -= transferCount * EntriesPerChunk;
+    targetStack->count += transferCount * EntriesPerChunk;
+#endif
+
+    return transferCount;
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
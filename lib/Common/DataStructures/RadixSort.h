@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+namespace JsUtil
+{
+    // Least significant digit first radix sort of unsigned integer keys, one byte per pass. The
+    // histograms of all passes are built in a single read of the keys, and passes in which every key
+    // has the same byte are skipped. Keys wider than a byte need a scratch buffer of count keys.
+    template <typename TKey>
+    void RadixSort(__inout_ecount(count) TKey* keys, __inout_ecount_opt(count) TKey* scratch, uint32 count)
+    {
+        CompileAssert((TKey)-1 > (TKey)0);
+        const uint Passes = sizeof(TKey);
+
+        uint32 counts[Passes][256];
+        memset(counts, 0, sizeof(counts));
+        for (uint32 i = 0; i < count; i++)
+        {
+            TKey key = keys[i];
+            for (uint pass = 0; pass < Passes; pass++)
+            {
+                counts[pass][(byte)(key >> (pass * 8))]++;
+            }
+        }
+
+        if (Passes == 1)
+        {
+            // Rewrite the keys from their counts
+            uint32 next = 0;
+            for (uint value = 0; value < 256; value++)
+            {
+                for (uint32 i = 0; i < counts[0][value]; i++)
+                {
+                    keys[next++] = (TKey)value;
+                }
+            }
+            Assert(next == count);
+            return;
+        }
+
+        Assert(scratch != nullptr);
+        TKey* source = keys;
+        TKey* destination = scratch;
+        for (uint pass = 0; pass < Passes; pass++)
+        {
+            const uint shift = pass * 8;
+            uint32 *passCounts = counts[pass];
+            if (count == 0 || passCounts[(byte)(source[0] >> shift)] == count)
+            {
+                continue;
+            }
+
+            // Turn the counts into the start offset of each bucket
+            uint32 offset = 0;
+            for (uint value = 0; value < 256; value++)
+            {
+                uint32 bucketCount = passCounts[value];
+                passCounts[value] = offset;
+                offset += bucketCount;
+            }
+
+            for (uint32 i = 0; i < count; i++)
+            {
+                TKey key = source[i];
+                destination[passCounts[(byte)(key >> shift)]++] = key;
+            }
+
+            TKey* temp = source;
+            source = destination;
+            destination = temp;
+        }
+
+        if (source != keys)
+        {
+            js_memcpy_s(keys, count * sizeof(TKey), source, count * sizeof(TKey));
+        }
+    }
+}
@@ -0,0 +1,378 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+namespace JsUtil
+{
+    // Stable, adaptive merge sort following TimSort: natural ascending (or strictly descending,
+    // which get reversed) runs are found in the input and extended to a minimum length with binary
+    // insertion sort, then merged following the TimSort run stack invariants. Before each merge the
+    // parts of both runs that are already in place are skipped with a binary search, so presorted
+    // and concatenated sorted inputs take O(n) comparisons.
+    //
+    // Elements are only moved by assignment, so T may be (or contain) write barrier fields. The
+    // comparer may throw, e.g. when it calls script: the array then still holds every element once,
+    // in an unspecified order.
+    template <class T, class Comparer>
+    class TimSort
+    {
+    public:
+        // Inputs shorter than this are sorted with binary insertion sort alone
+        static const size_t MinMerge = 32;
+
+        // Number of elements the scratch buffer given to Sort has to hold
+        static size_t GetScratchCount(size_t count)
+        {
+            return count < MinMerge ? 0 : count / 2;
+        }
+
+        static void Sort(T* arr, size_t count, T* scratch, const Comparer& comparer, void* context)
+        {
+            if (count < 2)
+            {
+                return;
+            }
+
+            if (count < MinMerge)
+            {
+                size_t runLength = CountRunAndMakeAscending(arr, count, comparer, context);
+                BinaryInsertionSort(arr, count, runLength, comparer, context);
+                return;
+            }
+
+            Assert(scratch != nullptr);
+            TimSort sorter(arr, scratch, GetScratchCount(count), comparer, context);
+            const size_t minRun = GetMinRun(count);
+            size_t low = 0;
+            size_t remaining = count;
+            do
+            {
+                size_t runLength = CountRunAndMakeAscending(arr + low, remaining, comparer, context);
+                if (runLength < minRun)
+                {
+                    const size_t forcedLength = min(remaining, minRun);
+                    BinaryInsertionSort(arr + low, forcedLength, runLength, comparer, context);
+                    runLength = forcedLength;
+                }
+
+                sorter.PushRun(low, runLength);
+                sorter.MergeCollapse();
+
+                low += runLength;
+                remaining -= runLength;
+            } while (remaining != 0);
+
+            sorter.MergeForceCollapse();
+            Assert(sorter.runCount == 1 && sorter.runLength[0] == count);
+        }
+
+    private:
+        // Enough for any count that fits in a size_t, given the run length invariants
+        static const int MaxRuns = 85;
+
+        T* arr;
+        T* scratch;
+        size_t scratchCount;
+        const Comparer& comparer;
+        void* context;
+        int runCount;
+        size_t runBase[MaxRuns];
+        size_t runLength[MaxRuns];
+
+        TimSort(T* arr, T* scratch, size_t scratchCount, const Comparer& comparer, void* context) :
+            arr(arr), scratch(scratch), scratchCount(scratchCount), comparer(comparer), context(context), runCount(0)
+        {
+        }
+
+        // Returns a run length in [MinMerge / 2, MinMerge] such that count / minRun is a power of two or
+        // just below one, which keeps the final merges balanced.
+        static size_t GetMinRun(size_t count)
+        {
+            size_t lowBits = 0;
+            while (count >= MinMerge)
+            {
+                lowBits |= (count & 1);
+                count >>= 1;
+            }
+            return count + lowBits;
+        }
+
+        static size_t CountRunAndMakeAscending(T* a, size_t count, const Comparer& comparer, void* context)
+        {
+            Assert(count > 0);
+            if (count == 1)
+            {
+                return 1;
+            }
+
+            size_t runEnd = 2;
+            if (comparer(context, &a[1], &a[0]) < 0)
+            {
+                // Strictly descending, so that reversing it keeps the sort stable
+                while (runEnd < count && comparer(context, &a[runEnd], &a[runEnd - 1]) < 0)
+                {
+                    runEnd++;
+                }
+                Reverse(a, runEnd);
+            }
+            else
+            {
+                while (runEnd < count && comparer(context, &a[runEnd], &a[runEnd - 1]) >= 0)
+                {
+                    runEnd++;
+                }
+            }
+            return runEnd;
+        }
+
+        static void Reverse(T* a, size_t count)
+        {
+            for (size_t i = 0, j = count - 1; i < j; i++, j--)
+            {
+                T temp = a[i];
+                a[i] = a[j];
+                a[j] = temp;
+            }
+        }
+
+        // a[0, start) is sorted, insert the elements of a[start, count) into it
+        static void BinaryInsertionSort(T* a, size_t count, size_t start, const Comparer& comparer, void* context)
+        {
+            for (size_t i = max(start, (size_t)1); i < count; i++)
+            {
+                // Find the position after the last element that is not greater, the comparisons are
+                // all done before anything moves
+                size_t left = 0;
+                size_t right = i;
+                while (left < right)
+                {
+                    const size_t middle = left + (right - left) / 2;
+                    if (comparer(context, &a[i], &a[middle]) < 0)
+                    {
+                        right = middle;
+                    }
+                    else
+                    {
+                        left = middle + 1;
+                    }
+                }
+
+                if (left != i)
+                {
+                    T pivot = a[i];
+                    for (size_t j = i; j > left; j--)
+                    {
+                        a[j] = a[j - 1];
+                    }
+                    a[left] = pivot;
+                }
+            }
+        }
+
+        // Number of elements of a[0, count) that are less than or equal to key
+        size_t CountNotGreater(const T* key, const T* a, size_t count) const
+        {
+            size_t left = 0;
+            size_t right = count;
+            while (left < right)
+            {
+                const size_t middle = left + (right - left) / 2;
+                if (comparer(context, key, &a[middle]) < 0)
+                {
+                    right = middle;
+                }
+                else
+                {
+                    left = middle + 1;
+                }
+            }
+            return left;
+        }
+
+        // Number of elements of a[0, count) that are less than key
+        size_t CountLess(const T* key, const T* a, size_t count) const
+        {
+            size_t left = 0;
+            size_t right = count;
+            while (left < right)
+            {
+                const size_t middle = left + (right - left) / 2;
+                if (comparer(context, &a[middle], key) < 0)
+                {
+                    left = middle + 1;
+                }
+                else
+                {
+                    right = middle;
+                }
+            }
+            return left;
+        }
+
+        void PushRun(size_t base, size_t length)
+        {
+            AssertOrFailFast(runCount < MaxRuns);
+            runBase[runCount] = base;
+            runLength[runCount] = length;
+            runCount++;
+        }
+
+        // Merges runs until the stack satisfies, for the lengths A, B, C, D from the top down,
+        // B > A, C > B + A and D > C + B
+        void MergeCollapse()
+        {
+            while (runCount > 1)
+            {
+                int n = runCount - 2;
+                if ((n > 0 && runLength[n - 1] <= runLength[n] + runLength[n + 1]) ||
+                    (n > 1 && runLength[n - 2] <= runLength[n - 1] + runLength[n]))
+                {
+                    if (runLength[n - 1] < runLength[n + 1])
+                    {
+                        n--;
+                    }
+                }
+                else if (runLength[n] > runLength[n + 1])
+                {
+                    break;
+                }
+                MergeAt(n);
+            }
+        }
+
+        void MergeForceCollapse()
+        {
+            while (runCount > 1)
+            {
+                int n = runCount - 2;
+                if (n > 0 && runLength[n - 1] < runLength[n + 1])
+                {
+                    n--;
+                }
+                MergeAt(n);
+            }
+        }
+
+        // Merges the runs n and n + 1 of the stack
+        void MergeAt(int n)
+        {
+            Assert(n >= 0 && n + 1 < runCount);
+
+            size_t base1 = runBase[n];
+            size_t length1 = runLength[n];
+            const size_t base2 = runBase[n + 1];
+            size_t length2 = runLength[n + 1];
+            Assert(base1 + length1 == base2);
+
+            runLength[n] = length1 + length2;
+            if (n == runCount - 3)
+            {
+                runBase[n + 1] = runBase[n + 2];
+                runLength[n + 1] = runLength[n + 2];
+            }
+            runCount--;
+
+            // Elements at the start of run 1 that are not greater than the first element of run 2,
+            // and at the end of run 2 that are not less than the last element of run 1, are in place
+            const size_t skip = CountNotGreater(&arr[base2], &arr[base1], length1);
+            base1 += skip;
+            length1 -= skip;
+            if (length1 == 0)
+            {
+                return;
+            }
+
+            length2 = CountLess(&arr[base1 + length1 - 1], &arr[base2], length2);
+            if (length2 == 0)
+            {
+                return;
+            }
+
+            if (length1 <= length2)
+            {
+                MergeLow(base1, length1, base2, length2);
+            }
+            else
+            {
+                MergeHigh(base1, length1, base2, length2);
+            }
+        }
+
+        // Merges with run 1 copied to the scratch buffer, filling the array from the front
+        void MergeLow(size_t base1, size_t length1, size_t base2, size_t length2)
+        {
+            AssertOrFailFast(length1 <= scratchCount);
+            for (size_t i = 0; i < length1; i++)
+            {
+                scratch[i] = arr[base1 + i];
+            }
+
+            size_t taken1 = 0;          // from the scratch buffer
+            size_t next2 = base2;       // in the array
+            const size_t end2 = base2 + length2;
+            TryFinally([&]()
+            {
+                while (taken1 < length1 && next2 < end2)
+                {
+                    const size_t dest = next2 - (length1 - taken1);
+                    if (comparer(context, &arr[next2], &scratch[taken1]) < 0)
+                    {
+                        arr[dest] = arr[next2++];
+                    }
+                    else
+                    {
+                        arr[dest] = scratch[taken1++];
+                    }
+                }
+            },
+            [&](bool)
+            {
+                // The rest of run 1 goes to the gap right before the rest of run 2
+                for (size_t dest = next2 - (length1 - taken1); taken1 < length1; taken1++, dest++)
+                {
+                    arr[dest] = scratch[taken1];
+                }
+            });
+        }
+
+        // Merges with run 2 copied to the scratch buffer, filling the array from the back
+        void MergeHigh(size_t base1, size_t length1, size_t base2, size_t length2)
+        {
+            AssertOrFailFast(length2 <= scratchCount);
+            for (size_t i = 0; i < length2; i++)
+            {
+                scratch[i] = arr[base2 + i];
+            }
+
+            size_t left1 = length1;     // in the array
+            size_t left2 = length2;     // in the scratch buffer
+            TryFinally([&]()
+            {
+                while (left1 != 0 && left2 != 0)
+                {
+                    const size_t dest = base1 + left1 + left2 - 1;
+                    if (comparer(context, &scratch[left2 - 1], &arr[base1 + left1 - 1]) < 0)
+                    {
+                        arr[dest] = arr[base1 + left1 - 1];
+                        left1--;
+                    }
+                    else
+                    {
+                        arr[dest] = scratch[left2 - 1];
+                        left2--;
+                    }
+                }
+            },
+            [&](bool)
+            {
+                // The rest of run 2 goes to the gap right after the rest of run 1
+                for (size_t i = 0; i < left2; i++)
+                {
+                    arr[base1 + left1 + i] = scratch[i];
+                }
+            });
+        }
+    };
+}
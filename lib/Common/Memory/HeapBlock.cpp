@@ -276,7 +276,7 @@ SmallHeapBlockT<MediumAllocationBlockAttributes>::ProtectUnusablePages()
         BOOL ret = ::VirtualProtect(startPage, count * AutoSystemInfo::PageSize, PAGE_READONLY, &oldProtect);
         Assert(ret && oldProtect == PAGE_READWRITE);
 #ifdef RECYCLER_WRITE_WATCH
-        if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+        if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
         {
             ::ResetWriteWatch(startPage, count*AutoSystemInfo::PageSize);
         }
@@ -1064,7 +1064,7 @@ SmallHeapBlockT<TBlockAttributes>::VerifyMark()
 
             if (!this->IsLeafBlock()
 #ifdef RECYCLER_WRITE_BARRIER
-                && (!this->IsWithBarrier() || CONFIG_FLAG(ForceSoftwareWriteBarrier))
+                && (!this->IsWithBarrier() || CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
 #endif
                 )
             {
@@ -1077,7 +1077,7 @@ SmallHeapBlockT<TBlockAttributes>::VerifyMark()
                         if (recycler->VerifyMark(objectAddress, target))
                         {
 #if DBG && GLOBAL_ENABLE_WRITE_BARRIER
-                            if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+                            if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(VerifyBarrierBit))
                             {
                                 this->WBVerifyBitIsSet(objectAddress);
                             }
@@ -1526,7 +1526,7 @@ SmallHeapBlockT<TBlockAttributes>::EnqueueProcessedObject(FreeObject ** list, vo
     *list = freeObject;
 
 #if DBG && GLOBAL_ENABLE_WRITE_BARRIER
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(RecyclerVerifyMark))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(RecyclerVerifyMark))
     {
         this->WBClearObject((char*)objectAddress);
     }
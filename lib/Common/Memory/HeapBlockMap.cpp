@@ -612,7 +612,7 @@ HeapBlockMap32::ResetDirtyPages(Recycler * recycler)
         Assert(segmentLength % AutoSystemInfo::PageSize == 0);
 
 #ifdef RECYCLER_WRITE_WATCH
-        if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+        if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
         {
             if (segmentPageAllocator->IsWriteWatchEnabled())
             {
@@ -890,7 +890,7 @@ HeapBlockMap32::Rescan(Recycler * recycler, bool resetWriteWatch)
         Assert(segmentLength % AutoSystemInfo::PageSize == 0);
 
 #ifdef RECYCLER_WRITE_WATCH
-        if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+        if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
         {
             // Call GetWriteWatch for Small non-leaf segments.
             // Large blocks have their own separate write watch handling.
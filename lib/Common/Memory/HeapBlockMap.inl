@@ -76,7 +76,7 @@ HeapBlockMap32::Mark(void * candidate, MarkContext * markContext)
     }
 
 #if DBG && GLOBAL_ENABLE_WRITE_BARRIER
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(VerifyBarrierBit))
     {
         Recycler::WBVerifyBitIsSet((char*)markContext->parentRef, (char*)candidate);
     }
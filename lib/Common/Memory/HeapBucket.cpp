@@ -1055,6 +1055,7 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
 #endif
 
             RECYCLER_STATS_INC(recycler, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
+            RECYCLER_STATS_ADD(recycler, smallBlockReclaimedByteCount, heapBlock->GetPageCount() * AutoSystemInfo::PageSize);
 
 #if ENABLE_CONCURRENT_GC
             // CONCURRENT-TODO: Finalizable block never have background == true and always be processed
@@ -1210,6 +1211,52 @@ HeapBucketT<TBlockType>::StopAllocationBeforeSweep()
     this->nextAllocableBlockHead = nullptr;
 }
 
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::MoveSparseHeapBlocksToEnd()
+{
+    // Objects are never moved, so a block keeps its pages for as long as any of its objects is alive.
+    // Fill up the densely occupied blocks first and leave the sparse ones for last, so that the objects
+    // in the sparse blocks have a chance to all die and the block gets released on the next sweep.
+    const uint sparsePercent = CONFIG_FLAG(RecyclerSparseBlockPercent);
+    if (sparsePercent == 0)
+    {
+        return;
+    }
+
+    TBlockType * denseHead = nullptr;
+    TBlockType * denseTail = nullptr;
+    TBlockType * sparseHead = nullptr;
+    TBlockType * sparseTail = nullptr;
+    HeapBlockList::ForEachEditing(this->heapBlockList, [&](TBlockType * heapBlock)
+    {
+        const bool isSparse = heapBlock->GetMarkedCount() * 100 < heapBlock->GetObjectCount() * sparsePercent;
+        TBlockType *& head = isSparse ? sparseHead : denseHead;
+        TBlockType *& tail = isSparse ? sparseTail : denseTail;
+        heapBlock->SetNextBlock(nullptr);
+        if (tail == nullptr)
+        {
+            head = heapBlock;
+        }
+        else
+        {
+            tail->SetNextBlock(heapBlock);
+        }
+        tail = heapBlock;
+        RECYCLER_STATS_INC_IF(isSparse, this->GetRecycler(), numSparseSmallBlocks);
+    });
+
+    if (denseTail == nullptr)
+    {
+        this->heapBlockList = sparseHead;
+    }
+    else
+    {
+        denseTail->SetNextBlock(sparseHead);
+        this->heapBlockList = denseHead;
+    }
+}
+
 template <typename TBlockType>
 void
 HeapBucketT<TBlockType>::StartAllocationAfterSweep()
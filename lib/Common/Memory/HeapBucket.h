@@ -251,6 +251,7 @@ class HeapBucketT : public HeapBucket
     void StopAllocationBeforeSweep();
     void StartAllocationAfterSweep();
     bool IsAllocationStopped() const;
+    void MoveSparseHeapBlocksToEnd();
 
     void SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlockType * heapBlockList, bool allocable);
 #if ENABLE_PARTIAL_GC
@@ -356,6 +357,7 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep, Fn sweepFn)
 #endif
         // Every thing is swept immediately in non partial collect, so we can allocate
         // from the heap block list now
+        MoveSparseHeapBlocksToEnd();
         StartAllocationAfterSweep();
     }
 
@@ -1024,6 +1024,8 @@ HeapInfo::Sweep(RecyclerSweep& recyclerSweep, bool concurrent)
 #ifdef RECYCLER_STATS
     memset(&recycler->collectionStats.numEmptySmallBlocks, 0, sizeof(recycler->collectionStats.numEmptySmallBlocks));
     recycler->collectionStats.numZeroedOutSmallBlocks = 0;
+    recycler->collectionStats.smallBlockReclaimedByteCount = 0;
+    recycler->collectionStats.numSparseSmallBlocks = 0;
 #endif
 
     RECYCLER_SLOW_CHECK(VerifySmallHeapBlockCount());
@@ -934,7 +934,7 @@ LargeHeapBlock::VerifyMark()
             if (recycler->VerifyMark(objectAddress, target))
             {
 #if DBG && GLOBAL_ENABLE_WRITE_BARRIER
-                if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+                if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(VerifyBarrierBit))
                 {
                     this->WBVerifyBitIsSet(objectAddress);
                 }
@@ -1114,7 +1114,7 @@ bool LargeHeapBlock::IsPageDirty(char* page, RescanFlags flags, bool isWriteBarr
 #endif
 
 #ifdef RECYCLER_WRITE_WATCH
-    if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+    if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
     {
         ULONG_PTR count = 1;
         DWORD pageSize = AutoSystemInfo::PageSize;
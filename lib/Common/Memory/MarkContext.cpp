@@ -13,6 +13,7 @@
 MarkContext::MarkContext(Recycler * recycler, PagePool * pagePool) :
     recycler(recycler),
     pagePool(pagePool),
+    workPool(nullptr),
     markStack(pagePool),
 #ifdef RECYCLER_VISITED_HOST
     preciseStack(pagePool),
@@ -132,4 +133,118 @@ void MarkContext::ProcessTracked()
 }
 
 
+ParallelMarkWorkPool::ParallelMarkWorkPool(Js::ConfigFlagsTable& flagsTable) :
+    pagePool(flagsTable),
+    sharedStack(&pagePool),
+    chunkCount(0),
+    activeMarkerCount(0),
+    waitingMarkerCount(0),
+    stealCount(0)
+{
+}
+
+
+void ParallelMarkWorkPool::Init()
+{
+    // The shared stack keeps an empty current chunk for its whole lifetime; donated chunks are linked below it.
+    sharedStack.Init();
+}
+
+
+void ParallelMarkWorkPool::Release()
+{
+    Assert(this->chunkCount == 0);
+
+    sharedStack.Release();
+    pagePool.ReleaseFreePages();
+}
+
+
+void ParallelMarkWorkPool::Start()
+{
+    Assert(this->chunkCount == 0);
+    Assert(sharedStack.IsEmpty());
+
+    this->activeMarkerCount = 0;
+    this->waitingMarkerCount = 0;
+    this->stealCount = 0;
+}
+
+
+void ParallelMarkWorkPool::Stop()
+{
+    // Markers only leave once nobody is active, at which point no more chunks can be donated,
+    // and they drain the pool before leaving, so everything that was donated has been stolen.
+    Assert(this->chunkCount == 0);
+    Assert(this->activeMarkerCount == 0);
+    Assert(this->waitingMarkerCount == 0);
+    Assert(sharedStack.IsEmpty());
+}
 
+
+void ParallelMarkWorkPool::AddMarker()
+{
+    AutoCriticalSection autoLock(&this->cs);
+    this->activeMarkerCount++;
+}
+
+
+void ParallelMarkWorkPool::Donate(MarkContext * markContext)
+{
+    AutoCriticalSection autoLock(&this->cs);
+
+    // Check again under the lock, another marker may have already satisfied the request
+    if (this->chunkCount < this->waitingMarkerCount)
+    {
+        this->chunkCount += markContext->markStack.TransferFullChunks(&this->sharedStack, this->waitingMarkerCount - this->chunkCount);
+    }
+}
+
+
+bool ParallelMarkWorkPool::Steal(MarkContext * markContext)
+{
+    Assert(markContext->markStack.IsEmpty());
+
+    {
+        AutoCriticalSection autoLock(&this->cs);
+        Assert(this->activeMarkerCount > 0);
+        this->activeMarkerCount--;
+        this->waitingMarkerCount++;
+    }
+
+    uint spinCount = 0;
+    while (true)
+    {
+        {
+            AutoCriticalSection autoLock(&this->cs);
+            if (this->chunkCount != 0)
+            {
+                uint transferCount = this->sharedStack.TransferFullChunks(&markContext->markStack, 1);
+                Assert(transferCount == 1);
+
+                this->chunkCount -= transferCount;
+                this->waitingMarkerCount--;
+                this->activeMarkerCount++;
+                this->stealCount++;
+                return true;
+            }
+
+            if (this->activeMarkerCount == 0)
+            {
+                // Nobody is left to produce more work
+                this->waitingMarkerCount--;
+                return false;
+            }
+        }
+
+        // Busy markers only check for waiters between objects, so the wait is short; yield before sleeping.
+        if (spinCount++ < 64)
+        {
+            SwitchToThread();
+        }
+        else
+        {
+            Sleep(1);
+        }
+    }
+}
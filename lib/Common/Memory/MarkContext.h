@@ -7,6 +7,7 @@ interface IRecyclerVisitedObject;
 namespace Memory
 {
 class Recycler;
+class ParallelMarkWorkPool;
 
 typedef JsUtil::SynchronizedDictionary<void *, void *, NoCheckHeapAllocator, PrimeSizePolicy, RecyclerPointerComparer, JsUtil::SimpleDictionaryEntry, Js::DefaultContainerLockPolicy, CriticalSection> MarkMap;
 
@@ -16,6 +17,8 @@ enum class RecyclerScanMemoryType { General, Stack };
 
 class MarkContext
 {
+    friend class ParallelMarkWorkPool;
+
 private:
     struct MarkCandidate
     {
@@ -25,6 +28,7 @@ class MarkContext
 
 public:
     static const int MarkCandidateSize = sizeof(MarkCandidate);
+    static const uint MaxSplitTargets = PageStack<MarkCandidate>::MaxSplitTargets;
 
     MarkContext(Recycler * recycler, PagePool * pagePool);
     ~MarkContext();
@@ -56,6 +60,9 @@ class MarkContext
     template <bool parallel, bool interior>
     void ProcessMark();
 
+    // Parallel marking only: share full mark stack chunks with other contexts through the pool once this context runs dry
+    void SetWorkPool(ParallelMarkWorkPool * workPool) { this->workPool = workPool; }
+
     void MarkTrackedObject(FinalizableObject * obj);
     void ProcessTracked();
 
@@ -126,8 +133,14 @@ class MarkContext
 #endif
 
 private:
+    template <bool parallel, bool interior>
+    void ProcessMarkStacks();
+    template <bool parallel>
+    void DonateMarkWorkIfRequested();
+
     Recycler * recycler;
     PagePool * pagePool;
+    ParallelMarkWorkPool * workPool;
     PageStack<MarkCandidate> markStack;
 #ifdef RECYCLER_VISITED_HOST
     PageStack<IRecyclerVisitedObject*> preciseStack;
@@ -146,5 +159,37 @@ class MarkContext
 #endif
 };
 
+// Shared pool of full mark stack chunks used to balance work between the contexts taking part in a parallel mark.
+// A context that runs out of work registers itself as waiting and steals a chunk from the pool; busy contexts
+// notice waiters while popping and donate the full chunks sitting below their current chunk.
+class ParallelMarkWorkPool
+{
+public:
+    ParallelMarkWorkPool(Js::ConfigFlagsTable& flagsTable);
+
+    void Init();
+    void Release();
+
+    void Start();
+    void Stop();
+
+    void AddMarker();
+    bool IsWorkRequested() const { return this->waitingMarkerCount != 0 && this->chunkCount == 0; }
+    void Donate(MarkContext * markContext);
+    bool Steal(MarkContext * markContext);
+
+    uint GetStealCount() const { return this->stealCount; }
+    void DecommitPages() { this->pagePool.Decommit(); }
+
+private:
+    CriticalSection cs;
+    PagePool pagePool;
+    PageStack<MarkContext::MarkCandidate> sharedStack;
+    uint volatile chunkCount;
+    uint volatile activeMarkerCount;
+    uint volatile waitingMarkerCount;
+    uint stealCount;
+};
+
 
 }
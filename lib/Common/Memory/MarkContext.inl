@@ -226,6 +226,35 @@ void MarkContext::ProcessMark()
     }
 #endif
 
+    if (parallel && this->workPool != nullptr)
+    {
+        // Keep marking chunks stolen from the other contexts until all of them have run dry.
+        this->workPool->AddMarker();
+        do
+        {
+            ProcessMarkStacks<parallel, interior>();
+        }
+        while (this->workPool->Steal(this));
+        return;
+    }
+
+    ProcessMarkStacks<parallel, interior>();
+}
+
+template <bool parallel>
+inline
+void MarkContext::DonateMarkWorkIfRequested()
+{
+    if (parallel && this->workPool != nullptr && this->workPool->IsWorkRequested() && markStack.HasFullChunks())
+    {
+        this->workPool->Donate(this);
+    }
+}
+
+template <bool parallel, bool interior>
+inline
+void MarkContext::ProcessMarkStacks()
+{
 #ifdef RECYCLER_VISITED_HOST
     // Flip between processing the generic mark stack (conservatively traced with ScanMemory) and
     // the precise stack (precisely traced via IRecyclerVisitedObject::Trace). Each of those
@@ -252,6 +281,8 @@ void MarkContext::ProcessMark()
                     // Process the previously retrieved entry.
                     ScanObject<parallel, interior>(current.obj, current.byteCount);
 
+                    DonateMarkWorkIfRequested<parallel>();
+
                     _mm_prefetch((char *)*(next.obj), _MM_HINT_T0);
 
                     current = next;
@@ -271,6 +302,8 @@ void MarkContext::ProcessMark()
             while (markStack.Pop(&current))
             {
                 ScanObject<parallel, interior>(current.obj, current.byteCount);
+
+                DonateMarkWorkIfRequested<parallel>();
             }
 #endif
         }
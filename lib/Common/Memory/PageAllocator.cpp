@@ -60,6 +60,13 @@ SegmentBase<T>::~SegmentBase()
     if (this->address)
     {
         char* originalAddress = this->address - (leadingGuardPageCount * AutoSystemInfo::PageSize);
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+        if (this->IsInCustomHeapAllocator())
+        {
+            // Not registered if Initialize failed to register it
+            CodeSegmentRanges::Remove(originalAddress);
+        }
+#endif
         GetAllocator()->GetVirtualAllocator()->Free(originalAddress, GetPageCount() * AutoSystemInfo::PageSize, MEM_RELEASE);
         GetAllocator()->ReportFree(this->segmentPageCount * AutoSystemInfo::PageSize); //Note: We reported the guard pages free when we decommitted them during segment initialization
 #if defined(_M_X64_OR_ARM64) && defined(RECYCLER_WRITE_BARRIER_BYTE)
@@ -200,6 +207,14 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
 #endif
 #endif
 
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    if (this->IsInCustomHeapAllocator() && !CodeSegmentRanges::Add(originalAddress, (leadingGuardPageCount + this->segmentPageCount) * AutoSystemInfo::PageSize))
+    {
+        // The destructor releases the segment
+        return false;
+    }
+#endif
+
     return true;
 }
 
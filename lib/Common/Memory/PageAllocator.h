@@ -114,6 +114,27 @@ class SecondaryAllocator
     virtual ~SecondaryAllocator() {};
 };
 
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+// Custom heap segments hold JITed code, and are registered so the SIGSEGV handler can check that a faulting pc
+// is in JITed code before it changes the thread's context. Segment reservations are 64KB aligned, so each entry
+// is the reservation's base address with its size in pages in the low 16 bits.
+struct CodeSegmentRangeTraits
+{
+    static const uintptr_t SizeMask = 0xFFFF;
+
+    static uintptr_t Encode(void* address, size_t size)
+    {
+        Assert(((uintptr_t)address & SizeMask) == 0);
+        Assert(size % AutoSystemInfo::PageSize == 0);
+        size_t pageCount = size / AutoSystemInfo::PageSize;
+        return pageCount <= SizeMask ? (uintptr_t)address | pageCount : 0;
+    }
+    static uintptr_t GetBase(uintptr_t entry) { return entry & ~SizeMask; }
+    static size_t GetSize(uintptr_t entry) { return (entry & SizeMask) * AutoSystemInfo::PageSize; }
+};
+typedef SignalSafeRangeTable<CodeSegmentRangeTraits, 16384> CodeSegmentRanges;
+#endif
+
 class PageAllocatorBaseCommon;
 
 class SegmentBaseCommon
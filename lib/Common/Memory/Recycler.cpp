@@ -130,12 +130,13 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     threadPageAllocator(pageAllocator),
     markPagePool(configFlagsTable),
     parallelMarkPagePool1(configFlagsTable),
-    parallelMarkPagePool2(configFlagsTable),
-    parallelMarkPagePool3(configFlagsTable),
+#if ENABLE_CONCURRENT_GC
+    parallelMarkers(nullptr),
+    parallelMarkerCount(0),
+#endif
+    parallelMarkWorkPool(configFlagsTable),
     markContext(this, &this->markPagePool),
     parallelMarkContext1(this, &this->parallelMarkPagePool1),
-    parallelMarkContext2(this, &this->parallelMarkPagePool2),
-    parallelMarkContext3(this, &this->parallelMarkPagePool3),
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), GetPageAllocator(), Js::Throw::OutOfMemory),
 #endif
@@ -163,8 +164,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -263,8 +262,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
     markContext.SetMarkMap(markMap);
     parallelMarkContext1.SetMarkMap(markMap);
-    parallelMarkContext2.SetMarkMap(markMap);
-    parallelMarkContext3.SetMarkMap(markMap);
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -290,10 +287,10 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
 
     this->inDispose = false;
+    this->collectionCount = 0;
 
 #if DBG
     this->heapBlockCount = 0;
-    this->collectionCount = 0;
     this->disableThreadAccessCheck = false;
 #if ENABLE_CONCURRENT_GC
     this->disableConcurrentThreadExitedCheck = false;
@@ -340,8 +337,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     // recycler requires at least Recycler::PrimaryMarkStackReservedPageCount to function properly for the main mark context
     this->markContext.SetMaxPageCount(max(static_cast<size_t>(GetRecyclerFlagsTable().MaxMarkStackPageCount), static_cast<size_t>(Recycler::PrimaryMarkStackReservedPageCount)));
     this->parallelMarkContext1.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext2.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext3.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
 
     if (GetRecyclerFlagsTable().IsEnabled(Js::GCMemoryThresholdFlag))
     {
@@ -544,8 +539,21 @@ Recycler::~Recycler()
 
     markContext.Release();
     parallelMarkContext1.Release();
-    parallelMarkContext2.Release();
-    parallelMarkContext3.Release();
+    parallelMarkWorkPool.Release();
+
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < parallelMarkerCount; i++)
+    {
+        parallelMarkers[i]->markContext.Release();
+        HeapDelete(parallelMarkers[i]);
+    }
+    if (parallelMarkers != nullptr)
+    {
+        HeapDeleteArray(parallelMarkerCount, parallelMarkers);
+        parallelMarkers = nullptr;
+    }
+    parallelMarkerCount = 0;
+#endif
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -827,6 +835,9 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #endif
 
     markContext.Init(Recycler::PrimaryMarkStackReservedPageCount);
+#if ENABLE_CONCURRENT_GC
+    parallelMarkWorkPool.Init();
+#endif
 
 #if defined(RECYCLER_DUMP_OBJECT_GRAPH) || defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
     isPrimaryMarkContextInitialized = true;
@@ -867,7 +878,11 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+
+    // The calling thread, the concurrent thread and each parallel marker take one split of the mark stack,
+    // so the parallelism is limited by the number of splits as well as by the flag
+    uint maxParallelismLimit = (uint)max(1, min((int)MarkContext::MaxSplitTargets + 1, (int)GetRecyclerFlagsTable().RecyclerMaxParallelism));
+    this->maxParallelism = (numProcs > maxParallelismLimit) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? maxParallelismLimit : numProcs;
 
     if (forceInThread)
     {
@@ -892,6 +907,12 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
     {
         this->disableConcurrent = false;
 
+        if (!InitializeParallelMarkers())
+        {
+            // Mark with the calling thread and the concurrent thread only
+            this->maxParallelism = min(this->maxParallelism, (uint)2);
+        }
+
         if (deferThreadStartup || EnableConcurrent(threadService, false))
         {
 #ifdef RECYCLER_WRITE_WATCH
@@ -912,7 +933,7 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 
 #if ENABLE_CONCURRENT_GC
 #ifdef RECYCLER_WRITE_WATCH
-    if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+    if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
     {
         if (needWriteWatch)
         {
@@ -986,9 +1007,10 @@ Recycler::ClearNeedOOMRescan()
 {
     this->needOOMRescan = false;
     markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    ForEachParallelMarkContext([](MarkContext * context)
+    {
+        context->GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    });
 }
 
 bool
@@ -1008,7 +1030,7 @@ Recycler::GetUsedBytes()
     usedBytes += recyclerLargeBlockPageAllocator.usedBytes;
 
 #if GLOBAL_ENABLE_WRITE_BARRIER
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
     {
         Assert(recyclerPageAllocator.usedBytes == 0);
     }
@@ -1022,7 +1044,7 @@ Recycler::GetRecyclerPageAllocator()
     // TODO: SWB this is for Finalizable leaf allocation, which we didn't implement leaf bucket for it
     // remove this after the finalizable leaf bucket is implemented
 #if GLOBAL_ENABLE_WRITE_BARRIER
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
     {
         return &this->recyclerWithBarrierPageAllocator;
     }
@@ -1467,30 +1489,60 @@ Recycler::OutOfMemory()
     outOfMemoryFunc();
 }
 
-void Recycler::GetNormalHeapBlockAllocatorInfoForNativeAllocation(void* recyclerAddr, size_t allocSize, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT)
+void Recycler::GetNormalHeapBlockAllocatorInfoForNativeAllocation(void* recyclerAddr, size_t allocSize, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT, bool withBarrier)
 {
     Assert(recyclerAddr);
-    return ((Recycler*)recyclerAddr)->GetNormalHeapBlockAllocatorInfoForNativeAllocation(allocSize, allocatorAddress, endAddressOffset, freeListOffset, allowBumpAllocation, isOOPJIT);
+    return ((Recycler*)recyclerAddr)->GetNormalHeapBlockAllocatorInfoForNativeAllocation(allocSize, allocatorAddress, endAddressOffset, freeListOffset, allowBumpAllocation, isOOPJIT, withBarrier);
 }
 
-void Recycler::GetNormalHeapBlockAllocatorInfoForNativeAllocation(size_t allocSize, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT)
+void Recycler::GetNormalHeapBlockAllocatorInfoForNativeAllocation(size_t allocSize, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT, bool withBarrier)
 {
     Assert(HeapInfo::IsAlignedSize(allocSize));
     Assert(HeapInfo::IsSmallObject(allocSize));
 
-    allocatorAddress = (char*)this + offsetof(Recycler, autoHeap) + offsetof(HeapInfo, heapBuckets) +
-        sizeof(HeapBucketGroup<SmallAllocationBlockAttributes>)*((uint)(allocSize >> HeapConstants::ObjectAllocationShift) - 1)
-        + HeapBucketGroup<SmallAllocationBlockAttributes>::GetHeapBucketOffset()
-        + HeapBucketT<SmallNormalHeapBlockT<SmallAllocationBlockAttributes>>::GetAllocatorHeadOffset();
+    char * heapBucketGroupAddress = (char*)this + offsetof(Recycler, autoHeap) + offsetof(HeapInfo, heapBuckets) +
+        sizeof(HeapBucketGroup<SmallAllocationBlockAttributes>)*((uint)(allocSize >> HeapConstants::ObjectAllocationShift) - 1);
+
+#ifdef RECYCLER_WRITE_BARRIER
+    if (withBarrier)
+    {
+        // Objects the jit pretenures go to the card-tracked blocks of the write barrier bucket
+        allocatorAddress = heapBucketGroupAddress
+            + HeapBucketGroup<SmallAllocationBlockAttributes>::GetWithBarrierHeapBucketOffset()
+            + HeapBucketT<SmallNormalWithBarrierHeapBlockT<SmallAllocationBlockAttributes>>::GetAllocatorHeadOffset();
 
-    endAddressOffset = SmallHeapBlockAllocator<SmallNormalHeapBlockT<SmallAllocationBlockAttributes>>::GetEndAddressOffset();
-    freeListOffset = SmallHeapBlockAllocator<SmallNormalHeapBlockT<SmallAllocationBlockAttributes>>::GetFreeObjectListOffset();;
+        endAddressOffset = SmallHeapBlockAllocator<SmallNormalWithBarrierHeapBlockT<SmallAllocationBlockAttributes>>::GetEndAddressOffset();
+        freeListOffset = SmallHeapBlockAllocator<SmallNormalWithBarrierHeapBlockT<SmallAllocationBlockAttributes>>::GetFreeObjectListOffset();
+
+        if (!isOOPJIT)
+        {
+            Assert(allocatorAddress == GetAddressOfAllocator<WithBarrierBit>(allocSize));
+            Assert(endAddressOffset == GetEndAddressOffset<WithBarrierBit>(allocSize));
+            Assert(freeListOffset == GetFreeObjectListOffset<WithBarrierBit>(allocSize));
+        }
+    }
+    else
+#else
+    Assert(!withBarrier);
+#endif
+    {
+        allocatorAddress = heapBucketGroupAddress
+            + HeapBucketGroup<SmallAllocationBlockAttributes>::GetHeapBucketOffset()
+            + HeapBucketT<SmallNormalHeapBlockT<SmallAllocationBlockAttributes>>::GetAllocatorHeadOffset();
+
+        endAddressOffset = SmallHeapBlockAllocator<SmallNormalHeapBlockT<SmallAllocationBlockAttributes>>::GetEndAddressOffset();
+        freeListOffset = SmallHeapBlockAllocator<SmallNormalHeapBlockT<SmallAllocationBlockAttributes>>::GetFreeObjectListOffset();
+
+        if (!isOOPJIT)
+        {
+            Assert(allocatorAddress == GetAddressOfAllocator<NoBit>(allocSize));
+            Assert(endAddressOffset == GetEndAddressOffset<NoBit>(allocSize));
+            Assert(freeListOffset == GetFreeObjectListOffset<NoBit>(allocSize));
+        }
+    }
 
     if (!isOOPJIT)
     {
-        Assert(allocatorAddress == GetAddressOfAllocator<NoBit>(allocSize));
-        Assert(endAddressOffset == GetEndAddressOffset<NoBit>(allocSize));
-        Assert(freeListOffset == GetFreeObjectListOffset<NoBit>(allocSize));
         Assert(allowBumpAllocation == AllowNativeCodeBumpAllocation());
     }
 
@@ -2348,8 +2400,12 @@ Recycler::ResetMarkCollectionState()
     // If we aborted after doing a background parallel Mark, we wouldn't have cleaned up the
     // parallel markContexts yet. Clean these up now.
     // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < parallelMarkerCount; i++)
+    {
+        parallelMarkers[i]->markContext.Cleanup();
+    }
+#endif
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2453,7 +2509,7 @@ Recycler::RescanMark(DWORD waitTime)
             Assert(collectionState == CollectionStateRescanWait);
             collectionState = CollectionStateRescanFindRoots;
 #ifdef RECYCLER_WRITE_WATCH
-            if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+            if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
             {
                 Assert(recyclerPageAllocator.GetWriteWatchPageCount() == 0);
                 Assert(recyclerLargeBlockPageAllocator.GetWriteWatchPageCount() == 0);
@@ -2496,7 +2552,7 @@ Recycler::FinishMark(DWORD waitTime)
 
             ProcessTrackedObjects();
 #ifdef RECYCLER_WRITE_WATCH
-            if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+            if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
             {
                 Assert(this->backgroundFinishMarkCount == 0 ||
                     (this->recyclerPageAllocator.GetWriteWatchPageCount() == 0 &&
@@ -2517,14 +2573,20 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism - 2 <= this->parallelMarkerCount);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
+    // The first split goes to this thread, the rest go to the parallel markers.
+    MarkContext * splitContexts[MarkContext::MaxSplitTargets];
+    splitContexts[0] = &parallelMarkContext1;
+    for (uint i = 0; i < this->maxParallelism - 2; i++)
+    {
+        splitContexts[i + 1] = &parallelMarkers[i]->markContext;
+    }
     uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount <= this->maxParallelism - 1);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2542,21 +2604,15 @@ Recycler::DoParallelMark()
         StartQueueTrackedObject();
     }
 
+    bool workStealing = StartParallelMarkWorkStealing();
+
     // Kick off marking on the background thread
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
     // If there's enough work to split, then kick off marking on parallel threads too.
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
-    {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
-        {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
-        }
-    }
+    uint parallelMarkerUsedCount = actualSplitCount - 1;
+    uint parallelSuccessCount = concurrentSuccess ? StartParallelThreads(parallelMarkerUsedCount) : 0;
 
     // Process our portion of the split.
     this->ProcessParallelMark(false, &parallelMarkContext1);
@@ -2572,28 +2628,11 @@ Recycler::DoParallelMark()
         this->ProcessParallelMark(false, &markContext);
     }
 
-    if (actualSplitCount >= 2)
-    {
-        if (parallelSuccess1)
-        {
-            parallelThread1.WaitForConcurrent();
-        }
-        else
-        {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
+    FinishParallelThreads(false, parallelSuccessCount, parallelMarkerUsedCount);
 
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
-        }
+    if (workStealing)
+    {
+        StopParallelMarkWorkStealing();
     }
 
     this->collectionState = CollectionStateMark;
@@ -2621,19 +2660,23 @@ Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // The calling thread isn't part of a background mark, so we split into the parallel markers only.
     uint actualSplitCount = 0;
-    MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[MarkContext::MaxSplitTargets];
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism - 2 <= this->parallelMarkerCount);
         if (this->maxParallelism > 2)
         {
+            for (uint i = 0; i < this->maxParallelism - 2; i++)
+            {
+                splitContexts[i] = &parallelMarkers[i]->markContext;
+            }
             actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
         }
     }
 
-    Assert(actualSplitCount <= 2);
+    Assert(actualSplitCount <= this->parallelMarkerCount);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2651,43 +2694,135 @@ Recycler::DoBackgroundParallelMark()
 
     this->collectionState = CollectionStateBackgroundParallelMark;
 
+    bool workStealing = StartParallelMarkWorkStealing();
+
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    parallelSuccess1 = parallelThread1.StartConcurrent();
-    if (parallelSuccess1 && actualSplitCount == 2)
-    {
-        parallelSuccess2 = parallelThread2.StartConcurrent();
-    }
+    uint parallelSuccessCount = StartParallelThreads(actualSplitCount);
 
     // Process our portion of the split.
     this->ProcessParallelMark(true, &markContext);
 
-    // If we successfully launched parallel work, wait for it to complete.
-    // If we failed, then process the work in-thread now.
-    if (parallelSuccess1)
+    FinishParallelThreads(true, parallelSuccessCount, actualSplitCount);
+
+    if (workStealing)
     {
-        parallelThread1.WaitForConcurrent();
+        StopParallelMarkWorkStealing();
     }
-    else
+
+    this->collectionState = CollectionStateConcurrentMark;
+}
+
+uint
+Recycler::StartParallelThreads(uint count)
+{
+    Assert(count <= this->parallelMarkerCount);
+
+    // Stop at the first thread that fails to start; the caller marks the remaining contexts itself
+    uint startedCount = 0;
+    while (startedCount < count && parallelMarkers[startedCount]->thread.StartConcurrent())
     {
-        this->ProcessParallelMark(true, &parallelMarkContext2);
+        startedCount++;
     }
+    return startedCount;
+}
 
-    if (actualSplitCount == 2)
+void
+Recycler::FinishParallelThreads(bool background, uint startedCount, uint count)
+{
+    Assert(startedCount <= count && count <= this->parallelMarkerCount);
+
+    // Process the splits whose thread failed to start in-thread, then wait for the rest to complete.
+    for (uint i = startedCount; i < count; i++)
     {
-        if (parallelSuccess2)
-        {
-            parallelThread2.WaitForConcurrent();
-        }
-        else
+        this->ProcessParallelMark(background, &parallelMarkers[i]->markContext);
+    }
+
+    for (uint i = 0; i < startedCount; i++)
+    {
+        parallelMarkers[i]->thread.WaitForConcurrent();
+    }
+}
+
+bool
+Recycler::InitializeParallelMarkers()
+{
+    Assert(this->parallelMarkers == nullptr);
+
+    if (this->maxParallelism <= 2)
+    {
+        return true;
+    }
+
+    uint count = this->maxParallelism - 2;
+    this->parallelMarkers = HeapNewNoThrowArrayZ(RecyclerParallelMarker *, count);
+    if (this->parallelMarkers == nullptr)
+    {
+        return false;
+    }
+
+    for (uint i = 0; i < count; i++)
+    {
+        RecyclerParallelMarker * parallelMarker = HeapNewNoThrow(RecyclerParallelMarker, this, GetRecyclerFlagsTable());
+        if (parallelMarker == nullptr)
         {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
+            for (uint j = 0; j < i; j++)
+            {
+                HeapDelete(this->parallelMarkers[j]);
+            }
+            HeapDeleteArray(count, this->parallelMarkers);
+            this->parallelMarkers = nullptr;
+            return false;
         }
+
+#ifdef RECYCLER_MARK_TRACK
+        parallelMarker->markContext.SetMarkMap(markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        parallelMarker->markContext.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+        this->parallelMarkers[i] = parallelMarker;
     }
 
-    this->collectionState = CollectionStateConcurrentMark;
+    this->parallelMarkerCount = count;
+    return true;
+}
+
+void
+Recycler::ShutdownParallelThreads(uint count)
+{
+    Assert(count <= this->parallelMarkerCount);
+
+    for (uint i = 0; i < count; i++)
+    {
+        parallelMarkers[i]->thread.Shutdown();
+    }
+}
+
+bool
+Recycler::StartParallelMarkWorkStealing()
+{
+    if (CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkStealPhase))
+    {
+        return false;
+    }
+
+    // Contexts that end up processed serially (because their thread failed to start) simply find nobody
+    // left to steal from, so it is fine to hook all of them up front.
+    parallelMarkWorkPool.Start();
+    markContext.SetWorkPool(&parallelMarkWorkPool);
+    ForEachParallelMarkContext([&](MarkContext * context) { context->SetWorkPool(&parallelMarkWorkPool); });
+    return true;
+}
+
+void
+Recycler::StopParallelMarkWorkStealing()
+{
+    markContext.SetWorkPool(nullptr);
+    ForEachParallelMarkContext([](MarkContext * context) { context->SetWorkPool(nullptr); });
+    parallelMarkWorkPool.Stop();
+
+    CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::ParallelMarkStealPhase, _u("Parallel mark stole %u chunks\n"), parallelMarkWorkPool.GetStealCount());
 }
 #endif
 
@@ -2805,15 +2940,12 @@ Recycler::EndMark()
     // Clean up mark contexts, which will release held free pages
     // Do this for all contexts before we decommit, to make sure all pages are freed
     markContext.Cleanup();
-    parallelMarkContext1.Cleanup();
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    ForEachParallelMarkContext([](MarkContext * context) { context->Cleanup(); });
 
     // Decommit all pages
     markContext.DecommitPages();
-    parallelMarkContext1.DecommitPages();
-    parallelMarkContext2.DecommitPages();
-    parallelMarkContext3.DecommitPages();
+    ForEachParallelMarkContext([](MarkContext * context) { context->DecommitPages(); });
+    parallelMarkWorkPool.DecommitPages();
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2903,9 +3035,12 @@ Recycler::EndMarkOnLowMemory()
     while (this->NeedOOMRescan());
 
     Assert(!markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+#if DBG
+    ForEachParallelMarkContext([](MarkContext * context)
+    {
+        Assert(!context->GetPageAllocator()->DisableAllocationOutOfMemory());
+    });
+#endif
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2930,10 +3065,50 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    bool isEmpty = markContext.IsEmpty();
+    ForEachParallelMarkContext([&](MarkContext * context) { isEmpty = isEmpty && context->IsEmpty(); });
+    return isEmpty;
 }
 #endif
 
+bool
+Recycler::HasPendingMarkObjects() const
+{
+    if (markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects())
+    {
+        return true;
+    }
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < parallelMarkerCount; i++)
+    {
+        if (parallelMarkers[i]->markContext.HasPendingMarkObjects())
+        {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+bool
+Recycler::HasPendingTrackObjects() const
+{
+    if (markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects())
+    {
+        return true;
+    }
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < parallelMarkerCount; i++)
+    {
+        if (parallelMarkers[i]->markContext.HasPendingTrackObjects())
+        {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
 #ifdef HEAP_ENUMERATION_VALIDATION
 void
 Recycler::PostHeapEnumScan(PostHeapEnumScanCallback callback, void *data)
@@ -3049,7 +3224,7 @@ Recycler::Sweep(bool concurrent)
             if (this->inPartialCollectMode)
             {
 #ifdef RECYCLER_WRITE_WATCH
-                if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+                if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
                 {
                     RECYCLER_PROFILE_EXEC_BEGIN(this, Js::ResetWriteWatchPhase);
                     if (!recyclerPageAllocator.ResetWriteWatch() || !recyclerLargeBlockPageAllocator.ResetWriteWatch())
@@ -3862,9 +4037,7 @@ Recycler::DoCollect(CollectionFlags flags)
         Assert(this->backgroundFinishMarkCount == 0);
 #endif
 
-#if DBG
         collectionCount++;
-#endif
         collectionState = Collection_PreCollection;
         collectionWrapper->PreCollectionCallBack(flags);
         collectionState = CollectionStateNotCollecting;
@@ -4240,7 +4413,7 @@ Recycler::BackgroundRescan(RescanFlags rescanFlags)
     RECYCLER_PROFILE_EXEC_BACKGROUND_BEGIN(this, Js::BackgroundRescanPhase);
 
 #if GLOBAL_ENABLE_WRITE_BARRIER
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
     {
         pendingWriteBarrierBlockMap.LockResize();
         pendingWriteBarrierBlockMap.Map([](void* address, size_t size)
@@ -4357,9 +4530,7 @@ Recycler::ProcessTrackedObjects()
 
     // If we did a parallel mark, we need to process any queued tracked objects from the parallel mark stack as well.
     // If we didn't, this will do nothing.
-    parallelMarkContext1.ProcessTracked();
-    parallelMarkContext2.ProcessTracked();
-    parallelMarkContext3.ProcessTracked();
+    ForEachParallelMarkContext([](MarkContext * context) { context->ProcessTracked(); });
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4862,8 +5033,7 @@ Recycler::FinalizeConcurrent(bool restoreState)
 
     // Shutdown parallel threads and return the handle for them so the caller can
     // close it.
-    parallelThread1.Shutdown();
-    parallelThread2.Shutdown();
+    ShutdownParallelThreads(parallelMarkerCount);
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -4937,32 +5107,18 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     else
     {
         bool startConcurrentThread = true;
-        bool startedParallelThread1 = false;
-        bool startedParallelThread2 = false;
+        uint startedParallelThreadCount = 0;
 
-        if (startAllThreads)
+        if (startAllThreads && this->enableParallelMark)
         {
-            if (this->enableParallelMark && this->maxParallelism > 2)
+            while (startedParallelThreadCount < parallelMarkerCount)
             {
-                if (!parallelThread1.EnableConcurrent(true))
+                if (!parallelMarkers[startedParallelThreadCount]->thread.EnableConcurrent(true))
                 {
                     startConcurrentThread = false;
+                    break;
                 }
-                else
-                {
-                    startedParallelThread1 = true;
-                    if (this->maxParallelism > 3)
-                    {
-                        if (!parallelThread2.EnableConcurrent(true))
-                        {
-                            startConcurrentThread = false;
-                        }
-                        else
-                        {
-                            startedParallelThread2 = true;
-                        }
-                    }
-                }
+                startedParallelThreadCount++;
             }
         }
 
@@ -4985,14 +5141,7 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
             }
         }
 
-        if (startedParallelThread1)
-        {
-            parallelThread1.Shutdown();
-            if (startedParallelThread2)
-            {
-                parallelThread2.Shutdown();
-            }
-        }
+        ShutdownParallelThreads(startedParallelThreadCount);
     }
 
     // We failed to start a concurrent thread so we set these back to false and clean up
@@ -5103,7 +5252,7 @@ Recycler::StartBackgroundMark(bool foregroundResetMark, bool foregroundFindRoots
     {
         // REVIEW: SWB, if there's only write barrier page change, we don't scan and mark?
 #ifdef RECYCLER_WRITE_WATCH
-        if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+        if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
         {
             RECYCLER_PROFILE_EXEC_BEGIN(this, Js::ResetWriteWatchPhase);
             bool hasWriteWatch = (recyclerPageAllocator.ResetWriteWatch() && recyclerLargeBlockPageAllocator.ResetWriteWatch());
@@ -6344,6 +6493,13 @@ Recycler::ShouldIdleCollectOnExit()
 }
 
 #if ENABLE_CONCURRENT_GC
+RecyclerParallelMarker::RecyclerParallelMarker(Recycler * recycler, Js::ConfigFlagsTable& flagsTable) :
+    pagePool(flagsTable),
+    markContext(recycler, &this->pagePool),
+    thread(recycler, &Recycler::ParallelWorkFunc, &this->markContext)
+{
+}
+
 bool
 RecyclerParallelThread::StartConcurrent()
 {
@@ -6439,14 +6595,9 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(MarkContext * markContext)
 {
-    Assert(parallelId == 0 || parallelId == 1);
-
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
-
     switch (this->collectionState)
     {
         case CollectionStateParallelMark:
@@ -6563,7 +6714,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            (recycler->*workFunc)(parallelThread->markContext);
 
             // We always wait after the first time
             mustWait = true;
@@ -6602,7 +6753,7 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
     Recycler * recycler = parallelThread->recycler;
     RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    (recycler->*workFunc)(parallelThread->markContext);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
@@ -7050,6 +7201,8 @@ Recycler::PrintMemoryStats()
         , collectionStats.numEmptySmallBlocks[HeapBlock::SmallLeafBlockType]
         + collectionStats.numEmptySmallBlocks[HeapBlock::MediumLeafBlockType],
         collectionStats.numZeroedOutSmallBlocks);
+    Output::Print(_u("Bytes reclaimed from empty blocks: %d\nNumber of sparse blocks allocated from last: %d\n"),
+        collectionStats.smallBlockReclaimedByteCount, collectionStats.numSparseSmallBlocks);
 }
 
 void
@@ -8627,7 +8780,7 @@ Recycler::NotifyFree(__in char *address, size_t size)
 void
 Recycler::RegisterPendingWriteBarrierBlock(void* address, size_t bytes)
 {
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
     {
 #if DBG
         WBSetBitRange((char*)address, (uint)bytes/sizeof(void*));
@@ -8639,7 +8792,7 @@ Recycler::RegisterPendingWriteBarrierBlock(void* address, size_t bytes)
 void
 Recycler::UnRegisterPendingWriteBarrierBlock(void* address)
 {
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
     {
         pendingWriteBarrierBlockMap.Remove(address);
     }
@@ -8666,7 +8819,7 @@ Recycler::WBVerifyBitIsSet(char* addr, char* target)
 void
 Recycler::WBSetBit(char* addr)
 {
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(VerifyBarrierBit))
     {
         AutoCriticalSection lock(&recyclerListLock);
         Recycler* recycler = Recycler::recyclerList;
@@ -8685,7 +8838,7 @@ Recycler::WBSetBit(char* addr)
 void
 Recycler::WBSetBitRange(char* addr, uint count)
 {
-    if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(VerifyBarrierBit))
+    if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && CONFIG_FLAG(VerifyBarrierBit))
     {
         AutoCriticalSection lock(&recyclerListLock);
         Recycler* recycler = Recycler::recyclerList;
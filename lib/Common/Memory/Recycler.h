@@ -516,6 +516,8 @@ struct RecyclerCollectionStats
     // Empty/zero heap block stats
     uint numEmptySmallBlocks[HeapBlock::SmallBlockTypeCount];
     uint numZeroedOutSmallBlocks;
+    size_t smallBlockReclaimedByteCount;    // Pages of the empty blocks
+    uint numSparseSmallBlocks;              // Allocable blocks moved to the end of their bucket's list
 };
 #define RECYCLER_STATS_INC_IF(cond, r, f) if (cond) { RECYCLER_STATS_INC(r, f); }
 #define RECYCLER_STATS_INC(r, f) ++r->collectionStats.f
@@ -561,11 +563,12 @@ struct CollectionParam
 class RecyclerParallelThread
 {
 public:
-    typedef void (Recycler::* WorkFunc)();
+    typedef void (Recycler::* WorkFunc)(MarkContext * markContext);
 
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
+    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc, MarkContext * markContext) :
         recycler(recycler),
         workFunc(workFunc),
+        markContext(markContext),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
@@ -594,11 +597,24 @@ class RecyclerParallelThread
 private:
     WorkFunc workFunc;
     Recycler * recycler;
+    MarkContext * markContext;
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
     bool synchronizeOnStartup;
 };
+
+// A parallel mark thread along with the mark context and page pool it marks with.
+// The recycler creates maxParallelism - 2 of these; the calling thread and the concurrent thread make up the rest.
+class RecyclerParallelMarker
+{
+public:
+    RecyclerParallelMarker(Recycler * recycler, Js::ConfigFlagsTable& flagsTable);
+
+    PagePool pagePool;
+    MarkContext markContext;
+    RecyclerParallelThread thread;
+};
 #endif
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -624,6 +640,7 @@ class Recycler
     friend class HeapBlockMap32;
 #if ENABLE_CONCURRENT_GC
     friend class RecyclerParallelThread;
+    friend class RecyclerParallelMarker;
 #endif
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     friend class AutoProtectPages;
@@ -822,20 +839,37 @@ class Recycler
     MarkContext markContext;
 
     // Contexts for parallel marking.
-    // We support up to 4 way parallelism, main context + 3 additional parallel contexts.
+    // The calling thread marks with parallelMarkContext1 while the concurrent thread marks with markContext.
+    // Any further parallelism comes from parallelMarkers, each of which owns its own context.
     MarkContext parallelMarkContext1;
-    MarkContext parallelMarkContext2;
-    MarkContext parallelMarkContext3;
 
     // Page pools for above markContexts
     PagePool markPagePool;
     PagePool parallelMarkPagePool1;
-    PagePool parallelMarkPagePool2;
-    PagePool parallelMarkPagePool3;
+
+#if ENABLE_CONCURRENT_GC
+    RecyclerParallelMarker ** parallelMarkers;
+    uint parallelMarkerCount;
+#endif
+
+    // Balances the work between the parallel mark contexts once their initial split runs out
+    ParallelMarkWorkPool parallelMarkWorkPool;
+
+    template <class Fn>
+    void ForEachParallelMarkContext(Fn fn)
+    {
+        fn(&parallelMarkContext1);
+#if ENABLE_CONCURRENT_GC
+        for (uint i = 0; i < parallelMarkerCount; i++)
+        {
+            fn(&parallelMarkers[i]->markContext);
+        }
+#endif
+    }
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const;
+    bool HasPendingTrackObjects() const;
 
     RecyclerCollectionWrapper * collectionWrapper;
 
@@ -887,9 +921,7 @@ class Recycler
 
     bool inDispose;
 
-#if DBG
     uint collectionCount;
-#endif
 #if DBG || defined RECYCLER_TRACE
     bool inResolveExternalWeakReferences;
 #endif
@@ -967,11 +999,12 @@ class Recycler
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
-    template <uint parallelId>
-    void ParallelWorkFunc();
+    void ParallelWorkFunc(MarkContext * markContext);
 
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
+    bool InitializeParallelMarkers();
+    uint StartParallelThreads(uint count);
+    void FinishParallelThreads(bool background, uint startedCount, uint count);
+    void ShutdownParallelThreads(uint count);
 
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
@@ -1311,6 +1344,7 @@ class Recycler
     template<typename T>
     RecyclerWeakReference<T>* CreateWeakReferenceHandle(T* pStrongReference);
     uint GetWeakReferenceCleanupId() const { return weakReferenceCleanupId; }
+    uint GetCollectionCount() const { return collectionCount; }
 
     template<typename T>
     bool FindOrCreateWeakReferenceHandle(T* pStrongReference, RecyclerWeakReference<T> **ppWeakRef);
@@ -1339,8 +1373,8 @@ class Recycler
         return this->autoHeap.GetBucket<attributes>(sizeCat).GetAllocator()->GetFreeObjectListOffset();
     }
 
-    void GetNormalHeapBlockAllocatorInfoForNativeAllocation(size_t sizeCat, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT);
-    static void GetNormalHeapBlockAllocatorInfoForNativeAllocation(void* recyclerAddr, size_t sizeCat, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT);
+    void GetNormalHeapBlockAllocatorInfoForNativeAllocation(size_t sizeCat, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT, bool withBarrier = false);
+    static void GetNormalHeapBlockAllocatorInfoForNativeAllocation(void* recyclerAddr, size_t sizeCat, void*& allocatorAddress, uint32& endAddressOffset, uint32& freeListOffset, bool allowBumpAllocation, bool isOOPJIT, bool withBarrier = false);
     bool AllowNativeCodeBumpAllocation();
     static void TrackNativeAllocatedMemoryBlock(Recycler * recycler, void * memBlock, size_t sizeCat);
 
@@ -1546,6 +1580,8 @@ class Recycler
 #if ENABLE_CONCURRENT_GC
     void DoParallelMark();
     void DoBackgroundParallelMark();
+    bool StartParallelMarkWorkStealing();
+    void StopParallelMarkWorkStealing();
 #endif
 
     size_t RootMark(CollectionState markState);
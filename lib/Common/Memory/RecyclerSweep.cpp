@@ -199,7 +199,7 @@ RecyclerSweep::FinishSweep()
             GCETW(GC_SWEEP_PARTIAL_REUSE_PAGE_STOP, (recycler));
 
 #ifdef RECYCLER_WRITE_WATCH
-            if (!CONFIG_FLAG(ForceSoftwareWriteBarrier))
+            if (!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
             {
                 if (!this->IsBackground())
                 {
@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+namespace Memory
+{
+    // xplat: out-of-bounds accesses to virtual buffers are recovered from the SIGSEGV handler, which
+    // must not take locks. Address ranges the handler needs to recognise are kept in a fixed table of
+    // words, so it can search them with plain reads.
+    //
+    // TTraits packs a range into a single non-zero word (Encode, which returns 0 if the range can't be
+    // packed), and unpacks the range's base address (GetBase) and size (GetSize).
+    template <typename TTraits, uint MaxEntries>
+    class SignalSafeRangeTable
+    {
+    public:
+        static bool Add(void* address, size_t size)
+        {
+            uintptr_t entry = TTraits::Encode(address, size);
+            if (entry == 0)
+            {
+                return false;
+            }
+
+            for (uint i = 0; i < MaxEntries; i++)
+            {
+                if (InterlockedCompareExchangePointer((PVOID *)&entries[i], (PVOID)entry, nullptr) == nullptr)
+                {
+                    // The slot is published before the mark moves past it, so Find never reads a
+                    // slot that is still being filled in
+                    uint mark = highWaterMark;
+                    while (mark <= i)
+                    {
+                        uint prev = (uint)InterlockedCompareExchange((LONG volatile *)&highWaterMark, (LONG)(i + 1), (LONG)mark);
+                        if (prev == mark)
+                        {
+                            break;
+                        }
+                        mark = prev;
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Returns false if no range added to the table starts at the address
+        static bool Remove(void* address)
+        {
+            uint count = highWaterMark;
+            for (uint i = 0; i < count; i++)
+            {
+                uintptr_t entry = entries[i];
+                if (entry != 0 && TTraits::GetBase(entry) == (uintptr_t)address)
+                {
+                    InterlockedExchangePointer((PVOID *)&entries[i], nullptr);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Returns the size of the range containing the address, or 0. Async-signal-safe.
+        static size_t Find(uintptr_t address)
+        {
+            uint count = highWaterMark;
+            for (uint i = 0; i < count; i++)
+            {
+                uintptr_t entry = entries[i];
+                if (entry == 0)
+                {
+                    continue;
+                }
+                uintptr_t base = TTraits::GetBase(entry);
+                size_t size = TTraits::GetSize(entry);
+                if (address >= base && address - base < size)
+                {
+                    return size;
+                }
+            }
+            return 0;
+        }
+
+    private:
+        static uintptr_t volatile entries[MaxEntries];
+        static uint volatile highWaterMark;
+    };
+
+    template <typename TTraits, uint MaxEntries>
+    uintptr_t volatile SignalSafeRangeTable<TTraits, MaxEntries>::entries[MaxEntries];
+
+    template <typename TTraits, uint MaxEntries>
+    uint volatile SignalSafeRangeTable<TTraits, MaxEntries>::highWaterMark = 0;
+}
+#endif
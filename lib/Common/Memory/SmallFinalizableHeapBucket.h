@@ -400,6 +400,9 @@ class HeapBucketGroup
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
     void FinalizeAllObjects();
     static unsigned int GetHeapBucketOffset() { return offsetof(HeapBucketGroup<TBlockAttributes>, heapBucket); }
+#ifdef RECYCLER_WRITE_BARRIER
+    static unsigned int GetWithBarrierHeapBucketOffset() { return offsetof(HeapBucketGroup<TBlockAttributes>, smallNormalWithBarrierHeapBucket); }
+#endif
 
 #if DBG || defined(RECYCLER_SLOW_CHECK_ENABLED)
     size_t GetNonEmptyHeapBlockCount(bool checkCount) const;
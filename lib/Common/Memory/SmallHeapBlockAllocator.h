@@ -104,7 +104,7 @@ SmallHeapBlockAllocator<TBlockType>::InlinedAllocImpl(Recycler * recycler, DECLS
 {
     Assert((attributes & InternalObjectInfoBitMask) == attributes);
 #ifdef RECYCLER_WRITE_BARRIER
-    Assert(!CONFIG_FLAG(ForceSoftwareWriteBarrier) || (attributes & WithBarrierBit) || (attributes & LeafBit));
+    Assert(!CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() || (attributes & WithBarrierBit) || (attributes & LeafBit));
 #endif
 
     AUTO_NO_EXCEPTION_REGION;
@@ -11,6 +11,10 @@ namespace PlatformAgnostic
     public:
         static bool GetMaxVirtualMemory(size_t *totalAS);
 
+        // Gets the time all processors have spent idle and in total since boot, in platform specific units. Only the ratio of
+        // the differences between two calls is meaningful. Returns false if not supported.
+        static bool GetSystemCpuTimes(ULONGLONG *idleTime, ULONGLONG *totalTime);
+
 #define SET_BINARY_PATH_ERROR_MESSAGE(path, msg) \
     str_len = (int) strlen(msg);                 \
     memcpy(path, msg, (size_t)str_len);          \
@@ -22,5 +22,12 @@ class Thread
                                unsigned int ( *start_address )( void * ),
                                void* arg_list,
                                ThreadInitFlag init_flag);
+
+#ifndef _WIN32
+    // Parks the calling thread while *address holds compareValue, until another thread changes it and calls
+    // WakeAddressWaiters, or timeoutMs (INFINITE waits forever) runs out. Returns false if the value never changed.
+    static bool WaitForAddressChange(volatile int32_t *address, int32_t compareValue, uint32_t timeoutMs);
+    static void WakeAddressWaiters(volatile int32_t *address, int32_t count);
+#endif
 };
 } // namespace PlatformAgnostic
@@ -78,7 +78,7 @@ typedef unsigned char boolean;
 #define __JITTypes_h__
 
 // TODO: OOP JIT, how do we make this better?
-const int VTABLE_COUNT = 49;
+const int VTABLE_COUNT = 50;
 const int EQUIVALENT_TYPE_CACHE_SIZE = 8;
 
 typedef IDL_DEF([context_handle]) void * PTHREADCONTEXT_HANDLE;
@@ -613,6 +613,7 @@ typedef struct FunctionBodyDataIDL
     CHAKRA_PTR nestedFuncArrayAddr;
     CHAKRA_PTR auxDataBufferAddr;
     CHAKRA_PTR objectLiteralTypesAddr;
+    CHAKRA_PTR objectLiteralSitesAddr;
     CHAKRA_PTR formalsPropIdArrayAddr;
     CHAKRA_PTR forInCacheArrayAddr;
 } FunctionBodyDataIDL;
@@ -565,6 +565,60 @@ CHAKRA_API
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
 
+/// <summary>
+///     Sets the directory of the byte code cache used by <c>JsParse</c> and <c>JsRun</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     When a cache directory is set, <c>JsRun</c> serializes each script after it ran successfully
+///     and stores the byte code in the directory, keyed by a hash of the script source. Later calls
+///     to <c>JsParse</c> or <c>JsRun</c> with the same source, in this or any other runtime using
+///     the directory, map the stored byte code instead of parsing the script.
+///     </para>
+///     <para>
+///     Only scripts given as a string or as a UTF8 ExternalArrayBuffer without other parse
+///     attributes are cached. Entries written by a different engine version are ignored and
+///     replaced. The directory must exist and be writable.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to set the cache directory for.</param>
+/// <param name="directory">The cache directory (UTF8), or null to stop using the cache.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeByteCodeCacheDirectory(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_z_ const char *directory);
+
+/// <summary>
+///     Sets the directory of the dynamic profile cache of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     When a cache directory is set, the type and call site profile collected for each script
+///     with a url is stored in the directory when its script context is disposed. The next time
+///     a script with the same url is run, in this or any other runtime using the directory, its
+///     functions start out with the stored profile and skip the profiling tiers on their way to
+///     the optimizing JIT.
+///     </para>
+///     <para>
+///     Functions that no longer match the stored profile collect a new one. Entries written by
+///     a different engine version are ignored and replaced. The directory must exist and be
+///     writable. Set the directory before creating script contexts in the runtime: contexts
+///     created before that do not store their profile.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to set the cache directory for.</param>
+/// <param name="directory">The cache directory (UTF8), or null to stop using the cache.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeProfileCacheDirectory(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_z_ const char *directory);
+
 /// <summary>
 ///     Creates a new JavaScript Promise object.
 /// </summary>
@@ -945,5 +999,60 @@ CHAKRA_API
         _In_ JsValueRef object,
         _In_ JsValueRef key,
         _Out_ bool *hasOwnProperty);
+
+/// <summary>
+///     Creates a new object with the given properties.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The properties are defined in order as own enumerable, writable and configurable data
+///     properties, as in an object literal. Setters on the prototype are not called. The object is
+///     allocated with room for the properties, and objects created with the same property IDs in
+///     the same order share their type.
+///     </para>
+/// </remarks>
+/// <param name="propertyIds">The IDs of the properties.</param>
+/// <param name="values">The values of the properties.</param>
+/// <param name="propertyCount">The number of properties.</param>
+/// <param name="object">The new object.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateObjectWithProperties(
+        _In_reads_(propertyCount) const JsPropertyIdRef *propertyIds,
+        _In_reads_(propertyCount) const JsValueRef *values,
+        _In_ unsigned int propertyCount,
+        _Out_ JsValueRef *object);
+
+/// <summary>
+///     Gets several properties of an object.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Equivalent to calling <c>JsGetProperty</c> for each property ID in order, without entering
+///     the script context once per property. If a getter throws, the properties after it are not
+///     read and their values are left as <c>JS_INVALID_REFERENCE</c>.
+///     </para>
+/// </remarks>
+/// <param name="object">The object that contains the properties.</param>
+/// <param name="propertyIds">The IDs of the properties.</param>
+/// <param name="propertyCount">The number of properties.</param>
+/// <param name="values">The values of the properties.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetProperties(
+        _In_ JsValueRef object,
+        _In_reads_(propertyCount) const JsPropertyIdRef *propertyIds,
+        _In_ unsigned int propertyCount,
+        _Out_writes_(propertyCount) JsValueRef *values);
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
@@ -7,6 +7,8 @@
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
 #include "jsrtHelper.h"
+#include "JsrtByteCodeCache.h"
+#include "Language/DynamicProfileCache.h"
 
 #include "JsrtSourceHolder.h"
 #include "ByteCode/ByteCodeSerializer.h"
@@ -1674,6 +1676,80 @@ CHAKRA_API JsObjectSetProperty(_In_ JsValueRef object, _In_ JsValueRef propertyI
 }
 #endif
 
+#ifdef _CHAKRACOREBUILD
+CHAKRA_API JsCreateObjectWithProperties(_In_reads_(propertyCount) const JsPropertyIdRef *propertyIds,
+    _In_reads_(propertyCount) const JsValueRef *values, _In_ unsigned int propertyCount, _Out_ JsValueRef *object)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        PARAM_NOT_NULL(object);
+        *object = nullptr;
+        if (propertyCount != 0)
+        {
+            PARAM_NOT_NULL(propertyIds);
+            PARAM_NOT_NULL(values);
+        }
+
+        for (unsigned int i = 0; i < propertyCount; i++)
+        {
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+            VALIDATE_JSREF(values[i]);
+        }
+
+        // Start from the library's object literal type with room for the properties inline, like an object literal
+        // without a cached type. Adding the same properties in the same order then follows the same type path, so
+        // these objects share their types and the properties don't need auxiliary slots.
+        const Js::PropertyIndex inlineSlotCapacity = static_cast<Js::PropertyIndex>(
+            min(propertyCount, static_cast<unsigned int>(MaxPreInitializedObjectTypeInlineSlotCount)));
+        Js::DynamicObject * instance = scriptContext->GetLibrary()->CreateObject(true, inlineSlotCapacity);
+
+        for (unsigned int i = 0; i < propertyCount; i++)
+        {
+            JsValueRef value = values[i];
+            VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+
+            Js::JavascriptOperators::InitProperty(instance, ((const Js::PropertyRecord *)propertyIds[i])->GetPropertyId(), value);
+        }
+
+        *object = instance;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetProperties(_In_ JsValueRef object, _In_reads_(propertyCount) const JsPropertyIdRef *propertyIds,
+    _In_ unsigned int propertyCount, _Out_writes_(propertyCount) JsValueRef *values)
+{
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&] (Js::ScriptContext *scriptContext,
+        TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+        if (propertyCount != 0)
+        {
+            PARAM_NOT_NULL(propertyIds);
+            PARAM_NOT_NULL(values);
+        }
+
+        for (unsigned int i = 0; i < propertyCount; i++)
+        {
+            values[i] = JS_INVALID_REFERENCE;
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+        }
+
+        Js::RecyclableObject * instance = Js::RecyclableObject::FromVar(object);
+        for (unsigned int i = 0; i < propertyCount; i++)
+        {
+            values[i] = Js::JavascriptOperators::GetPropertyNoCache(instance,
+                ((const Js::PropertyRecord *)propertyIds[i])->GetPropertyId(), scriptContext);
+            Assert(!Js::CrossSite::NeedMarshalVar(values[i], scriptContext));
+        }
+
+        return JsNoError;
+    });
+}
+#endif
+
 CHAKRA_API JsHasProperty(_In_ JsValueRef object, _In_ JsPropertyIdRef propertyId, _Out_ bool *hasProperty)
 {
     VALIDATE_JSREF(object);
@@ -3382,10 +3458,57 @@ CHAKRA_API JsSetPromiseContinuationCallback(_In_opt_ JsPromiseContinuationCallba
     /*allowInObjectBeforeCollectCallback*/true);
 }
 
+// Serializes the byte code of a global function that was loaded with deferred parsing disabled,
+// see JsSerializeScriptCore for the buffer arguments
+static JsErrorCode SerializeScriptFunction(Js::ScriptContext *scriptContext, Js::JavascriptFunction *function,
+    DWORD dwFlags, unsigned char *buffer, unsigned int *bufferSize, unsigned char **allocatedBuffer)
+{
+    // Could we have a deserialized function in this case?
+    // If we are going to serialize it, a check isn't to expensive
+    if (CONFIG_FLAG(ForceSerialized) && function->GetFunctionProxy() != nullptr) {
+        function->GetFunctionProxy()->EnsureDeserialized();
+    }
+    Js::FunctionBody *functionBody = function->GetFunctionBody();
+    const Js::Utf8SourceInfo *sourceInfo = functionBody->GetUtf8SourceInfo();
+    size_t cSourceCodeLength = sourceInfo->GetCbLength(_u("JsSerializeScript"));
+
+    // truncation of code length can lead to accessing random memory. Reject the call.
+    if (cSourceCodeLength > DWORD_MAX)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    LPCUTF8 utf8Code = sourceInfo->GetSource(_u("JsSerializeScript"));
+
+    BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("ByteCodeSerializer"));
+    // We cast buffer size to DWORD* because on Windows, DWORD = unsigned long = unsigned int
+    // On 64-bit clang on linux, this is not true, unsigned long is larger than unsigned int
+    // However, the PAL defines DWORD for us on linux as unsigned int so the cast is safe here.
+    HRESULT hr = Js::ByteCodeSerializer::SerializeToBuffer(scriptContext,
+        tempAllocator, static_cast<DWORD>(cSourceCodeLength), utf8Code,
+        functionBody, functionBody->GetHostSrcInfo(), allocatedBuffer != nullptr,
+        allocatedBuffer != nullptr ? allocatedBuffer : &buffer,
+        (DWORD*) bufferSize, dwFlags);
+    END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+    if (SUCCEEDED(hr))
+    {
+        return JsNoError;
+    }
+    else
+    {
+        return JsErrorScriptCompile;
+    }
+}
+
+// If serializedBuffer is given, the script is compiled with deferred parsing disabled and its byte
+// code is serialized into a buffer allocated with CoTaskMemAlloc before it runs. *serializedBuffer is
+// left null if the script could not be serialized.
 JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb,
     LoadScriptFlag loadScriptFlag, JsSourceContext sourceContext,
     const WCHAR *sourceUrl, bool parseOnly, JsParseScriptAttributes parseAttributes,
-    bool isSourceModule, JsValueRef *result)
+    bool isSourceModule, JsValueRef *result,
+    unsigned char **serializedBuffer = nullptr, unsigned int *serializedBufferSize = nullptr)
 {
     Js::JavascriptFunction *scriptFunction;
     CompileScriptException se;
@@ -3430,6 +3553,12 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
         {
             loadScriptFlag = (LoadScriptFlag)(loadScriptFlag | LoadScriptFlag_Module);
         }
+        if (serializedBuffer != nullptr)
+        {
+            // The serialized byte code has to cover the nested functions and keep the result of the
+            // script for callers that ask for it
+            loadScriptFlag = (LoadScriptFlag)(loadScriptFlag | LoadScriptFlag_disableDeferredParse | LoadScriptFlag_Expression);
+        }
 
 #if ENABLE_TTD
         TTD::NSLogEvents::EventLogEntry* parseEvent = nullptr;
@@ -3495,6 +3624,15 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
             return JsErrorScriptCompile;
         }
 
+        if (serializedBuffer != nullptr)
+        {
+            // Serialize before the script runs, while its byte code is the one the parser generated
+            if (SerializeScriptFunction(scriptContext, scriptFunction, 0, nullptr, serializedBufferSize, serializedBuffer) != JsNoError)
+            {
+                *serializedBuffer = nullptr;
+            }
+        }
+
         if (parseOnly)
         {
             PARAM_NOT_NULL(result);
@@ -3612,9 +3750,12 @@ CHAKRA_API JsExperimentalApiRunModule(_In_z_ const WCHAR * script,
 }
 #endif
 
+// If allocatedBuffer is given, the byte code is serialized into a buffer allocated with
+// CoTaskMemAlloc and returned there, otherwise into buffer as large as *bufferSize
 JsErrorCode JsSerializeScriptCore(const byte *script, size_t cb,
     LoadScriptFlag loadScriptFlag, BYTE *functionTable, int functionTableSize,
-    unsigned char *buffer, unsigned int *bufferSize, JsValueRef scriptSource)
+    unsigned char *buffer, unsigned int *bufferSize, JsValueRef scriptSource,
+    unsigned char **allocatedBuffer = nullptr)
 {
     Js::JavascriptFunction *function;
     CompileScriptException se;
@@ -3680,45 +3821,11 @@ JsErrorCode JsSerializeScriptCore(const byte *script, size_t cb,
             HandleScriptCompileError(scriptContext, &se);
             return JsErrorScriptCompile;
         }
-        // Could we have a deserialized function in this case?
-        // If we are going to serialize it, a check isn't to expensive
-        if (CONFIG_FLAG(ForceSerialized) && function->GetFunctionProxy() != nullptr) {
-            function->GetFunctionProxy()->EnsureDeserialized();
-        }
-        Js::FunctionBody *functionBody = function->GetFunctionBody();
-        const Js::Utf8SourceInfo *sourceInfo = functionBody->GetUtf8SourceInfo();
-        size_t cSourceCodeLength = sourceInfo->GetCbLength(_u("JsSerializeScript"));
-
-        // truncation of code length can lead to accessing random memory. Reject the call.
-        if (cSourceCodeLength > DWORD_MAX)
-        {
-            return JsErrorOutOfMemory;
-        }
-
-        LPCUTF8 utf8Code = sourceInfo->GetSource(_u("JsSerializeScript"));
         DWORD dwFlags = 0;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         dwFlags = JsrtContext::GetCurrent()->GetRuntime()->IsSerializeByteCodeForLibrary() ? GENERATE_BYTE_CODE_BUFFER_LIBRARY : 0;
 #endif
-
-        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("ByteCodeSerializer"));
-        // We cast buffer size to DWORD* because on Windows, DWORD = unsigned long = unsigned int
-        // On 64-bit clang on linux, this is not true, unsigned long is larger than unsigned int
-        // However, the PAL defines DWORD for us on linux as unsigned int so the cast is safe here.
-        HRESULT hr = Js::ByteCodeSerializer::SerializeToBuffer(scriptContext,
-            tempAllocator, static_cast<DWORD>(cSourceCodeLength), utf8Code,
-            functionBody, functionBody->GetHostSrcInfo(), false, &buffer,
-            (DWORD*) bufferSize, dwFlags);
-        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
-
-        if (SUCCEEDED(hr))
-        {
-            return JsNoError;
-        }
-        else
-        {
-            return JsErrorScriptCompile;
-        }
+        return SerializeScriptFunction(scriptContext, function, dwFlags, buffer, bufferSize, allocatedBuffer);
     });
 }
 
@@ -3736,7 +3843,8 @@ JsErrorCode RunSerializedScriptCore(
     JsSourceContext scriptLoadSourceContext, // only used by scriptLoadCallback
     unsigned char *buffer, JsValueRef bufferVal,
     JsSourceContext sourceContext, const WCHAR *sourceUrl,
-    bool parseOnly, JsValueRef *result)
+    bool parseOnly, JsValueRef *result,
+    JsValueRef scriptVal = nullptr) // kept alive with the source holder, if given
 {
     Js::JavascriptFunction *function;
     JsErrorCode errorCode = ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
@@ -3753,7 +3861,7 @@ JsErrorCode RunSerializedScriptCore(
         PARAM_NOT_NULL(scriptUnloadCallback);
         typedef Js::JsrtSourceHolder<TLoadCallback, TUnloadCallback> TSourceHolder;
         sourceHolder = RecyclerNewFinalized(scriptContext->GetRecycler(), TSourceHolder,
-            scriptLoadCallback, scriptUnloadCallback, scriptLoadSourceContext, bufferVal);
+            scriptLoadCallback, scriptUnloadCallback, scriptLoadSourceContext, bufferVal, scriptVal);
 
         SourceContextInfo *sourceContextInfo;
         SRCINFO *hsi;
@@ -4743,6 +4851,79 @@ CHAKRA_API JsCopyString(
     return JsNoError;
 }
 
+static bool CHAKRA_CALLBACK ByteCodeCacheLoadScriptCallback(_In_ JsSourceContext sourceContext,
+    _Out_ JsValueRef *value, _Out_ JsParseScriptAttributes *parseAttributes)
+{
+    // sourceContext is the script value given to JsParse/JsRun, the source holder references it
+    *value = reinterpret_cast<JsValueRef>(sourceContext);
+    *parseAttributes = Js::JavascriptString::Is(*value) ?
+        JsParseScriptAttributeArrayBufferIsUtf16Encoded : JsParseScriptAttributeNone;
+    return true;
+}
+
+static JsErrorCode CompileRunWithByteCodeCache(
+    JsrtByteCodeCache *byteCodeCache,
+    JsValueRef scriptVal,
+    const byte *script,
+    size_t cb,
+    LoadScriptFlag scriptFlag,
+    JsSourceContext sourceContext,
+    const WCHAR *url,
+    bool parseOnly,
+    JsParseScriptAttributes parseAttributes,
+    JsValueRef *result)
+{
+    // Strings are always UTF16, keep them apart from UTF8 buffers with the same bytes
+    JsParseScriptAttributes cacheAttributes = Js::JavascriptString::Is(scriptVal) ?
+        JsParseScriptAttributeArrayBufferIsUtf16Encoded : JsParseScriptAttributeNone;
+    JsErrorCode errorCode;
+
+    void *view;
+    uint32 byteCodeLength;
+    const byte *byteCode = byteCodeCache->Map(script, cb, cacheAttributes, &view, &byteCodeLength);
+    if (byteCode != nullptr)
+    {
+        JsValueRef bufferVal;
+        errorCode = JsCreateExternalArrayBuffer((void *)byteCode, byteCodeLength,
+            JsrtByteCodeCache::Unmap, view, &bufferVal);
+        if (errorCode != JsNoError)
+        {
+            JsrtByteCodeCache::Unmap(view);
+            return errorCode;
+        }
+
+        errorCode = RunSerializedScriptCore(
+            ByteCodeCacheLoadScriptCallback, DummyScriptUnloadCallback,
+            reinterpret_cast<JsSourceContext>(scriptVal), // the script value is the scriptLoadSourceContext
+            (unsigned char *)byteCode, bufferVal, sourceContext, url, parseOnly, result, scriptVal);
+        if (errorCode != JsErrorBadSerializedScript)
+        {
+            return errorCode;
+        }
+        // Fall back to compiling the source, the entry gets replaced below
+    }
+
+    // The byte code is serialized from the function that is compiled to run the script, so a cache
+    // miss compiles the source once
+    unsigned int bufferSize = 0;
+    byte *buffer = nullptr;
+    errorCode = RunScriptCore(scriptVal, script, cb, scriptFlag,
+        sourceContext, url, parseOnly, parseAttributes, false, result,
+        parseOnly ? nullptr : &buffer, &bufferSize);
+
+    // Only scripts that ran successfully once are added to the cache
+    if (errorCode == JsNoError && buffer != nullptr)
+    {
+        byteCodeCache->Store(script, cb, cacheAttributes, buffer, bufferSize);
+    }
+    if (buffer != nullptr)
+    {
+        CoTaskMemFree(buffer);
+    }
+
+    return errorCode;
+}
+
 _ALWAYSINLINE JsErrorCode CompileRun(
     JsValueRef scriptVal,
     JsSourceContext sourceContext,
@@ -4809,6 +4990,19 @@ _ALWAYSINLINE JsErrorCode CompileRun(
         return error;
     }
 
+    JsrtContext *context = JsrtContext::GetCurrent();
+    JsrtByteCodeCache *byteCodeCache = context != nullptr ? context->GetRuntime()->GetByteCodeCache() : nullptr;
+    if (byteCodeCache != nullptr && JsrtByteCodeCache::CanCache(parseAttributes) && (isString || isUtf8) &&
+        !context->GetScriptContext()->IsScriptContextInDebugMode()
+#if ENABLE_TTD
+        && !context->GetScriptContext()->IsTTDRecordOrReplayModeEnabled()
+#endif
+        )
+    {
+        return CompileRunWithByteCodeCache(byteCodeCache, scriptVal, script, cb, scriptFlag,
+            sourceContext, url, parseOnly, parseAttributes, result);
+    }
+
     return RunScriptCore(scriptVal, script, cb, scriptFlag,
         sourceContext, url, parseOnly, parseAttributes, false, result);
 }
@@ -5030,6 +5224,80 @@ CHAKRA_API JsRunSerialized(
         buffer, bufferVal, sourceContext, url, false, result);
 }
 
+static JsErrorCode ValidateCacheDirectory(utf8::NarrowToWide& wideDirectory)
+{
+    if (!wideDirectory)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return FileCacheDirectory::IsValidDirectoryLength(wideDirectory.Length()) ? JsNoError : JsErrorInvalidArgument;
+}
+
+CHAKRA_API JsSetRuntimeByteCodeCacheDirectory(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_opt_z_ const char *directory)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    JsrtRuntime * runtime = JsrtRuntime::FromHandle(runtimeHandle);
+    if (directory == nullptr)
+    {
+        runtime->SetByteCodeCache(nullptr);
+        return JsNoError;
+    }
+
+    utf8::NarrowToWide wideDirectory(directory);
+    JsErrorCode errorCode = ValidateCacheDirectory(wideDirectory);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    JsrtByteCodeCache * byteCodeCache = JsrtByteCodeCache::New(wideDirectory);
+    if (byteCodeCache == nullptr)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    runtime->SetByteCodeCache(byteCodeCache);
+    return JsNoError;
+}
+
+CHAKRA_API JsSetRuntimeProfileCacheDirectory(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_opt_z_ const char *directory)
+{
+#ifdef DYNAMIC_PROFILE_CACHE
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    if (directory == nullptr)
+    {
+        threadContext->SetDynamicProfileCache(nullptr);
+        return JsNoError;
+    }
+
+    utf8::NarrowToWide wideDirectory(directory);
+    JsErrorCode errorCode = ValidateCacheDirectory(wideDirectory);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    DynamicProfileCache * profileCache = DynamicProfileCache::New(wideDirectory);
+    if (profileCache == nullptr)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    threadContext->SetDynamicProfileCache(profileCache);
+    return JsNoError;
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
 CHAKRA_API JsCreatePromise(_Out_ JsValueRef *promise, _Out_ JsValueRef *resolve, _Out_ JsValueRef *reject)
 {
     return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
@@ -0,0 +1,119 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtByteCodeCache.h"
+
+JsrtByteCodeCache * JsrtByteCodeCache::New(_In_z_ const char16 * directory)
+{
+    JsrtByteCodeCache * cache = HeapNewNoThrow(JsrtByteCodeCache);
+    if (cache != nullptr && !cache->directory.Initialize(directory))
+    {
+        HeapDelete(cache);
+        return nullptr;
+    }
+    return cache;
+}
+
+bool JsrtByteCodeCache::GetEntryPath(const byte * source, size_t cbSource, JsParseScriptAttributes parseAttributes, _Out_writes_z_(MAX_PATH) char16 * path)
+{
+    // Byte code lengths are 32 bit, don't bother with sources that don't fit either
+    if (cbSource > UINT32_MAX)
+    {
+        return false;
+    }
+
+    // Same content hash that the Utf8SourceInfo of the script will use
+    hash_t hash = JsUtil::CharacterBuffer<utf8char_t>::StaticGetHashCode((const utf8char_t *)source, (charcount_t)cbSource);
+    return directory.GetEntryPath(hash, (uint32)cbSource, (uint32)parseAttributes, _u("cbc"), path);
+}
+
+const byte * JsrtByteCodeCache::Map(_In_reads_bytes_(cbSource) const byte * source, size_t cbSource, JsParseScriptAttributes parseAttributes,
+    _Out_ void ** view, _Out_ uint32 * byteCodeLength)
+{
+    *view = nullptr;
+    *byteCodeLength = 0;
+
+    char16 path[MAX_PATH];
+    if (!GetEntryPath(source, cbSource, parseAttributes, path))
+    {
+        return nullptr;
+    }
+
+    uint64 fileSize;
+    HANDLE file = FileCacheDirectory::OpenEntry(path, &fileSize);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    HANDLE mapping = nullptr;
+    if (fileSize > ByteCodeOffset)
+    {
+        // The deserializer may patch the buffer in place, so the view is copy-on-write
+        mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    }
+    CloseHandle(file);
+
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    byte * base = (byte *)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (base == nullptr)
+    {
+        return nullptr;
+    }
+
+    const EntryHeader * header = (const EntryHeader *)base;
+    if (!header->tag.IsValid(EntryMagic) ||
+        header->parseAttributes != (uint32)parseAttributes ||
+        header->sourceLength != cbSource ||
+        fileSize != ByteCodeOffset + header->byteCodeLength + header->sourceLength ||
+        memcmp(base + ByteCodeOffset + header->byteCodeLength, source, cbSource) != 0)
+    {
+        UnmapViewOfFile(base);
+        return nullptr;
+    }
+
+    *view = base;
+    *byteCodeLength = header->byteCodeLength;
+    return base + ByteCodeOffset;
+}
+
+void CHAKRA_CALLBACK JsrtByteCodeCache::Unmap(_In_opt_ void * view)
+{
+    if (view != nullptr)
+    {
+        UnmapViewOfFile(view);
+    }
+}
+
+void JsrtByteCodeCache::Store(_In_reads_bytes_(cbSource) const byte * source, size_t cbSource, JsParseScriptAttributes parseAttributes,
+    _In_reads_bytes_(byteCodeLength) const byte * byteCode, uint32 byteCodeLength)
+{
+    char16 path[MAX_PATH];
+    if (!GetEntryPath(source, cbSource, parseAttributes, path))
+    {
+        return;
+    }
+
+    byte headerBlock[ByteCodeOffset] = { 0 };
+    EntryHeader * header = (EntryHeader *)headerBlock;
+    header->tag.Initialize(EntryMagic);
+    header->parseAttributes = (uint32)parseAttributes;
+    header->byteCodeLength = byteCodeLength;
+    header->sourceLength = cbSource;
+
+    FileCacheDirectory::Part parts[] =
+    {
+        { headerBlock, ByteCodeOffset },
+        { byteCode, byteCodeLength },
+        { source, cbSource }
+    };
+    FileCacheDirectory::WriteEntry(path, parts, _countof(parts));
+}
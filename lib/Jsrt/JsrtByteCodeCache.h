@@ -0,0 +1,53 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include "Language/FileCacheDirectory.h"
+
+// Engine managed on-disk byte code cache for JsParse/JsRun.
+//
+// Each entry is a file in the cache directory named after the hash and length of the script
+// source. The file holds the serialized byte code followed by a copy of the source, so a hash
+// collision or a stale entry is detected on load instead of running the wrong byte code.
+// Entries are mapped copy-on-write and handed to the deserializer without copying; the view is
+// unmapped when the ExternalArrayBuffer wrapping it is collected.
+class JsrtByteCodeCache
+{
+public:
+    static JsrtByteCodeCache * New(_In_z_ const char16 * directory);
+
+    // Only plain scripts are cached, library code and other attributes take the normal path
+    static bool CanCache(JsParseScriptAttributes parseAttributes)
+    {
+        return (parseAttributes & ~JsParseScriptAttributeArrayBufferIsUtf16Encoded) == 0;
+    }
+
+    // Maps the entry for the given source. Returns nullptr if there is no valid entry, otherwise
+    // the mapped byte code and the view to pass to Unmap.
+    const byte * Map(_In_reads_bytes_(cbSource) const byte * source, size_t cbSource, JsParseScriptAttributes parseAttributes,
+        _Out_ void ** view, _Out_ uint32 * byteCodeLength);
+    static void CHAKRA_CALLBACK Unmap(_In_opt_ void * view);
+
+    // Writes (or replaces) the entry for the given source. Failures are ignored, the cache is best effort.
+    void Store(_In_reads_bytes_(cbSource) const byte * source, size_t cbSource, JsParseScriptAttributes parseAttributes,
+        _In_reads_bytes_(byteCodeLength) const byte * byteCode, uint32 byteCodeLength);
+
+private:
+    struct EntryHeader
+    {
+        FileCacheDirectory::EntryTag tag;
+        uint32 parseAttributes;
+        uint32 byteCodeLength;
+        uint64 sourceLength;
+    };
+
+    static const uint32 EntryMagic = 0x43424843; // "CHBC"
+    static const size_t ByteCodeOffset = (sizeof(EntryHeader) + 15) & ~(size_t)15;
+
+    JsrtByteCodeCache() {}
+    bool GetEntryPath(const byte * source, size_t cbSource, JsParseScriptAttributes parseAttributes, _Out_writes_z_(MAX_PATH) char16 * path);
+
+    FileCacheDirectory directory;
+};
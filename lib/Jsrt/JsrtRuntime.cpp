@@ -5,6 +5,7 @@
 #include <JsrtPch.h>
 #include "JsrtRuntime.h"
 #include "jsrtHelper.h"
+#include "JsrtByteCodeCache.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Base/ThreadBoundThreadContextManager.h"
 JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispatchExceptions)
@@ -15,6 +16,7 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+    this->byteCodeCache = nullptr;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -35,6 +37,11 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
 JsrtRuntime::~JsrtRuntime()
 {
     HeapDelete(allocationPolicyManager);
+    if (this->byteCodeCache != nullptr)
+    {
+        HeapDelete(this->byteCodeCache);
+        this->byteCodeCache = nullptr;
+    }
 #ifdef ENABLE_SCRIPT_DEBUGGING
     if (this->jsrtDebugManager != nullptr)
     {
@@ -108,6 +115,15 @@ void JsrtRuntime::SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollect
     }
 }
 
+void JsrtRuntime::SetByteCodeCache(JsrtByteCodeCache * byteCodeCache)
+{
+    if (this->byteCodeCache != nullptr)
+    {
+        HeapDelete(this->byteCodeCache);
+    }
+    this->byteCodeCache = byteCodeCache;
+}
+
 void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags)
 {
     if (flags & Collect_Begin)
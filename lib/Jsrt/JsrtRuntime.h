@@ -11,6 +11,7 @@
 #endif
 
 class JsrtContext;
+class JsrtByteCodeCache;
 
 class JsrtRuntime
 {
@@ -39,6 +40,9 @@ class JsrtRuntime
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
 
+    JsrtByteCodeCache * GetByteCodeCache() const { return byteCodeCache; }
+    void SetByteCodeCache(JsrtByteCodeCache * byteCodeCache);
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
     bool IsSerializeByteCodeForLibrary() const { return serializeByteCodeForLibrary; }
@@ -67,6 +71,7 @@ class JsrtRuntime
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+    JsrtByteCodeCache * byteCodeCache;
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
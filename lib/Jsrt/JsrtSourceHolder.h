@@ -46,12 +46,13 @@ namespace Js
         JsrtSourceHolder(_In_ TLoadCallback scriptLoadCallback,
             _In_ TUnloadCallback scriptUnloadCallback,
             _In_ JsSourceContext sourceContext,
-            JsValueRef serializedScriptValue = nullptr) :
+            JsValueRef serializedScriptValue = nullptr,
+            JsValueRef scriptValue = nullptr) :
             scriptLoadCallback(scriptLoadCallback),
             scriptUnloadCallback(scriptUnloadCallback),
             sourceContext(sourceContext),
 #ifndef NTBUILD
-            mappedScriptValue(nullptr),
+            mappedScriptValue(scriptValue),
             mappedSerializedScriptValue(serializedScriptValue),
 #endif
             mappedSourceByteLength(0),
@@ -105,7 +106,12 @@ namespace Js
 
         virtual ISourceHolder* Clone(ScriptContext *scriptContext) override
         {
+#ifndef NTBUILD
+            return RecyclerNewFinalized(scriptContext->GetRecycler(), JsrtSourceHolder, this->scriptLoadCallback, this->scriptUnloadCallback, this->sourceContext,
+                this->mappedSerializedScriptValue, this->mappedScriptValue);
+#else
             return RecyclerNewFinalized(scriptContext->GetRecycler(), JsrtSourceHolder, this->scriptLoadCallback, this->scriptUnloadCallback, this->sourceContext);
+#endif
         }
 
         virtual hash_t GetHashCode() override
@@ -15,7 +15,8 @@ BackgroundParser::BackgroundParser(Js::ScriptContext *scriptContext)
         unprocessedItemsHead(nullptr),
         unprocessedItemsTail(nullptr),
         failedBackgroundParseItem(nullptr),
-        pendingBackgroundItems(0)
+        pendingBackgroundItems(0),
+        noPendingBackgroundItemsEvent(false /* autoReset */, true /* signaled */)
 {
     Processor()->AddManager(this);
 
@@ -112,7 +113,10 @@ void BackgroundParser::JobProcessed(JsUtil::Job *const job, const bool succeeded
     // This is called from inside a lock, so we can mess with background parser attributes.
     BackgroundParseItem *backgroundItem = static_cast<BackgroundParseItem*>(job);
     this->RemoveFromUnprocessedItems(backgroundItem);
-    --this->pendingBackgroundItems;
+    if (--this->pendingBackgroundItems == 0)
+    {
+        this->noPendingBackgroundItemsEvent.Set();
+    }
     if (!succeeded)
     {
         Assert(FAILED(backgroundItem->GetHR()) || failedBackgroundParseItem);
@@ -139,6 +143,17 @@ void BackgroundParser::JobProcessed(JsUtil::Job *const job, const bool succeeded
     }
 }
 
+void BackgroundParser::WaitForPendingBackgroundItems() const
+{
+    ASSERT_THREAD();
+
+    // Only the main thread adds items, so the event can't be reset again while we wait
+    while (*GetPendingBackgroundItemsPtr())
+    {
+        this->noPendingBackgroundItemsEvent.Wait();
+    }
+}
+
 void BackgroundParser::OnDecommit(JsUtil::ParallelThreadData *threadData)
 {
     if (threadData->parser)
@@ -199,7 +214,10 @@ void BackgroundParser::AfterWaitForJob(BackgroundParseItem *const item) const
 void BackgroundParser::AddToParseQueue(BackgroundParseItem *const item, bool prioritize, bool lock)
 {
     AutoOptionalCriticalSection autoLock(lock ? Processor()->GetCriticalSection() : nullptr);
-    ++this->pendingBackgroundItems;
+    if (this->pendingBackgroundItems++ == 0)
+    {
+        this->noPendingBackgroundItemsEvent.Reset();
+    }
     Processor()->AddJob(item, prioritize);   // This one can throw (really unlikely though), OOM specifically.
     this->AddUnprocessedItem(item);
     item->OnAddToParseQueue();
@@ -66,6 +66,7 @@ class BackgroundParser sealed : public JsUtil::WaitableJobManager
     static void Delete(BackgroundParser *backgroundParser);
 
     volatile uint* GetPendingBackgroundItemsPtr() const { return (volatile uint*)&pendingBackgroundItems; }
+    void WaitForPendingBackgroundItems() const;
 
     virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
@@ -94,6 +95,7 @@ class BackgroundParser sealed : public JsUtil::WaitableJobManager
 private:
     Js::ScriptContext *scriptContext;
     uint pendingBackgroundItems;
+    Event noPendingBackgroundItemsEvent; // set while pendingBackgroundItems is zero, changes under the processor's lock
     BackgroundParseItem *failedBackgroundParseItem;
     BackgroundParseItem *unprocessedItemsHead;
     BackgroundParseItem *unprocessedItemsTail;
@@ -414,8 +414,8 @@ HRESULT Parser::ParseSourceInternal(
 #if ENABLE_BACKGROUND_PARSING
     if (this->m_hasParallelJob)
     {
-        ///// Wait here for remaining jobs to finish. Then look for errors, do final const bindings.
-        // pleath TODO: If there are remaining jobs, let the main thread help finish them.
+        // Finish the remaining jobs (the main thread takes the ones no background thread has started) before looking for
+        // errors and binding references. The byte code generator runs on the parse tree right after this returns.
         BackgroundParser *bgp = m_scriptContext->GetBackgroundParser();
         Assert(bgp);
 
@@ -514,8 +514,7 @@ void Parser::WaitForBackgroundJobs(BackgroundParser *bgp, CompileScriptException
         pcs->Leave();
 
         // Wait for the background threads to finish jobs they're already processing (if any).
-        // TODO: Replace with a proper semaphore.
-        while(*bgp->GetPendingBackgroundItemsPtr());
+        bgp->WaitForPendingBackgroundItems();
     }
 
     Assert(!*bgp->GetPendingBackgroundItemsPtr());
@@ -6044,10 +6043,23 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
     this->m_deferringAST = FALSE;
 }
 
+bool Parser::IsParallelParseEnabled()
+{
+#if ENABLE_BACKGROUND_PARSING
+    return CONFIG_FLAG_RELEASE(ParallelParse) || PHASE_ON1(Js::ParallelParsePhase);
+#else
+    return false;
+#endif
+}
+
+// Bodies compiled with the script are parsed in full in the background, top level deferred bodies are only scanned there
+// for early errors and references. Deferred stubs are not parsed ahead of their first call, the parse tree is freed once
+// the script is compiled so a speculative parse would have nowhere to live until then.
 bool Parser::DoParallelParse(ParseNodePtr pnodeFnc) const
 {
 #if ENABLE_BACKGROUND_PARSING
-    if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
+    if (!CONFIG_FLAG_RELEASE(ParallelParse) &&
+        !PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
     {
         return false;
     }
@@ -9261,9 +9273,9 @@ Js::PropertyId PnPid::PropertyIdFromNameNode() const
 
 PidRefStack* Parser::PushPidRef(IdentPtr pid)
 {
-    if (PHASE_ON1(Js::ParallelParsePhase))
+    if (IsParallelParseEnabled())
     {
-        // NOTE: the phase check is here to protect perf. See OSG 1020424.
+        // NOTE: the check is here to protect perf. See OSG 1020424.
         // In some LS AST-rewrite cases we lose a lot of perf searching the PID ref stack rather
         // than just pushing on the top. This hasn't shown up as a perf issue in non-LS benchmarks.
         return pid->FindOrAddPidRef(&m_nodeAllocator, GetCurrentBlock()->sxBlock.blockId, GetCurrentFunctionNode()->sxFnc.functionId);
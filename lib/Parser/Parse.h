@@ -335,6 +335,7 @@ class Parser
         charcount_t ichMin,charcount_t ichLim);
 
     void PrepareScanner(bool fromExternal);
+    static bool IsParallelParseEnabled();
 #if ENABLE_BACKGROUND_PARSING
     void PrepareForBackgroundParse();
     void AddFastScannedRegExpNode(ParseNodePtr const pnode);
@@ -4547,6 +4547,22 @@ namespace UnifiedRegex
         program->numLoops = nextLoopId;
     }
 
+    void Compiler::CaptureFirstSetFilter(Node* root)
+    {
+        Assert(program->tag == Program::ProgramTag::InstructionsTag);
+        Assert(program->rep.insts.firstSetFilter == nullptr);
+
+        if (root->thisConsumes.CouldMatchEmpty() || root->firstSet->Count() >= NumChars)
+        {
+            // Every position is a potential match start, nothing to filter
+            return;
+        }
+
+        RuntimeCharSet<Char> *firstSetFilter = RecyclerNewLeaf(scriptContext->GetRecycler(), RuntimeCharSet<Char>);
+        firstSetFilter->CloneFrom(rtAllocator, *root->firstSet);
+        program->rep.insts.firstSetFilter = firstSetFilter;
+    }
+
     void Compiler::FreeBody()
     {
         if (instBuf != 0)
@@ -4751,7 +4767,14 @@ namespace UnifiedRegex
                             {
                                 // Optionally scan for a character in the overall pattern's FIRST set, possibly consume it,
                                 // then match all or remainder of pattern
+                                const Label scanLabel = compiler.CurrentLabel();
                                 skipped = root->EmitScanFirstSet(compiler);
+                                if (compiler.CurrentLabel() == scanLabel)
+                                {
+                                    // No scan was emitted. Keep FIRST around so the matcher can still filter start
+                                    // positions once the pattern turns out to be hot.
+                                    compiler.CaptureFirstSetFilter(root);
+                                }
                             }
                         }
                     }
@@ -686,6 +686,7 @@ namespace UnifiedRegex
         void CaptureLiterals(Node* root, const Char *litbuf);
         static void EmitAndCaptureSuccInst(Recycler* recycler, Program* program);
         void CaptureInsts();
+        void CaptureFirstSetFilter(Node* root);
         void FreeBody();
 
         Compiler
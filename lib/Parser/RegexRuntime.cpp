@@ -4922,6 +4922,7 @@ namespace UnifiedRegex
         , literalNextSyncInputOffsets(nullptr)
         , recycler(scriptContext->GetRecycler())
         , previousQcTime(0)
+        , hitCount(0)
 #if ENABLE_REGEX_CONFIG_OPTIONS
         , stats(0)
         , w(0)
@@ -5172,6 +5173,32 @@ namespace UnifiedRegex
         return WasLastMatchSuccessful();
     }
 
+    inline const RuntimeCharSet<Char> *Matcher::GetHotFirstSetFilter()
+    {
+        const RuntimeCharSet<Char> *const firstSetFilter = program->rep.insts.firstSetFilter;
+        if (firstSetFilter == nullptr || PHASE_OFF1(Js::RegexTierUpPhase))
+        {
+            return nullptr;
+        }
+
+        const uint threshold = static_cast<uint>(CONFIG_FLAG(RegexTierUpThreshold));
+        if (hitCount < threshold)
+        {
+            if (++hitCount < threshold)
+            {
+                return nullptr;
+            }
+
+            if (PHASE_TRACE1(Js::RegexTierUpPhase))
+            {
+                Output::Print(_u("Regex tier-up: /%s/ promoted after %u matches\n"), PointerValue(program->source), hitCount);
+                Output::Flush();
+            }
+        }
+
+        return firstSetFilter;
+    }
+
     inline bool Matcher::MatchSingleCharCaseInsensitive(const Char* const input, const CharCount inputLength, CharCount offset, const Char c)
     {
         CaseInsensitive::MappingSource mappingSource = program->GetCaseMappingSource();
@@ -5504,11 +5531,31 @@ namespace UnifiedRegex
 
                 RegexStacks * regexStacks = scriptContext->RegexStacks();
 
+                // Hot patterns skip over start positions whose character can never begin a match, without paying for a full
+                // interpreter run at each of them. Only programs without a leading scan instruction have a filter.
+                const RuntimeCharSet<Char> *const firstSetFilter = loopMatchHere ? GetHotFirstSetFilter() : nullptr;
+
                 // Need to continue matching even if matchStart == inputLim since some patterns may match an empty string at the end
                 // of the input. For instance: /a*$/.exec("b")
                 bool firstIteration = true;
                 do
                 {
+                    if (firstSetFilter != nullptr)
+                    {
+                        while (offset < inputLength && !firstSetFilter->Get(input[offset]))
+                        {
+                            offset++;
+                        }
+
+                        if (offset == inputLength)
+                        {
+                            // The filter is only captured for patterns which cannot match empty
+                            groupInfos[0].Reset();
+                            res = false;
+                            break;
+                        }
+                    }
+
                     // Let there be only one call to MatchHere(), as that call expands the interpreter loop in-place. Having
                     // multiple calls to MatchHere() would bloat the code.
                     res = MatchHere(input, inputLength, offset, nextSyncInputOffset, regexStacks->contStack, regexStacks->assertionStack, qcTicks, firstIteration);
@@ -5667,6 +5714,7 @@ namespace UnifiedRegex
         rep.insts.litbuf = nullptr;
         rep.insts.litbufLen = 0;
         rep.insts.scannersForSyncToLiterals = nullptr;
+        rep.insts.firstSetFilter = nullptr;
     }
 
     Program *Program::New(Recycler *recycler, RegexFlags flags)
@@ -5739,6 +5787,11 @@ namespace UnifiedRegex
         } while(inst < instEnd);
         Assert(inst == instEnd);
 
+        if (rep.insts.firstSetFilter)
+        {
+            rep.insts.firstSetFilter->FreeBody(rtAllocator);
+        }
+
 #if DBG
         rep.insts.insts = nullptr;
         rep.insts.instsLen = 0;
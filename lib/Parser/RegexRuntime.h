@@ -93,6 +93,11 @@ namespace UnifiedRegex
             // ever be only one of those instructions per program. Since scanners are large (> 1 KB), for that instruction they
             // are allocated on the recycler with pointers stored here to reference them.
             Field(Field(ScannerInfo *)*) scannersForSyncToLiterals;
+
+            // Upper bound of the characters that may begin a match. Only captured when the compiler decided FIRST was too
+            // large to be worth a leading scan instruction, and only consulted by the matcher once the pattern is hot.
+            // In recycler, owned by program, may be null
+            Field(RuntimeCharSet<Char> *) firstSetFilter;
         };
 
         struct SingleChar
@@ -1822,6 +1827,9 @@ namespace UnifiedRegex
 
         Field(uint) previousQcTime;
 
+        // Number of times this pattern has been matched, saturating at the tier-up threshold
+        Field(uint) hitCount;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         FieldNoBarrier(RegexStats*) stats;
         FieldNoBarrier(DebugWriter*) w;
@@ -1887,6 +1895,9 @@ namespace UnifiedRegex
         inline void Run(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
         inline bool MatchHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
 
+        // Returns the program's FIRST set filter if the pattern has been promoted to the hot tier, otherwise null
+        inline const RuntimeCharSet<Char> *GetHotFirstSetFilter();
+
         // Return true if assertion succeeded
         inline bool PopAssertion(CharCount &inputOffset, const uint8 *&instPointer, ContStack &contStack, AssertionStack &assertionStack, bool isFailed);
 
@@ -316,7 +316,7 @@ namespace Js
         return this->library->GetScriptContext();
     }
 
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
     void
     EntryPointInfo::RecordNativeMap(uint32 nativeOffset, uint32 statementIndex)
     {
@@ -517,6 +517,9 @@ namespace Js
         savedImplicitCallsFlags(ImplicitCall_HasNoInfo),
 #endif
         hasExecutionDynamicProfileInfo(false),
+#ifdef DYNAMIC_PROFILE_CACHE
+        hasCachedDynamicProfileInfo(false),
+#endif
         m_hasAllNonLocalReferenced(false),
         m_hasSetIsObject(false),
         m_hasFunExprNameReference(false),
@@ -646,6 +649,9 @@ namespace Js
         savedImplicitCallsFlags(ImplicitCall_HasNoInfo),
 #endif
         hasExecutionDynamicProfileInfo(false),
+#ifdef DYNAMIC_PROFILE_CACHE
+        hasCachedDynamicProfileInfo(false),
+#endif
         m_hasAllNonLocalReferenced(false),
         m_hasSetIsObject(false),
         m_hasFunExprNameReference(false),
@@ -3394,6 +3400,18 @@ namespace Js
                     this->dynamicProfileInfo->Dump(this);
                 }
             }
+#endif
+#ifdef DYNAMIC_PROFILE_CACHE
+            if (this->dynamicProfileInfo != nullptr && sourceDynamicProfileManager->IsProfileLoadedFromCache())
+            {
+                // Only this function's own profile counts: functions the previous run did not profile, or whose
+                // profile was rejected by MatchFunctionBody, still go through the profiling tiers
+                this->hasCachedDynamicProfileInfo = true;
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile cache: function %s uses the cached profile\n"), this->GetDisplayName());
+
+                // The limits were set up before the profile was loaded, redo them now that we know it is available
+                this->executionState.ReinitializeExecutionModeAndLimits(this);
+            }
 #endif
         }
 
@@ -3761,6 +3779,9 @@ namespace Js
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogMethodNativeLoadEvent(this, entryPointInfo);
 #endif
+#if PERFMAP_TRACE_ENABLED
+        PlatformAgnostic::PerfTrace::LogMethodNativeLoadEvent(this, entryPointInfo);
+#endif
 
 #ifdef _M_ARM
         // For ARM we need to make sure that pipeline is synchronized with memory/cache for newly jitted code.
@@ -3828,6 +3849,9 @@ namespace Js
         JS_ETW(EtwTrace::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum)));
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum));
+#endif
+#if PERFMAP_TRACE_ENABLED
+        PlatformAgnostic::PerfTrace::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum));
 #endif
     }
 #endif
@@ -4587,13 +4611,15 @@ namespace Js
     }
 #endif /* IR_VIEWER */
 
-#ifdef VTUNE_PROFILING
-#include "jitprofiling.h"
-
+#if defined(VTUNE_PROFILING) || PERFMAP_TRACE_ENABLED
     int EntryPointInfo::GetNativeOffsetMapCount() const
     {
         return this->nativeOffsetMaps.Count();
     }
+#endif
+
+#ifdef VTUNE_PROFILING
+#include "jitprofiling.h"
 
     uint EntryPointInfo::PopulateLineInfo(void* pInfo, FunctionBody* body)
     {
@@ -4628,7 +4654,9 @@ namespace Js
 
         return j;
     }
+#endif
 
+#if defined(VTUNE_PROFILING) || PERFMAP_TRACE_ENABLED
     ULONG FunctionBody::GetSourceLineNumber(uint statementIndex)
     {
         ULONG line = 0;
@@ -4950,7 +4978,7 @@ namespace Js
                 sourceContextInfo->sourceDynamicProfileManager->RemoveDynamicProfileInfo(GetFunctionInfo()->GetLocalFunctionId());
             }
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
             DynamicProfileInfoList * profileInfoList = GetScriptContext()->GetProfileInfoList();
             if (profileInfoList)
             {
@@ -4969,6 +4997,9 @@ namespace Js
         }
 #endif
         this->hasExecutionDynamicProfileInfo = false;
+#ifdef DYNAMIC_PROFILE_CACHE
+        this->hasCachedDynamicProfileInfo = false;
+#endif
 
         this->SetFirstTmpRegister(Constants::NoRegister);
         this->SetVarCount(0);
@@ -6231,6 +6262,23 @@ namespace Js
         return literalTypes + index;
     }
 
+    void FunctionBody::RecordObjectLiteralAllocation(uint index, Var object)
+    {
+        Assert(index < GetObjLiteralCount());
+        if (!CONFIG_FLAG(AllocationSiteSampling))
+        {
+            return;
+        }
+
+        AllocationSiteInfo * sites = this->GetObjectLiteralSites();
+        if (sites == nullptr)
+        {
+            sites = RecyclerNewArrayZ(this->GetScriptContext()->GetRecycler(), AllocationSiteInfo, GetObjLiteralCount());
+            this->SetObjectLiteralSites(sites);
+        }
+        sites[index].RecordAllocation(VarTo<RecyclableObject>(object), this->GetScriptContext());
+    }
+
     void FunctionBody::AllocateObjectLiteralTypeArray()
     {
         Assert(this->GetObjectLiteralTypes() == nullptr);
@@ -6326,6 +6374,7 @@ namespace Js
     void FunctionBody::ResetObjectLiteralTypes()
     {
         this->SetObjectLiteralTypes(nullptr);
+        this->SetObjectLiteralSites(nullptr);
         this->SetObjLiteralCount(0);
     }
 
@@ -8917,7 +8966,7 @@ namespace Js
             this->polymorphicInlineCacheInfo = nullptr;
 #endif
 
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
             this->nativeOffsetMaps.Reset();
 #endif
         }
@@ -475,7 +475,7 @@ namespace Js
 #if ENABLE_DEBUG_CONFIG_OPTIONS
             , cleanupReason(NotCleanedUp)
 #endif
-#if DBG_DUMP | defined(VTUNE_PROFILING)
+#if DBG_DUMP | defined(VTUNE_PROFILING) | PERFMAP_TRACE_ENABLED
             , nativeOffsetMaps(&HeapAllocator::Instance)
 #endif
 #ifdef FIELD_ACCESS_STATS
@@ -819,10 +819,10 @@ namespace Js
 #endif
 #if DBG_DUMP
     public:
-#elif defined(VTUNE_PROFILING)
+#elif defined(VTUNE_PROFILING) || PERFMAP_TRACE_ENABLED
     private:
 #endif
-#if DBG_DUMP || defined(VTUNE_PROFILING)
+#if DBG_DUMP || defined(VTUNE_PROFILING) || PERFMAP_TRACE_ENABLED
         // NativeOffsetMap is public for DBG_DUMP, private for VTUNE_PROFILING
         struct NativeOffsetMap
         {
@@ -837,6 +837,18 @@ namespace Js
         void RecordNativeMap(uint32 offset, uint32 statementIndex);
 
         int GetNativeOffsetMapCount() const;
+
+        // Calls fn(statementIndex, nativeOffsetBegin, nativeOffsetEnd) for each recorded range; the
+        // last range may be left open, with its end equal to its begin
+        template <typename Fn>
+        void MapNativeOffsetMaps(Fn fn) const
+        {
+            for (int i = 0; i < nativeOffsetMaps.Count(); i++)
+            {
+                const NativeOffsetMap& map = nativeOffsetMaps.Item(i);
+                fn(map.statementIndex, (uint32)map.nativeOffsetSpan.begin, (uint32)map.nativeOffsetSpan.end);
+            }
+        }
 #endif
 
 #if DBG_DUMP && ENABLE_NATIVE_CODEGEN
@@ -1170,6 +1182,7 @@ namespace Js
             FormalsPropIdArray = 21,
             ForInCacheArray = 22,
             SlotIdInCachedScopeToNestedIndexArray = 23,
+            ObjLiteralSites = 24,                 // Survival feedback for object literals, created on first allocation
 
             Max,
             Invalid = 0xff
@@ -2354,6 +2367,10 @@ namespace Js
         FieldWithBarrier(bool) m_hasActiveReference : 1;
 
         FieldWithBarrier(bool) m_isJsBuiltInForceInline : 1;
+#ifdef DYNAMIC_PROFILE_CACHE
+        // The dynamic profile info was loaded from the host's profile cache rather than collected by this run
+        FieldWithBarrier(bool) hasCachedDynamicProfileInfo : 1;
+#endif
 #if DBG
         FieldWithBarrier(bool) m_isSerialized : 1;
 #endif
@@ -2817,7 +2834,7 @@ namespace Js
 
         CrossFrameEntryExitRecordList* GetCrossFrameEntryExitRecords();
 
-#ifdef VTUNE_PROFILING
+#if defined(VTUNE_PROFILING) || PERFMAP_TRACE_ENABLED
         uint GetStartOffset(uint statementIndex) const;
         ULONG GetSourceLineNumber(uint statementIndex);
 #endif
@@ -3256,6 +3273,7 @@ namespace Js
         void AllocateObjectLiteralTypeArray();
         Field(DynamicType*)* GetObjectLiteralTypeRef(uint index);
         Field(DynamicType*)* GetObjectLiteralTypeRefWithLock(uint index);
+        void RecordObjectLiteralAllocation(uint index, Var object);
         uint NewLiteralRegex();
         void AllocateLiteralRegexArray();
         Field(UnifiedRegex::RegexPattern*)* GetLiteralRegexes() const { return static_cast<Field(UnifiedRegex::RegexPattern*)*>(this->GetAuxPtr(AuxPointerType::LiteralRegexes)); }
@@ -3280,6 +3298,8 @@ namespace Js
         void SetLiteralRegex(const uint index, UnifiedRegex::RegexPattern *const pattern);
         Field(DynamicType*)* GetObjectLiteralTypes() const { return static_cast<Field(DynamicType*)*>(this->GetAuxPtr(AuxPointerType::ObjLiteralTypes)); }
         Field(DynamicType*)* GetObjectLiteralTypesWithLock() const { return static_cast<Field(DynamicType*)*>(this->GetAuxPtrWithLock(AuxPointerType::ObjLiteralTypes)); }
+        AllocationSiteInfo* GetObjectLiteralSites() const { return static_cast<AllocationSiteInfo*>(this->GetAuxPtr(AuxPointerType::ObjLiteralSites)); }
+        AllocationSiteInfo* GetObjectLiteralSitesWithLock() const { return static_cast<AllocationSiteInfo*>(this->GetAuxPtrWithLock(AuxPointerType::ObjLiteralSites)); }
 
         Js::AuxArray<uint32> * GetSlotIdInCachedScopeToNestedIndexArray() const { return static_cast<Js::AuxArray<uint32> *>(this->GetAuxPtr(AuxPointerType::SlotIdInCachedScopeToNestedIndexArray)); }
         Js::AuxArray<uint32> * GetSlotIdInCachedScopeToNestedIndexArrayWithLock() const { return static_cast<Js::AuxArray<uint32> *>(this->GetAuxPtrWithLock(AuxPointerType::SlotIdInCachedScopeToNestedIndexArray)); }
@@ -3289,6 +3309,7 @@ namespace Js
         void ResetLiteralRegexes();
         void ResetObjectLiteralTypes();
         void SetObjectLiteralTypes(DynamicType** objLiteralTypes) { this->SetAuxPtr(AuxPointerType::ObjLiteralTypes, objLiteralTypes); };
+        void SetObjectLiteralSites(AllocationSiteInfo* objLiteralSites) { this->SetAuxPtr(AuxPointerType::ObjLiteralSites, objLiteralSites); };
         void SetSlotIdInCachedScopeToNestedIndexArray(Js::AuxArray<uint32> * slotIdInCachedScopeToNestedIndexArray) { this->SetAuxPtr(AuxPointerType::SlotIdInCachedScopeToNestedIndexArray, slotIdInCachedScopeToNestedIndexArray); }
         void ResetSlotIdInCachedScopeToNestedIndexArray() { SetSlotIdInCachedScopeToNestedIndexArray(nullptr); }
     public:
@@ -3314,6 +3335,9 @@ namespace Js
         bool HasExecutionDynamicProfileInfo() const { return hasExecutionDynamicProfileInfo; }
         bool HasDynamicProfileInfo() const { return dynamicProfileInfo != nullptr; }
         bool NeedEnsureDynamicProfileInfo() const;
+#ifdef DYNAMIC_PROFILE_CACHE
+        bool HasCachedDynamicProfileInfo() const { return hasCachedDynamicProfileInfo; }
+#endif
         DynamicProfileInfo * GetDynamicProfileInfo() const { Assert(HasExecutionDynamicProfileInfo()); return dynamicProfileInfo; }
         DynamicProfileInfo * GetAnyDynamicProfileInfo() const { Assert(HasDynamicProfileInfo()); return dynamicProfileInfo; }
         DynamicProfileInfo * EnsureDynamicProfileInfo();
@@ -91,6 +91,33 @@ namespace Js
             profilingInterpreter1Limit = 0;
         }
 
+        uint16 skippedProfilingIterations = 0;
+        bool fullJitOnFirstCall = false;
+#ifdef DYNAMIC_PROFILE_CACHE
+        if (owner->HasCachedDynamicProfileInfo() && !PHASE_OFF(FullJitPhase, owner) && !configFlags.EnforceExecutionModeLimits)
+        {
+            // The profile observed by a previous run is already loaded, the profiling interpreter and simple JIT would only
+            // collect it again. Skip them, so the function goes to full JIT once the auto-profiling interpreter is done.
+            skippedProfilingIterations = profilingInterpreter0Limit + simpleJitLimit + profilingInterpreter1Limit;
+            profilingInterpreter0Limit = 0;
+            simpleJitLimit = 0;
+            profilingInterpreter1Limit = 0;
+
+            if (owner->GetAnyDynamicProfileInfo()->WasFullJitted())
+            {
+                // The previous run got this function to full JIT, so it is expected to be warm again. Don't wait for the
+                // auto-profiling interpreter or delay the full JIT either, the first call queues the job.
+                fullJitOnFirstCall = true;
+                skippedProfilingIterations += scale + autoProfilingInterpreter0Limit + autoProfilingInterpreter1Limit;
+                scale = 0;
+                autoProfilingInterpreter0Limit = 0;
+                autoProfilingInterpreter1Limit = 0;
+                PHASE_PRINT_TESTTRACE(DynamicProfilePhase, owner,
+                    _u("TestTrace: DynamicProfile: function %s full JITs on its first call\n"), owner->GetDisplayName());
+            }
+        }
+#endif
+
         uint16 fullJitThresholdConfig =
             static_cast<uint16>(
                 configFlags.AutoProfilingInterpreter0Limit +
@@ -98,7 +125,7 @@ namespace Js
                 configFlags.AutoProfilingInterpreter1Limit +
                 configFlags.SimpleJitLimit +
                 configFlags.ProfilingInterpreter1Limit);
-        if (!configFlags.EnforceExecutionModeLimits)
+        if (!configFlags.EnforceExecutionModeLimits && !fullJitOnFirstCall)
         {
             /*
             Scale the full JIT threshold based on some heuristics:
@@ -140,11 +167,12 @@ namespace Js
             }
         }
 
-        Assert(fullJitThresholdConfig >= scale);
+        Assert(fullJitThresholdConfig >= scale + skippedProfilingIterations);
+        fullJitThresholdConfig -= skippedProfilingIterations;
         fullJitThreshold = fullJitThresholdConfig - scale;
         SetInterpretedCount(0);
         SetDefaultInterpreterExecutionMode();
-        SetFullJitThreshold(fullJitThresholdConfig);
+        SetFullJitThreshold(fullJitThresholdConfig, skippedProfilingIterations != 0);
         TryTransitionToNextInterpreterExecutionMode();
     }
 
@@ -223,6 +223,8 @@ namespace Js
 
 #ifdef BGJIT_STATS
         interpretedCount = maxFuncInterpret = funcJITCount = bytecodeJITCount = interpretedCallsHighPri = jitCodeUsed = funcJitCodeUsed = loopJITCount = speculativeJitCount = 0;
+        jitQueueAddCount = jitQueueDepthTotal = jitQueueMaxDepth = jitQueueEvictCount = jitQueueWaitCount = 0;
+        jitQueueWaitTime = 0;
 #endif
 
 #ifdef PROFILE_TYPES
@@ -1229,8 +1231,8 @@ namespace Js
     {
 
 #if ENABLE_PROFILE_INFO
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
-        if (DynamicProfileInfo::NeedProfileInfoList())
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
+        if (DynamicProfileInfo::NeedProfileInfoList(this->GetThreadContext()))
         {
             this->Cache()->profileInfoList = RecyclerNew(this->GetRecycler(), DynamicProfileInfoList);
         }
@@ -1260,7 +1262,7 @@ namespace Js
         this->guestArena = this->GetRecycler()->CreateGuestArena(_u("Guest"), Throw::OutOfMemory);
 
 #if ENABLE_BACKGROUND_PARSING
-        if (PHASE_ON1(Js::ParallelParsePhase))
+        if (Parser::IsParallelParseEnabled())
         {
             this->backgroundParser = BackgroundParser::New(this);
         }
@@ -1406,7 +1408,7 @@ namespace Js
 #endif
 
 #if ENABLE_PROFILE_INFO
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
                 HRESULT hr = S_OK;
                 BEGIN_TRANSLATE_OOM_TO_HRESULT_NESTED
                 {
@@ -1426,7 +1428,7 @@ namespace Js
                 }
 #endif
 
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
                 this->ClearDynamicProfileList();
 #endif
 #endif
@@ -3339,7 +3341,7 @@ namespace Js
         }
 
 #if ENABLE_PROFILE_INFO
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
         // Reset the dynamic profile list
         if (this->Cache()->profileInfoList)
         {
@@ -5134,7 +5136,7 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
                 dynamicProfileInfo = newDynamicProfileInfo;
             }
             Assert(functionBody->GetInterpretedCount() == 0);
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
 
             if (this->Cache()->profileInfoList)
             {
@@ -5518,6 +5520,10 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
             Output::Print(_u("** TotalInterpretedCalls: %6d MaxFuncInterp: %6d  InterpretedHighPri: %6d \n"),
                 interpretedCount, maxFuncInterpret, interpretedCallsHighPri);
             Output::Print(_u("** ZeroInterpretedFunctions: %6d OneInterpretedFunctions: %6d ZeroInterpretedWithNonZeroBytecode: %6d \n "), zeroInterpretedFunctions, oneInterpretedFunctions, nonZeroBytecodeFunctions);
+            Output::Print(_u("** JitQueueAdds: %6d AverageJitQueueDepth: %f MaxJitQueueDepth: %6d JitQueueEvictions: %6d\n"),
+                jitQueueAddCount, jitQueueAddCount ? (float)jitQueueDepthTotal / jitQueueAddCount : 0.0f, jitQueueMaxDepth, jitQueueEvictCount);
+            Output::Print(_u("** JitQueueWaits: %6d AverageJitQueueWait: %f ms\n"),
+                jitQueueWaitCount, jitQueueWaitCount ? (double)jitQueueWaitTime / jitQueueWaitCount / 1000 : 0.0);
             Output::Print(_u("** %-24s : %-10s %-10s %-10s %-10s %-10s\n"), _u("InterpretedCounts"), _u("Total"), _u("NativeCode"), _u("Used"), _u("Usage"), _u("Rejits"));
             uint low = 0;
             uint high = 0;
@@ -686,6 +686,12 @@ namespace Js
         uint jitCodeUsed;
         uint funcJitCodeUsed;
         uint speculativeJitCount;
+        uint jitQueueAddCount;
+        uint jitQueueDepthTotal;
+        uint jitQueueMaxDepth;
+        uint jitQueueEvictCount;
+        uint jitQueueWaitCount;
+        uint64 jitQueueWaitTime;    // in microseconds
 #endif
 #if DBG
         // Count how many Out of Memory and Stack overflow exceptions happened during the execution
@@ -1092,7 +1098,7 @@ namespace Js
 #endif
 
 #if ENABLE_PROFILE_INFO
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
         void ClearDynamicProfileList()
         {
             if (this->Cache()->profileInfoList)
@@ -19,6 +19,7 @@
 #include "Base/ThreadContextTlsEntry.h"
 #include "Base/ThreadBoundThreadContextManager.h"
 #include "Language/SourceDynamicProfileManager.h"
+#include "Language/DynamicProfileCache.h"
 #include "Language/CodeGenRecyclableData.h"
 #include "Language/InterpreterStackFrame.h"
 #include "Language/JavascriptStackWalker.h"
@@ -248,6 +249,9 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #ifdef DYNAMIC_PROFILE_MUTATOR
     this->dynamicProfileMutator = DynamicProfileMutator::GetMutator();
 #endif
+#ifdef DYNAMIC_PROFILE_CACHE
+    this->dynamicProfileCache = nullptr;
+#endif
 
     PERF_COUNTER_INC(Basic, ThreadContext);
 
@@ -391,6 +395,10 @@ void ThreadContext::GlobalInitialize()
     {
         builtInPropertyRecords[i]->SetHash(JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(builtInPropertyRecords[i]->GetBuffer(), builtInPropertyRecords[i]->GetLength()));
     }
+
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    PAL_SetAccessViolationFilter(Js::JavascriptFunction::AccessViolationFilter);
+#endif
 }
 
 ThreadContext::~ThreadContext()
@@ -596,6 +604,14 @@ ThreadContext::~ThreadContext()
     }
 #endif
 
+#ifdef DYNAMIC_PROFILE_CACHE
+    if (this->dynamicProfileCache != nullptr)
+    {
+        HeapDelete(this->dynamicProfileCache);
+        this->dynamicProfileCache = nullptr;
+    }
+#endif
+
 #ifdef ENABLE_PROJECTION
 #if DBG_DUMP
     if (this->projectionMemoryInformation)
@@ -617,6 +633,19 @@ ThreadContext::SetJSRTRuntime(void* runtime)
 #endif
 }
 
+#ifdef DYNAMIC_PROFILE_CACHE
+void
+ThreadContext::SetDynamicProfileCache(DynamicProfileCache * cache)
+{
+    // Script contexts that are still open save their profile to whichever cache is set when they close
+    if (this->dynamicProfileCache != nullptr)
+    {
+        HeapDelete(this->dynamicProfileCache);
+    }
+    this->dynamicProfileCache = cache;
+}
+#endif
+
 void ThreadContext::CloseForJSRT()
 {
     // This is used for JSRT APIs only.
@@ -27,6 +27,7 @@ class ScriptSite;
 class ThreadServiceWrapper;
 struct IActiveScriptProfilerHeapEnum;
 class DynamicProfileMutator;
+class DynamicProfileCache;
 class StackProber;
 
 enum DisableImplicitFlags : BYTE
@@ -1694,6 +1695,9 @@ class ThreadContext sealed :
 #endif
 #ifdef DYNAMIC_PROFILE_MUTATOR
     DynamicProfileMutator * dynamicProfileMutator;
+#endif
+#ifdef DYNAMIC_PROFILE_CACHE
+    DynamicProfileCache * dynamicProfileCache;
 #endif
     //
     // Regex helpers
@@ -1723,6 +1727,11 @@ class ThreadContext sealed :
     void* GetJSRTRuntime() const { return jsrtRuntime; }
     void SetJSRTRuntime(void* runtime);
 
+#ifdef DYNAMIC_PROFILE_CACHE
+    DynamicProfileCache * GetDynamicProfileCache() const { return dynamicProfileCache; }
+    void SetDynamicProfileCache(DynamicProfileCache * cache);
+#endif
+
 private:
     BOOL ExecuteRecyclerCollectionFunctionCommon(Recycler * recycler, CollectionFunction function, CollectionFlags flags);
 
@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+namespace Js
+{
+    void AllocationSiteInfo::RecordJitAllocationSample(AllocationSiteInfo * site, Var object, ScriptContext * scriptContext)
+    {
+        site->TakeSample(VarTo<RecyclableObject>(object), scriptContext);
+    }
+
+    void AllocationSiteInfo::TakeSample(RecyclableObject * object, ScriptContext * scriptContext)
+    {
+        Recycler * recycler = scriptContext->GetRecycler();
+
+        this->sampleCountdown = max<uint32>(CONFIG_FLAG(AllocationSiteSampleInterval), 1) - 1;
+        this->DecideSamples(recycler);
+
+        for (uint i = 0; i < SampleSlotCount; i++)
+        {
+            if (this->samples[i] == nullptr)
+            {
+                this->samples[i] = recycler->CreateWeakReferenceHandle(object);
+                this->sampleCollectionCounts[i] = recycler->GetCollectionCount();
+                return;
+            }
+        }
+
+        // Every slot is still waiting for a collection, skip this object
+    }
+
+    void AllocationSiteInfo::DecideSamples(Recycler * recycler)
+    {
+        // The collection count goes up when a collection starts. A sample can only be decided once a collection
+        // that started after it was taken has completed, otherwise its weak reference has not been swept yet.
+        const uint collectionCount = recycler->GetCollectionCount();
+        const bool inCollection = !!recycler->CollectionInProgress();
+
+        for (uint i = 0; i < SampleSlotCount; i++)
+        {
+            RecyclerWeakReference<RecyclableObject> * sample = this->samples[i];
+            if (sample == nullptr)
+            {
+                continue;
+            }
+
+            const int completedCollections = (int)(collectionCount - this->sampleCollectionCounts[i]) - (inCollection ? 1 : 0);
+            if (completedCollections <= 0)
+            {
+                continue;
+            }
+
+            if (sample->Get() != nullptr)
+            {
+                this->survivedCount++;
+            }
+            else
+            {
+                this->diedCount++;
+            }
+            this->samples[i] = nullptr;
+        }
+
+        if ((uint)(this->survivedCount + this->diedCount) >= MaxDecidedSampleCount)
+        {
+            // Age the older samples so that a site whose objects stop surviving loses its pretenuring again
+            this->survivedCount /= 2;
+            this->diedCount /= 2;
+        }
+
+        const uint survivedCount = this->survivedCount;
+        const uint decidedCount = survivedCount + this->diedCount;
+        this->isPretenured = decidedCount >= MinDecidedSampleCount &&
+            survivedCount * 100 >= decidedCount * (uint)CONFIG_FLAG(AllocationSitePretenurePercent);
+    }
+}
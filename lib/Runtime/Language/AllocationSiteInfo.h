@@ -0,0 +1,53 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Survival feedback for an object literal allocation site.
+    //
+    // One in every AllocationSiteSampleInterval objects allocated at the site is remembered through a weak reference.
+    // Once a collection has completed after the sample was taken, the sample is decided as survived or died. The jit
+    // allocates objects from sites whose samples mostly survive (see ShouldPretenure) directly in the card-tracked
+    // heap blocks, so that they do not keep sharing pages with short lived objects.
+    class AllocationSiteInfo
+    {
+    public:
+        static const uint SampleSlotCount = 4;
+        static const uint MinDecidedSampleCount = 8;
+        static const uint MaxDecidedSampleCount = 64;
+
+        // Called by the interpreter for each object allocated at the site
+        void RecordAllocation(RecyclableObject * object, ScriptContext * scriptContext)
+        {
+            if (this->sampleCountdown != 0)
+            {
+                this->sampleCountdown--;
+                return;
+            }
+            this->TakeSample(object, scriptContext);
+        }
+
+        // Called by jitted code once the sample countdown has run out
+        static void RecordJitAllocationSample(AllocationSiteInfo * site, Var object, ScriptContext * scriptContext);
+
+        bool ShouldPretenure() const { return this->isPretenured; }
+        uint GetSurvivedCount() const { return this->survivedCount; }
+        uint GetDiedCount() const { return this->diedCount; }
+
+        static uint32 GetOffsetOfSampleCountdown() { return offsetof(AllocationSiteInfo, sampleCountdown); }
+
+    private:
+        void TakeSample(RecyclableObject * object, ScriptContext * scriptContext);
+        void DecideSamples(Recycler * recycler);
+
+        Field(RecyclerWeakReference<RecyclableObject> *) samples[SampleSlotCount];
+        Field(uint) sampleCollectionCounts[SampleSlotCount];
+        Field(uint32) sampleCountdown;
+        Field(uint16) survivedCount;
+        Field(uint16) diedCount;
+        Field(bool) isPretenured;
+    };
+}
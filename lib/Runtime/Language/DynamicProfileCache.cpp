@@ -0,0 +1,117 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#ifdef DYNAMIC_PROFILE_CACHE
+DynamicProfileCache * DynamicProfileCache::New(_In_z_ char16 const * directory)
+{
+    DynamicProfileCache * cache = HeapNewNoThrow(DynamicProfileCache);
+    if (cache != nullptr && !cache->directory.Initialize(directory))
+    {
+        HeapDelete(cache);
+        return nullptr;
+    }
+    return cache;
+}
+
+bool DynamicProfileCache::GetEntryPath(_In_z_ char16 const * url, size_t urlLength, _Out_writes_z_(MAX_PATH) char16 * path)
+{
+    if (urlLength == 0 || urlLength > UINT_MAX)
+    {
+        return false;
+    }
+
+    hash_t hash = JsUtil::CharacterBuffer<char16>::StaticGetHashCode(url, (charcount_t)urlLength);
+    return directory.GetEntryPath(hash, (uint32)urlLength, 0, _u("cpf"), path);
+}
+
+char * DynamicProfileCache::ReadRecord(_In_z_ char16 const * url, _Out_ DWORD * recordSize)
+{
+    *recordSize = 0;
+
+    size_t urlLength = wcslen(url);
+    char16 path[MAX_PATH];
+    if (!GetEntryPath(url, urlLength, path))
+    {
+        return nullptr;
+    }
+
+    uint64 fileSize;
+    HANDLE file = FileCacheDirectory::OpenEntry(path, &fileSize);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    char * record = nullptr;
+    char16 * entryUrl = nullptr;
+    EntryHeader header;
+    if (!FileCacheDirectory::ReadAll(file, &header, sizeof(header)) ||
+        !header.tag.IsValid(EntryMagic) ||
+        header.urlLength != urlLength ||
+        header.recordSize == 0 ||
+        fileSize != sizeof(header) + (uint64)header.urlLength * sizeof(char16) + header.recordSize)
+    {
+        goto Done;
+    }
+
+    entryUrl = HeapNewNoThrowArray(char16, urlLength);
+    if (entryUrl == nullptr ||
+        !FileCacheDirectory::ReadAll(file, entryUrl, header.urlLength * sizeof(char16)) ||
+        wmemcmp(entryUrl, url, urlLength) != 0)
+    {
+        goto Done;
+    }
+
+    record = HeapNewNoThrowArray(char, header.recordSize);
+    if (record != nullptr && !FileCacheDirectory::ReadAll(file, record, header.recordSize))
+    {
+        HeapDeleteArray(header.recordSize, record);
+        record = nullptr;
+    }
+
+Done:
+    if (entryUrl != nullptr)
+    {
+        HeapDeleteArray(urlLength, entryUrl);
+    }
+    CloseHandle(file);
+
+    if (record != nullptr)
+    {
+        *recordSize = header.recordSize;
+    }
+    return record;
+}
+
+void DynamicProfileCache::SaveRecord(_In_z_ char16 const * url, _In_reads_bytes_(recordSize) char const * record, DWORD recordSize)
+{
+    size_t urlLength = wcslen(url);
+    char16 path[MAX_PATH];
+    if (urlLength * sizeof(char16) > MAXDWORD || !GetEntryPath(url, urlLength, path))
+    {
+        return;
+    }
+
+    EntryHeader header;
+    header.tag.Initialize(EntryMagic);
+    header.urlLength = (DWORD)urlLength;
+    header.recordSize = recordSize;
+
+    FileCacheDirectory::Part parts[] =
+    {
+        { &header, sizeof(header) },
+        { url, urlLength * sizeof(char16) },
+        { record, recordSize }
+    };
+    if (!FileCacheDirectory::WriteEntry(path, parts, _countof(parts)))
+    {
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile cache save FAILED: %s\n"), url);
+        return;
+    }
+
+    OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile cache save succeeded: %s (%d bytes)\n"), url, recordSize);
+}
+#endif
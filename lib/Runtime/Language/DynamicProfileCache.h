@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef DYNAMIC_PROFILE_CACHE
+#include "Language/FileCacheDirectory.h"
+
+//
+// File backed cache of the dynamic profile of scripts, set up by the host per runtime.
+//
+// Each script with a url has one entry in the cache directory, named after the hash of the url. The entry holds
+// the url, to reject hash collisions, followed by the serialized SourceDynamicProfileManager. Entries are written
+// when the script context closes and loaded when a script with the same url is compiled again, typically by a
+// new process, so that its functions start out with the profile observed by the previous run.
+//
+class DynamicProfileCache
+{
+public:
+    static DynamicProfileCache * New(_In_z_ char16 const * directory);
+
+    template <typename Fn>
+    Js::SourceDynamicProfileManager * Load(_In_z_ char16 const * url, Fn loadFn);
+    void SaveRecord(_In_z_ char16 const * url, _In_reads_bytes_(recordSize) char const * record, DWORD recordSize);
+
+private:
+    struct EntryHeader
+    {
+        FileCacheDirectory::EntryTag tag;
+        DWORD urlLength;
+        DWORD recordSize;
+    };
+
+    static const uint32 EntryMagic = 0x46504843; // "CHPF"
+
+    DynamicProfileCache() {}
+    bool GetEntryPath(_In_z_ char16 const * url, size_t urlLength, _Out_writes_z_(MAX_PATH) char16 * path);
+    char * ReadRecord(_In_z_ char16 const * url, _Out_ DWORD * recordSize);
+
+    FileCacheDirectory directory;
+};
+
+template <typename Fn>
+Js::SourceDynamicProfileManager *
+DynamicProfileCache::Load(_In_z_ char16 const * url, Fn loadFn)
+{
+    DWORD recordSize;
+    char * record = ReadRecord(url, &recordSize);
+    if (record == nullptr)
+    {
+        OUTPUT_VERBOSE_TRACE(Js::DynamicProfilePhase, _u("Profile cache miss: %s\n"), url);
+        return nullptr;
+    }
+
+    Js::SourceDynamicProfileManager * sourceDynamicProfileManager = loadFn(record, recordSize);
+    HeapDeleteArray(recordSize, record);
+
+    OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile cache load %s: %s\n"),
+        sourceDynamicProfileManager != nullptr ? _u("succeeded") : _u("FAILED"), url);
+    return sourceDynamicProfileManager;
+}
+#endif
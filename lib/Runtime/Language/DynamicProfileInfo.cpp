@@ -7,7 +7,7 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
@@ -20,19 +20,29 @@ namespace Js
         size_t size;
     };
 
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
-    bool DynamicProfileInfo::NeedProfileInfoList()
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
+    bool DynamicProfileInfo::NeedProfileInfoList(ThreadContext * threadContext)
     {
 #pragma prefast(suppress: 6235 6286, "(<non-zero constant> || <expression>) is always a non-zero constant. - This is wrong, DBG_DUMP is not set in some build variants")
         return DBG_DUMP
 #ifdef DYNAMIC_PROFILE_STORAGE
             || DynamicProfileStorage::IsEnabled()
 #endif
+#ifdef DYNAMIC_PROFILE_CACHE
+            || threadContext->GetDynamicProfileCache() != nullptr
+#endif
 #ifdef RUNTIME_DATA_COLLECTION
             || (Configuration::Global.flags.RuntimeDataOutputFile != nullptr)
 #endif
             ;
     }
+
+    bool DynamicProfileInfo::HasProfileInfoList(FunctionBody * functionBody)
+    {
+        // Decided by NeedProfileInfoList when the script context was created, so that the profile infos of a
+        // script context agree on whether they keep their function body even if the runtime's settings change
+        return functionBody->GetScriptContext()->GetProfileInfoList() != nullptr;
+    }
 #endif
 
     void ArrayCallSiteInfo::SetIsNotNativeIntArray()
@@ -94,8 +104,8 @@ namespace Js
         }
         else
         {
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
-            if (DynamicProfileInfo::NeedProfileInfoList())
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
+            if (DynamicProfileInfo::HasProfileInfoList(functionBody))
             {
                 info = RecyclerNewPlusZ(recycler, totalAlloc, DynamicProfileInfo, functionBody);
             }
@@ -123,8 +133,8 @@ namespace Js
     }
 
     DynamicProfileInfo::DynamicProfileInfo(FunctionBody * functionBody)
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
-        : functionBody(DynamicProfileInfo::NeedProfileInfoList() ? functionBody : nullptr)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
+        : functionBody(DynamicProfileInfo::HasProfileInfoList(functionBody) ? functionBody : nullptr)
 #endif
     {
         hasFunctionBody = true;
@@ -426,10 +436,10 @@ namespace Js
             return;
         }
         
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
         // If we persistsAcrossScriptContext, the dynamic profile info may be referred to by multiple function body from
         // different script context
-        Assert(!DynamicProfileInfo::NeedProfileInfoList() || this->persistsAcrossScriptContexts || this->functionBody == callerBody);
+        Assert(!DynamicProfileInfo::HasProfileInfoList(callerBody) || this->persistsAcrossScriptContexts || this->functionBody == callerBody);
 #endif
 
         bool doInline = true;
@@ -507,10 +517,10 @@ namespace Js
 
     void DynamicProfileInfo::RecordCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, FunctionInfo* calleeFunctionInfo, JavascriptFunction* calleeFunction, ArgSlot actualArgCount, bool isConstructorCall, InlineCacheIndex ldFldInlineCacheId)
     {
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
         // If we persistsAcrossScriptContext, the dynamic profile info may be referred to by multiple function body from
         // different script context
-        Assert(!DynamicProfileInfo::NeedProfileInfoList() || this->persistsAcrossScriptContexts || this->functionBody == functionBody);
+        Assert(!DynamicProfileInfo::HasProfileInfoList(functionBody) || this->persistsAcrossScriptContexts || this->functionBody == functionBody);
 #endif
         bool doInline = true;
         // This is a hard limit as we only use 4 bits to encode the actual count in the InlineeCallInfo
@@ -1203,9 +1213,16 @@ namespace Js
 
     void DynamicProfileInfo::Save(ScriptContext * scriptContext)
     {
-        // For now, we only support our local storage
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        bool saveToStorage = false;
 #ifdef DYNAMIC_PROFILE_STORAGE
-        if (!DynamicProfileStorage::IsEnabled())
+        saveToStorage = DynamicProfileStorage::IsEnabled();
+#endif
+        DynamicProfileCache * profileCache = nullptr;
+#ifdef DYNAMIC_PROFILE_CACHE
+        profileCache = scriptContext->GetThreadContext()->GetDynamicProfileCache();
+#endif
+        if (!saveToStorage && profileCache == nullptr)
         {
             return;
         }
@@ -1223,7 +1240,16 @@ namespace Js
             if (sourceContextInfo->sourceDynamicProfileManager != nullptr && sourceContextInfo->url != nullptr
                 && !sourceContextInfo->IsDynamic())
             {
-                sourceContextInfo->sourceDynamicProfileManager->SaveToDynamicProfileStorage(sourceContextInfo->url);
+#ifdef DYNAMIC_PROFILE_STORAGE
+                if (saveToStorage)
+                {
+                    sourceContextInfo->sourceDynamicProfileManager->SaveToDynamicProfileStorage(sourceContextInfo->url);
+                    return;
+                }
+#endif
+#ifdef DYNAMIC_PROFILE_CACHE
+                sourceContextInfo->sourceDynamicProfileManager->SaveToDynamicProfileCache(profileCache, sourceContextInfo->url);
+#endif
             }
         });
 #endif
@@ -1250,7 +1276,7 @@ namespace Js
             return false;
         }
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         this->functionBody = functionBody;
 #endif
 
@@ -1704,7 +1730,8 @@ namespace Js
                 _u(" disablePowIntTypeSpec : %s\n")
                 _u(" disableStackArgOpt : %s\n")
                 _u(" disableTagCheck : %s\n")
-                _u(" disableOptimizeTryFinally : %s\n"),
+                _u(" disableOptimizeTryFinally : %s\n")
+                _u(" wasFullJitted : %s\n"),
                 IsTrueOrFalse(this->bits.disableAggressiveIntTypeSpec),
                 IsTrueOrFalse(this->bits.disableAggressiveIntTypeSpec_jitLoopBody),
                 IsTrueOrFalse(this->bits.disableAggressiveMulIntTypeSpec),
@@ -1741,7 +1768,8 @@ namespace Js
                 IsTrueOrFalse(this->bits.disablePowIntIntTypeSpec),
                 IsTrueOrFalse(this->bits.disableStackArgOpt),
                 IsTrueOrFalse(this->bits.disableTagCheck),
-                IsTrueOrFalse(this->bits.disableOptimizeTryFinally));
+                IsTrueOrFalse(this->bits.disableOptimizeTryFinally),
+                IsTrueOrFalse(this->bits.wasFullJitted));
         }
     }
 
@@ -1863,7 +1891,7 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
 #if DBG_DUMP
     void BufferWriter::Log(DynamicProfileInfo* info)
     {
@@ -345,7 +345,7 @@ namespace Js
 
         static Var EnsureDynamicProfileInfoThunk(RecyclableObject * function, CallInfo callInfo, ...);
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         bool HasFunctionBody() const { return hasFunctionBody; }
         FunctionBody * GetFunctionBody() const { Assert(hasFunctionBody); return functionBody; }
 #endif
@@ -447,8 +447,9 @@ namespace Js
 #ifdef RUNTIME_DATA_COLLECTION
         static void DumpScriptContextToFile(ScriptContext * scriptContext);
 #endif
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
-        static bool NeedProfileInfoList();
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
+        static bool NeedProfileInfoList(ThreadContext * threadContext);
+        static bool HasProfileInfoList(FunctionBody * functionBody);
 #endif
 #ifdef DYNAMIC_PROFILE_MUTATOR
         friend class DynamicProfileMutatorImpl;
@@ -521,6 +522,7 @@ namespace Js
             Field(bool) disableStackArgOpt : 1;
             Field(bool) disableTagCheck : 1;
             Field(bool) disableOptimizeTryFinally : 1;
+            Field(bool) wasFullJitted : 1; // Saved with the profile cache, so that the next run can full JIT the function right away
         };
         Field(Bits) bits;
 
@@ -571,10 +573,10 @@ namespace Js
         template <typename T>
         static void WriteArray(uint count, WriteBarrierPtr<T> arr, FILE * file);
 #endif
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
         Field(FunctionBody *) functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         // Used by de-serialize
         DynamicProfileInfo();
 
@@ -821,6 +823,8 @@ namespace Js
         void DisableTagCheck() { this->bits.disableTagCheck = true; }
         bool IsOptimizeTryFinallyDisabled() const { return bits.disableOptimizeTryFinally; }
         void DisableOptimizeTryFinally() { this->bits.disableOptimizeTryFinally = true; }
+        bool WasFullJitted() const { return this->bits.wasFullJitted; }
+        void RecordFullJit() { this->bits.wasFullJitted = true; }
 
         static bool IsCallSiteNoInfo(Js::LocalFunctionId functionId) { return functionId == CallSiteNoInfo; }
         int IncRejitCount() { return this->rejitCount++; }
@@ -855,7 +859,7 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     class BufferReader
     {
     public:
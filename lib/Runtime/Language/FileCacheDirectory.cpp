@@ -0,0 +1,141 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+// Entries written by a different engine build are rejected by the version check
+#include "ByteCode/ByteCodeCacheReleaseFileVersion.h"
+
+void FileCacheDirectory::EntryTag::Initialize(uint32 magic)
+{
+    this->magic = magic;
+    this->version = byteCodeCacheReleaseFileVersion;
+}
+
+bool FileCacheDirectory::EntryTag::IsValid(uint32 magic) const
+{
+    return this->magic == magic && memcmp(&this->version, &byteCodeCacheReleaseFileVersion, sizeof(GUID)) == 0;
+}
+
+FileCacheDirectory::FileCacheDirectory() :
+    directory(nullptr),
+    directoryLength(0)
+{
+}
+
+FileCacheDirectory::~FileCacheDirectory()
+{
+    if (directory != nullptr)
+    {
+        HeapDeleteArray(directoryLength + 1, directory);
+    }
+}
+
+bool FileCacheDirectory::Initialize(_In_z_ const char16 * directory)
+{
+    Assert(this->directory == nullptr);
+
+    size_t length = wcslen(directory);
+    Assert(IsValidDirectoryLength(length));
+
+    char16 * copy = HeapNewNoThrowArray(char16, length + 1);
+    if (copy == nullptr)
+    {
+        return false;
+    }
+    wcscpy_s(copy, length + 1, directory);
+
+    this->directory = copy;
+    this->directoryLength = length;
+    return true;
+}
+
+bool FileCacheDirectory::GetEntryPath(hash_t hash, uint32 length, uint32 variant, _In_z_ const char16 * extension, _Out_writes_z_(MAX_PATH) char16 * path) const
+{
+    return swprintf_s(path, MAX_PATH, _u("%s/%08x%08x.%x.%s"), directory, hash, length, variant, extension) > 0;
+}
+
+HANDLE FileCacheDirectory::OpenEntry(_In_z_ const char16 * path, _Out_ uint64 * size)
+{
+    *size = 0;
+
+    HANDLE file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return INVALID_HANDLE_VALUE;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return INVALID_HANDLE_VALUE;
+    }
+
+    *size = (uint64)fileSize.QuadPart;
+    return file;
+}
+
+bool FileCacheDirectory::ReadAll(HANDLE file, _Out_writes_bytes_(length) void * buffer, size_t length)
+{
+    byte * current = (byte *)buffer;
+    while (length > 0)
+    {
+        DWORD read = 0;
+        DWORD toRead = length > MAXDWORD ? MAXDWORD : (DWORD)length;
+        if (!ReadFile(file, current, toRead, &read, nullptr) || read == 0)
+        {
+            return false;
+        }
+        current += read;
+        length -= read;
+    }
+    return true;
+}
+
+static bool WriteAll(HANDLE file, const byte * buffer, size_t length)
+{
+    while (length > 0)
+    {
+        DWORD written = 0;
+        DWORD toWrite = length > MAXDWORD ? MAXDWORD : (DWORD)length;
+        if (!WriteFile(file, buffer, toWrite, &written, nullptr) || written == 0)
+        {
+            return false;
+        }
+        buffer += written;
+        length -= written;
+    }
+    return true;
+}
+
+bool FileCacheDirectory::WriteEntry(_In_z_ const char16 * path, _In_reads_(partCount) const Part * parts, uint partCount)
+{
+    // The temporary name is private to this thread
+    char16 tempPath[MAX_PATH];
+    if (swprintf_s(tempPath, MAX_PATH, _u("%s.%x.%x.tmp"), path, GetCurrentProcessId(), GetCurrentThreadId()) <= 0)
+    {
+        return false;
+    }
+
+    HANDLE file = CreateFileW(tempPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    bool written = true;
+    for (uint i = 0; written && i < partCount; i++)
+    {
+        written = WriteAll(file, (const byte *)parts[i].buffer, parts[i].length);
+    }
+    CloseHandle(file);
+
+    if (!written || !MoveFileExW(tempPath, path, MOVEFILE_REPLACE_EXISTING))
+    {
+        DeleteFileW(tempPath);
+        return false;
+    }
+    return true;
+}
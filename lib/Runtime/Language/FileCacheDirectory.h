@@ -0,0 +1,58 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+//
+// Host provided directory backing a file cache of the engine (see JsrtByteCodeCache and DynamicProfileCache).
+//
+// Each entry is a file named after a hash and a length of its key, and starts with an EntryTag so that entries of
+// another cache or another engine build are rejected. Entries are written under a temporary name and renamed into
+// place, so that runtimes or processes sharing the directory never read a partially written entry.
+//
+class FileCacheDirectory
+{
+public:
+    // Room left in MAX_PATH for the separator, the entry name and the temporary suffix
+    static const size_t MaxEntryNameLength = 64;
+
+    struct EntryTag
+    {
+        uint32 magic;
+        GUID version;
+
+        void Initialize(uint32 magic);
+        bool IsValid(uint32 magic) const;
+    };
+
+    struct Part
+    {
+        const void * buffer;
+        size_t length;
+    };
+
+    FileCacheDirectory();
+    ~FileCacheDirectory();
+
+    static bool IsValidDirectoryLength(size_t directoryLength)
+    {
+        return directoryLength != 0 && directoryLength + MaxEntryNameLength < MAX_PATH;
+    }
+
+    bool Initialize(_In_z_ const char16 * directory);
+
+    // The variant distinguishes entries whose keys hash alike but must not share an entry
+    bool GetEntryPath(hash_t hash, uint32 length, uint32 variant, _In_z_ const char16 * extension, _Out_writes_z_(MAX_PATH) char16 * path) const;
+
+    // Returns INVALID_HANDLE_VALUE if there is no entry
+    static HANDLE OpenEntry(_In_z_ const char16 * path, _Out_ uint64 * size);
+    static bool ReadAll(HANDLE file, _Out_writes_bytes_(length) void * buffer, size_t length);
+
+    // Writes (or replaces) the entry with the concatenation of the parts
+    static bool WriteEntry(_In_z_ const char16 * path, _In_reads_(partCount) const Part * parts, uint partCount);
+
+private:
+    char16 * directory;
+    size_t directoryLength;
+};
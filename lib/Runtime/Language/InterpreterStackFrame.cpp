@@ -5562,6 +5562,7 @@ namespace Js
 
         Var newObj = JavascriptOperators::NewScObjectLiteral(GetScriptContext(), propIds,
             this->GetFunctionBody()->GetObjectLiteralTypeRef(playout->C1));
+        this->GetFunctionBody()->RecordObjectLiteralAllocation(playout->C1, newObj);
 
         SetReg(playout->R0, newObj);
     }
@@ -5574,6 +5575,7 @@ namespace Js
 
         Var newObj = JavascriptOperators::NewScObjectLiteral(GetScriptContext(), propIds,
             this->GetFunctionBody()->GetObjectLiteralTypeRef(playout->C1));
+        this->GetFunctionBody()->RecordObjectLiteralAllocation(playout->C1, newObj);
 
         SetReg(playout->R0, newObj);
 
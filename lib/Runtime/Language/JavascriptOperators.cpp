@@ -9112,6 +9112,14 @@ namespace Js
         return recycler->AllocZero(size);
     }
 
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+    void * JavascriptOperators::AllocMemForVarArrayWithBarrier(size_t size, Recycler* recycler)
+    {
+        TRACK_ALLOC_INFO(recycler, Js::Var, Recycler, 0, (size_t)(size / sizeof(Js::Var)));
+        return recycler->AllocZeroWithBarrier(size);
+    }
+#endif
+
     void * JavascriptOperators::AllocUninitializedNumber(Js::RecyclerJavascriptNumberAllocator * allocator)
     {
         TRACK_ALLOC_INFO(allocator->GetRecycler(), Js::JavascriptNumber, Recycler, 0, (size_t)-1);
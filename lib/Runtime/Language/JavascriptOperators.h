@@ -589,7 +589,20 @@ namespace Js
             return recycler->AllocZero(size);
         }
 
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+        // Used by the jit for pretenured allocation sites, see AllocationSiteInfo
+        template <typename T>
+        static void * JitRecyclerAllocWithBarrier(DECLSPEC_GUARD_OVERFLOW size_t size, Recycler* recycler)
+        {
+            TRACK_ALLOC_INFO(recycler, T, Recycler, size - sizeof(T), (size_t)-1);
+            return recycler->AllocZeroWithBarrier(size);
+        }
+#endif
+
         static void * AllocMemForVarArray(DECLSPEC_GUARD_OVERFLOW size_t size, Recycler* recycler);
+#ifdef RECYCLER_WRITE_BARRIER_JIT
+        static void * AllocMemForVarArrayWithBarrier(DECLSPEC_GUARD_OVERFLOW size_t size, Recycler* recycler);
+#endif
         static void * AllocUninitializedNumber(RecyclerJavascriptNumberAllocator * allocator);
 
         static void ScriptAbort();
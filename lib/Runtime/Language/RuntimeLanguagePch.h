@@ -25,6 +25,8 @@
 #ifdef DYNAMIC_PROFILE_STORAGE
 #include "Language/DynamicProfileStorage.h"
 #endif
+#include "Language/FileCacheDirectory.h"
+#include "Language/DynamicProfileCache.h"
 #include "Language/SourceDynamicProfileManager.h"
 
 #include "Base/EtwTrace.h"
@@ -55,7 +55,7 @@ namespace Js
     void SourceDynamicProfileManager::RemoveDynamicProfileInfo(LocalFunctionId functionId)
     {
         dynamicProfileInfoMap.Remove(functionId);
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         dynamicProfileInfoMapSaving.Remove(functionId);
 #endif
     }
@@ -315,6 +315,21 @@ namespace Js
                 return SourceDynamicProfileManager::Deserialize(&reader, recycler);
             });
         }
+#endif
+#ifdef DYNAMIC_PROFILE_CACHE
+        DynamicProfileCache * profileCache = scriptContext->GetThreadContext()->GetDynamicProfileCache();
+        if(manager == nullptr && profileCache != nullptr && info->url != nullptr && !info->IsDynamic())
+        {
+            manager = profileCache->Load(info->url, [recycler](char const * buffer, uint length) -> SourceDynamicProfileManager *
+            {
+                BufferReader reader(buffer, length);
+                return SourceDynamicProfileManager::Deserialize(&reader, recycler);
+            });
+            if(manager != nullptr)
+            {
+                manager->isLoadedFromProfileCache = true;
+            }
+        }
 #endif
         if(manager == nullptr)
         {
@@ -331,7 +346,7 @@ namespace Js
         return manager;
     }
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     void SourceDynamicProfileManager::ClearSavingData()
     {
         dynamicProfileInfoMapSaving.Reset();
@@ -466,6 +481,7 @@ namespace Js
         return true;
     }
 
+#ifdef DYNAMIC_PROFILE_STORAGE
     void
     SourceDynamicProfileManager::SaveToDynamicProfileStorage(char16 const * url)
     {
@@ -499,6 +515,43 @@ namespace Js
 
         DynamicProfileStorage::SaveRecord(url, record);
     }
+#endif
+
+#ifdef DYNAMIC_PROFILE_CACHE
+    void
+    SourceDynamicProfileManager::SaveToDynamicProfileCache(DynamicProfileCache * profileCache, char16 const * url)
+    {
+        BufferSizeCounter counter;
+        if (!this->Serialize(&counter) || counter.GetByteCount() == 0)
+        {
+            return;
+        }
+
+        if (counter.GetByteCount() > MAXDWORD)
+        {
+            // too big
+            return;
+        }
+
+        DWORD recordSize = static_cast<DWORD>(counter.GetByteCount());
+        char * record = HeapNewNoThrowArray(char, recordSize);
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        BufferWriter writer(record, recordSize);
+        if (this->Serialize(&writer))
+        {
+            profileCache->SaveRecord(url, record, recordSize);
+        }
+        else
+        {
+            Assert(false);
+        }
+        HeapDeleteArray(recordSize, record);
+    }
+#endif
 
 #endif
 };
@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 class SourceContextInfo;
+class DynamicProfileCache;
 
 #if ENABLE_PROFILE_INFO
 namespace Js
@@ -17,12 +18,16 @@ namespace Js
     //
     // For every source file, an instance of SourceDynamicProfileManager is used to save/load data.
     // It uses the WININET cache to save/load profile data.
+    // When the host sets up a DynamicProfileCache, the profile info is persisted into that cache directory.
     // For testing scenarios enabled using DYNAMIC_PROFILE_STORAGE macro, this can persist the profile info into a file as well.
     class SourceDynamicProfileManager
     {
     public:
         SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), cachedStartupFunctions(nullptr), recycler(allocator),
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_CACHE
+            isLoadedFromProfileCache(false),
+#endif
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
             dynamicProfileInfoMapSaving(&HeapAllocator::Instance),
 #endif
             dynamicProfileInfoMap(allocator), startupFunctions(nullptr), profileDataCache(nullptr) 
@@ -43,8 +48,11 @@ namespace Js
         bool IsProfileLoadedFromWinInet() { return profileDataCache != nullptr; }
         bool LoadFromProfileCache(IActiveScriptDataCache* profileDataCache, LPCWSTR url);
         IActiveScriptDataCache* GetProfileCache() { return profileDataCache; }
+#ifdef DYNAMIC_PROFILE_CACHE
+        bool IsProfileLoadedFromCache() const { return isLoadedFromProfileCache; }
+#endif
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         void ClearSavingData();
         void CopySavingData();
 #endif
@@ -53,12 +61,17 @@ namespace Js
         friend class DynamicProfileInfo;
         FieldNoBarrier(Recycler*) recycler;
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         typedef JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, HeapAllocator> DynamicProfileInfoMapSavingType;
         FieldNoBarrier(DynamicProfileInfoMapSavingType) dynamicProfileInfoMapSaving;
         
         void SaveDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo);
+#ifdef DYNAMIC_PROFILE_STORAGE
         void SaveToDynamicProfileStorage(char16 const * url);
+#endif
+#ifdef DYNAMIC_PROFILE_CACHE
+        void SaveToDynamicProfileCache(DynamicProfileCache * profileCache, char16 const * url);
+#endif
         void AddItem(LocalFunctionId functionId, DynamicProfileInfo *info);
         template <typename T>
         static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
@@ -71,6 +84,9 @@ namespace Js
     //------ Private data members -------- /
     private:
         Field(bool) isNonCachableScript;                    // Indicates if this script can be cached in WININET
+#ifdef DYNAMIC_PROFILE_CACHE
+        Field(bool) isLoadedFromProfileCache;               // Indicates if the profile was loaded from the host enabled profile cache
+#endif
         Field(IActiveScriptDataCache*) profileDataCache;    // WININET based cache to store profile info
         Field(BVFixed*) startupFunctions;                   // Bit vector representing functions that are executed at startup
         Field(BVFixed const *) cachedStartupFunctions;      // Bit vector representing functions executed at startup that are loaded from a persistent or in-memory cache
@@ -101,8 +101,15 @@ template<> Types RegisterSpace::GetRegisterSpaceType<AsmJsSIMDValue>(){return WA
             body->GetScriptContext()->GetConfig()->IsNoNative() ||
             body->GetIsAsmJsFullJitScheduled();
         const bool forceNative = CONFIG_ISENABLED(Js::ForceNativeFlag);
-        const uint minAsmJsInterpretRunCount = (uint)CONFIG_FLAG(MinAsmJsInterpreterRunCount);
+        uint minAsmJsInterpretRunCount = (uint)CONFIG_FLAG(MinAsmJsInterpreterRunCount);
         const uint maxAsmJsInterpretRunCount = (uint)CONFIG_FLAG(MaxAsmJsInterpreterRunCount);
+        if (body->IsWasmFunction() && body->GetHasLoops() &&
+            !CONFIG_ISENABLED(Js::MinAsmJsInterpreterRunCountFlag) && !CONFIG_ISENABLED(Js::MaxAsmJsInterpreterRunCountFlag))
+        {
+            // Wasm functions with loops are where compute heavy modules spend their time and the interpreter is the slowest tier for them.
+            // Schedule them for the background jit on their first call instead, they keep running in the interpreter until the code is ready.
+            minAsmJsInterpretRunCount = min(minAsmJsInterpretRunCount, (uint)CONFIG_FLAG(MinWasmLoopInterpreterRunCount));
+        }
         return !noJit && (forceNative || interpretedCount >= minAsmJsInterpretRunCount || interpretedCount >= maxAsmJsInterpretRunCount);
 #else
         return false;
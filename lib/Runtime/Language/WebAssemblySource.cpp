@@ -12,39 +12,66 @@ namespace Js
 {
 
 WebAssemblySource::WebAssemblySource(Var source, bool createNewContext, ScriptContext * scriptContext) :
-    buffer(nullptr), bufferLength(0), sourceInfo(nullptr)
+    buffer(nullptr), bufferLength(0), bufferOwner(nullptr), sourceInfo(nullptr)
 {
     ReadBufferSource(source, scriptContext);
     CreateSourceInfo(createNewContext, scriptContext);
 }
 
+WebAssemblySource::WebAssemblySource(ArrayBuffer* bytes, bool createNewContext, ScriptContext * scriptContext) :
+    buffer(bytes->GetBuffer()), bufferLength(bytes->GetByteLength()), bufferOwner(bytes), sourceInfo(nullptr)
+{
+    Assert(!bytes->IsDetached());
+    CreateSourceInfo(createNewContext, scriptContext);
+}
+
 WebAssemblySource::WebAssemblySource(byte* source, uint bufferLength, bool createNewContext, ScriptContext* scriptContext):
-    buffer(source), bufferLength(bufferLength)
+    buffer(source), bufferLength(bufferLength), bufferOwner(nullptr)
 {
     CreateSourceInfo(createNewContext, scriptContext);
 }
 
-void WebAssemblySource::ReadBufferSource(Var val, ScriptContext * scriptContext)
+ArrayBuffer* WebAssemblySource::CopyBufferSource(Var source, ScriptContext * scriptContext)
 {
     BYTE* srcBuffer;
+    uint srcBufferLength;
+    GetBufferSource(source, &srcBuffer, &srcBufferLength, scriptContext);
+
+    // copy buffer so later changes to the buffer source aren't seen by the compilation
+    ArrayBuffer* bytes = scriptContext->GetLibrary()->CreateArrayBuffer(srcBufferLength);
+    if (srcBufferLength > 0)
+    {
+        js_memcpy_s(bytes->GetBuffer(), srcBufferLength, srcBuffer, srcBufferLength);
+    }
+    return bytes;
+}
+
+void WebAssemblySource::GetBufferSource(Var val, BYTE** srcBuffer, uint* srcBufferLength, ScriptContext * scriptContext)
+{
     if (Js::TypedArrayBase::Is(val))
     {
         Js::TypedArrayBase* array = Js::TypedArrayBase::FromVar(val);
-        srcBuffer = array->GetByteBuffer();
-        bufferLength = array->GetByteLength();
+        *srcBuffer = array->GetByteBuffer();
+        *srcBufferLength = array->GetByteLength();
     }
     else if (Js::ArrayBuffer::Is(val))
     {
         Js::ArrayBuffer* arrayBuffer = Js::ArrayBuffer::FromVar(val);
-        srcBuffer = arrayBuffer->GetBuffer();
-        bufferLength = arrayBuffer->GetByteLength();
+        *srcBuffer = arrayBuffer->GetBuffer();
+        *srcBufferLength = arrayBuffer->GetByteLength();
     }
     else
     {
         // The buffer was not a TypedArray nor an ArrayBuffer
         JavascriptError::ThrowTypeError(scriptContext, WASMERR_NeedBufferSource);
     }
-    Assert(srcBuffer || bufferLength == 0);
+    Assert(*srcBuffer || *srcBufferLength == 0);
+}
+
+void WebAssemblySource::ReadBufferSource(Var val, ScriptContext * scriptContext)
+{
+    BYTE* srcBuffer;
+    GetBufferSource(val, &srcBuffer, &bufferLength, scriptContext);
     if (bufferLength > 0)
     {
         // copy buffer so external changes to it don't cause issues when defer parsing
@@ -78,7 +105,7 @@ void WebAssemblySource::CreateSourceInfo(bool createNewContext, ScriptContext* s
     // normal script debugging code ignores this source info and its functions.
     const int32 cchLength = static_cast<int32>(bufferLength / sizeof(char16));
     sourceInfo = Utf8SourceInfo::NewWithNoCopy(
-        scriptContext, (LPCUTF8)buffer, cchLength, bufferLength, srcInfo, /*isLibraryCode*/true);
+        scriptContext, (LPCUTF8)buffer, cchLength, bufferLength, srcInfo, /*isLibraryCode*/true, bufferOwner);
     scriptContext->SaveSourceNoCopy(sourceInfo, cchLength, /*isCesu8*/false);
 }
 
@@ -12,16 +12,24 @@ namespace Js
     {
         BYTE* buffer;
         uint bufferLength;
+        // The ArrayBuffer holding the bytes, when they aren't a copy on the recycler
+        Var bufferOwner;
         Js::Utf8SourceInfo* sourceInfo;
     public:
         WebAssemblySource(Var source, bool createNewContext, ScriptContext* scriptContext);
+        // Uses the bytes copied by CopyBufferSource as is, the ArrayBuffer must not be exposed to script
+        WebAssemblySource(ArrayBuffer* bytes, bool createNewContext, ScriptContext* scriptContext);
         // Caller is responsible to make a copy of the buffer source
         WebAssemblySource(BYTE* source, uint bufferLength, bool createNewContext, ScriptContext* scriptContext);
 
+        static ArrayBuffer* CopyBufferSource(Var source, ScriptContext* scriptContext);
+
         BYTE* GetBuffer() const { return buffer; }
         uint GetBufferLength() const { return bufferLength; }
+        Var GetBufferOwner() const { return bufferOwner; }
         Js::Utf8SourceInfo* GetSourceInfo() const { return sourceInfo; }
     private:
+        static void GetBufferSource(Var val, BYTE** srcBuffer, uint* srcBufferLength, ScriptContext* scriptContext);
         void ReadBufferSource(Var val, ScriptContext* scriptContext);
         void CreateSourceInfo(bool createNewContext, ScriptContext* scriptContext);
     };
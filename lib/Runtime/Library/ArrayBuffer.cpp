@@ -6,6 +6,26 @@
 
 namespace Js
 {
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    uintptr_t VirtualBufferReservationTraits::Encode(void* address, size_t reservationSize)
+    {
+        Assert(((uintptr_t)address & 1) == 0);
+        Assert(reservationSize == MAX_ASMJS_ARRAYBUFFER_LENGTH || reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH);
+
+        return (uintptr_t)address | (reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH ? 1 : 0);
+    }
+
+    uintptr_t VirtualBufferReservationTraits::GetBase(uintptr_t entry)
+    {
+        return entry & ~(uintptr_t)1;
+    }
+
+    size_t VirtualBufferReservationTraits::GetSize(uintptr_t entry)
+    {
+        return (entry & 1) ? MAX_WASM__ARRAYBUFFER_LENGTH : MAX_ASMJS_ARRAYBUFFER_LENGTH;
+    }
+#endif
+
     bool ArrayBufferBase::Is(Var value)
     {
         return ArrayBuffer::Is(value) || SharedArrayBuffer::Is(value);
@@ -11,6 +11,18 @@ namespace Js
     class ArrayBufferParent;
     class ArrayBuffer;
     class SharedArrayBuffer;
+
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    // Each entry is a reservation's base address, with the low bit set for WebAssembly (8GB) reservations
+    struct VirtualBufferReservationTraits
+    {
+        static uintptr_t Encode(void* address, size_t reservationSize);
+        static uintptr_t GetBase(uintptr_t entry);
+        static size_t GetSize(uintptr_t entry);
+    };
+    typedef SignalSafeRangeTable<VirtualBufferReservationTraits, 16384> VirtualBufferReservations;
+#endif
+
     class ArrayBufferBase : public DynamicObject
     {
     protected:
@@ -30,6 +42,14 @@ namespace Js
                 return nullptr;
             }
 
+#ifdef DISABLE_SEH
+            if (!VirtualBufferReservations::Add(address, MaxVirtualSize))
+            {
+                VirtualFree(address, 0, MEM_RELEASE);
+                return nullptr;
+            }
+#endif
+
             if (length == 0)
             {
                 return address;
@@ -38,6 +58,9 @@ namespace Js
             LPVOID arrayAddress = VirtualAlloc(address, length, MEM_COMMIT, PAGE_READWRITE);
             if (!arrayAddress)
             {
+#ifdef DISABLE_SEH
+                VirtualBufferReservations::Remove(address);
+#endif
                 VirtualFree(address, 0, MEM_RELEASE);
                 return nullptr;
             }
@@ -46,6 +69,11 @@ namespace Js
 
         static void FreeMemAlloc(Var ptr)
         {
+#ifdef DISABLE_SEH
+            // Forget the reservation before the address range can be reused
+            bool removed = VirtualBufferReservations::Remove(ptr);
+            AssertMsg(removed, "Freeing a virtual buffer that was not registered");
+#endif
             BOOL fSuccess = VirtualFree((LPVOID)ptr, 0, MEM_RELEASE);
             Assert(fSuccess);
         }
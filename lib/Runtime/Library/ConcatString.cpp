@@ -26,6 +26,15 @@ namespace Js
     {
     }
 
+    LiteralStringWithPropertyStringPtr::LiteralStringWithPropertyStringPtr(const byte * oneByteBuffer,
+      const CharCount stringLength, JavascriptLibrary *const library) :
+        LiteralString(library->GetStringTypeStatic()),
+        propertyString(nullptr),
+        oneByteBuffer(oneByteBuffer)
+    {
+        this->SetLength(stringLength);
+    }
+
     JavascriptString * LiteralStringWithPropertyStringPtr::
     NewFromWideString(const char16 * wideString, const CharCount charCount, JavascriptLibrary *const library)
     {
@@ -68,6 +77,16 @@ namespace Js
         return (JavascriptString*) RecyclerNew(library->GetRecycler(), LiteralStringWithPropertyStringPtr, _u(""), 0, library);
     }
 
+    static bool IsAscii(const char * cString, const CharCount charCount)
+    {
+        char bits = 0;
+        for (CharCount i = 0; i < charCount; i++)
+        {
+            bits |= cString[i];
+        }
+        return (bits & 0x80) == 0;
+    }
+
     JavascriptString * LiteralStringWithPropertyStringPtr::
       NewFromCString(const char * cString, const CharCount charCount, JavascriptLibrary *const library)
     {
@@ -99,13 +118,21 @@ namespace Js
         }
 
         ScriptContext * scriptContext = library->GetScriptContext();
+        Recycler * recycler = library->GetRecycler();
+        if (OneByteString::ShouldUseFor(charCount) && IsAscii(cString, charCount))
+        {
+            // ASCII is the same in UTF-8 and Latin-1, keep it at one byte per character
+            byte * oneByteBuffer = RecyclerNewArrayLeaf(recycler, byte, charCount);
+            js_memcpy_s(oneByteBuffer, charCount, cString, charCount);
+            return (JavascriptString*) RecyclerNew(recycler, LiteralStringWithPropertyStringPtr, oneByteBuffer, charCount, library);
+        }
+
         size_t cbDestString = (charCount + 1) * sizeof(WCHAR);
         if ((CharCount)cbDestString < charCount) // overflow
         {
             Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
         }
 
-        Recycler * recycler = library->GetRecycler();
         char16* destString = RecyclerNewArrayLeaf(recycler, WCHAR, cbDestString);
         if (destString == nullptr)
         {
@@ -136,9 +163,10 @@ namespace Js
 
         ScriptContext * scriptContext = this->GetScriptContext();
 
+        const char16 * sz = this->GetSz();
         if (this->propertyRecord == nullptr)
         {
-            scriptContext->GetOrAddPropertyRecord(this->GetSz(), static_cast<int>(this->GetLength()),
+            scriptContext->GetOrAddPropertyRecord(sz, static_cast<int>(this->GetLength()),
                 (Js::PropertyRecord const **)&(this->propertyRecord));
         }
 
@@ -151,10 +179,53 @@ namespace Js
         this->propertyString = propStr;
         if (propStr != nullptr)
         {
+            // The property record takes the place of the one byte buffer
+            this->GetSz();
             this->propertyRecord = propStr->GetPropertyRecord();
         }
     }
 
+    const byte * LiteralStringWithPropertyStringPtr::GetOneByteBuffer() const
+    {
+        return this->IsFinalized() ? nullptr : this->oneByteBuffer;
+    }
+
+    const char16* LiteralStringWithPropertyStringPtr::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return __super::GetSz();
+        }
+
+        const char16 * buffer = OneByteString::Widen(this->oneByteBuffer, this->GetLength(), this->GetRecycler());
+        this->SetBuffer(buffer);
+
+        // Everything reads the char16 buffer from now on, and the slot is needed for the property record
+        this->oneByteBuffer = nullptr;
+
+        return buffer;
+    }
+
+    void LiteralStringWithPropertyStringPtr::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+
+        OneByteString::WidenCopy(buffer, this->oneByteBuffer, this->GetLength());
+    }
+
+    size_t LiteralStringWithPropertyStringPtr::GetAllocatedByteCount() const
+    {
+        if (!this->IsFinalized())
+        {
+            return this->GetLength();
+        }
+        return __super::GetAllocatedByteCount();
+    }
+
     /* static */
     bool LiteralStringWithPropertyStringPtr::Is(RecyclableObject * obj)
     {
@@ -171,6 +242,16 @@ namespace Js
     {
         ScriptContext * scriptContext = this->GetScriptContext();
 
+        if (!this->IsFinalized())
+        {
+            // Still holds the one byte buffer, so there is no property record yet
+            if (dontLookupFromDictionary)
+            {
+                return nullptr;
+            }
+            this->GetSz();
+        }
+
         if (this->propertyRecord == nullptr && !dontLookupFromDictionary)
         {
             scriptContext->GetOrAddPropertyRecord(this->GetSz(), static_cast<int>(this->GetLength()),
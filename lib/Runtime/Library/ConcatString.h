@@ -10,11 +10,26 @@ namespace Js
     {
     private:
         Field(PropertyString*) propertyString;
-        Field(const Js::PropertyRecord*) propertyRecord;
+        union
+        {
+            Field(const Js::PropertyRecord*) propertyRecord;
+
+            // Used instead while an ASCII string from NewFromCString is not widened. The property record is
+            // only looked up from the char16 contents, so the two are never needed at the same time. (A new
+            // field would make the object larger than the concat strings that ConvertString turns into it.)
+            Field(const byte*) oneByteBuffer;
+        };
 
     public:
         virtual Js::PropertyRecord const * GetPropertyRecord(bool dontLookupFromDictionary = false) override;
 
+        // Returns nullptr once the string has been widened
+        const byte * GetOneByteBuffer() const;
+
+        virtual const char16* GetSz() override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+        virtual size_t GetAllocatedByteCount() const override;
+
         PropertyString * GetPropertyString() const;
         PropertyString * GetOrAddPropertyString(); // Get if it's there, otherwise bring it in.
         void SetPropertyString(PropertyString * propStr);
@@ -37,6 +52,7 @@ namespace Js
     protected:
         LiteralStringWithPropertyStringPtr(StaticType* stringTypeStatic);
         LiteralStringWithPropertyStringPtr(const char16 * wString, const CharCount stringLength, JavascriptLibrary *const library);
+        LiteralStringWithPropertyStringPtr(const byte * oneByteBuffer, const CharCount stringLength, JavascriptLibrary *const library);
 
         DEFINE_VTABLE_CTOR(LiteralStringWithPropertyStringPtr, LiteralString);
 
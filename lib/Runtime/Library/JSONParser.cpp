@@ -205,7 +205,14 @@ namespace JSON
             {
                 // will auto-null-terminate the string (as length=len+1)
                 uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                if (m_scanner.IsCurrentStringOneByte() && Js::OneByteString::ShouldUseFor(len))
+                {
+                    retVal = Js::OneByteString::NewFromLatin1(m_scanner.GetCurrentString(), len, scriptContext);
+                }
+                else
+                {
+                    retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                }
                 Scan();
                 return retVal;
             }
@@ -12,7 +12,7 @@ namespace JSON
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
-        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0)
+        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0), currentStringIsOneByte(false)
     {
     }
 
@@ -230,10 +230,12 @@ namespace JSON
         bool isStringDirectInputTextMapped = true;
         LPCWSTR bulkStart = currentChar;
         uint bulkLength = 0;
+        char16 charBits = 0;    // all characters of the string or'ed together
 
         while (currentChar < inputText + inputLen)
         {
             ch = ReadNextChar();
+            charBits |= ch;
             int tempHex;
 
             if (ch == '"')
@@ -337,6 +339,8 @@ namespace JSON
                    ThrowSyntaxError(JSERR_JsonIllegalChar);
                 }
 
+                charBits |= ch;
+
                 // flush
                 this->GetCurrentRangeCharacterPairList()->Add(RangeCharacterPair((uint)(bulkStart - inputText), bulkLength, ch));
 
@@ -370,6 +374,8 @@ namespace JSON
            ThrowSyntaxError(JSERR_JsonNoStrEnd);
         }
 
+        this->currentStringIsOneByte = charBits <= 0xFF;
+
         if (isStringDirectInputTextMapped == false)
         {
             // If the last bulk is not ended with an escape character, make sure that is
@@ -22,6 +22,7 @@ namespace JSON
         void Finalizer();
         char16* GetCurrentString() { return currentString; } 
         uint GetCurrentStringLen() { return currentIndex; }
+        bool IsCurrentStringOneByte() { return currentStringIsOneByte; }
         uint GetScanPosition() { return uint(currentChar - inputText); }
 
         void __declspec(noreturn) ThrowSyntaxError(int wErr)
@@ -76,6 +77,7 @@ namespace JSON
 
         uint     currentIndex;
         char16* currentString;
+        bool     currentStringIsOneByte;
         __field_ecount(stringBufferLength) char16* stringBuffer;
         int      stringBufferLength;
 
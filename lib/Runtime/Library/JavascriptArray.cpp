@@ -6528,39 +6528,13 @@ namespace Js
 
     static void hybridSort(__inout_ecount(length) Field(Var) *elements, uint32 length, CompareVarsInfo* compareInfo)
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
-        {
-            qsort_s(elements, length, compareVars, compareInfo);
-            return;
-        }
+        typedef JsUtil::TimSort<Field(Var), int(__cdecl*)(void*, const void*, const void*)> VarTimSort;
 
-        for (int i = 1; i < (int)length; i++)
-        {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
-                {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
-                    {
-                        last = middle - 1;
-                    }
-                    else
-                    {
-                        first = middle + 1;
-                    }
-                }
-
-                // insert value right before first:
-                Var value = elements[i];
-                MoveArray(elements + first + 1, elements + first, (i - first));
-                elements[first] = value;
-            }
-        }
+        // Short arrays are sorted with binary insertion sort and need no scratch buffer. The scratch
+        // buffer is recycler memory so that the elements it holds during a merge stay alive.
+        size_t scratchCount = VarTimSort::GetScratchCount(length);
+        Field(Var) *scratch = scratchCount != 0 ? RecyclerNewArrayZ(compareInfo->scriptContext->GetRecycler(), Field(Var), scratchCount) : nullptr;
+        VarTimSort::Sort(elements, length, scratch, compareVars, compareInfo);
     }
 
     void JavascriptArray::Sort(RecyclableObject* compFn)
@@ -6812,8 +6786,12 @@ namespace Js
 
     void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
     {
-        // Note: use write barrier policy of Field(Var)
-        qsort_s<Element, Field(Var)>(elements, right - left + 1, CompareElements, this);
+        typedef JsUtil::TimSort<Element, int(__cdecl*)(void*, const void*, const void*)> ElementTimSort;
+
+        size_t count = right - left + 1;
+        size_t scratchCount = ElementTimSort::GetScratchCount(count);
+        Element *scratch = scratchCount != 0 ? RecyclerNewArrayZ(this->GetScriptContext()->GetRecycler(), Element, scratchCount) : nullptr;
+        ElementTimSort::Sort(elements + left, count, scratch, CompareElements, this);
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -685,9 +685,9 @@ namespace Js
 #endif
 
 #ifdef DISABLE_SEH
-        // xplat: JavascriptArrayBuffer::AllocWrapper is disabled on cross-platform
-        // (IsValidVirtualBufferLength always returns false).
-        // SEH and ResumeForOutOfBoundsArrayRefs are not needed.
+        // xplat: there is no SEH. When virtual ArrayBuffers are enabled, out-of-bounds
+        // accesses are recovered by the PAL access violation filter instead
+        // (see JavascriptFunction::AccessViolationFilter).
         ret = JavascriptFunction::CallRootFunctionInternal(obj, args, scriptContext, inScript);
 #else
         if (scriptContext->GetThreadContext()->GetAbnormalExceptionCode() != 0)
@@ -2253,6 +2253,110 @@ void __cdecl _alloca_probe_16()
     }
 
 #if ENABLE_FAST_ARRAYBUFFER
+#ifdef DISABLE_SEH
+    // xplat: the access violation is reported from a signal handler, which can neither throw nor
+    // safely look at the runtime. ResumeAfterOutOfBoundsArrayRef makes the faulting code "call"
+    // this helper instead, with the faulting frame and the address after the faulting instruction.
+    static void __cdecl ThrowWasmOutOfBoundsTrap(Var* framePointer, void* returnAddress)
+    {
+        ThreadContext* threadContext = ThreadContext::GetContextForCurrentThread();
+        if (threadContext == nullptr || !threadContext->IsNativeAddress(returnAddress))
+        {
+            // The signal handler only checked the addresses against the registered ranges
+            Js::Throw::FatalInternalError();
+        }
+
+        // JITed frames keep the function object right above the return address
+        Var func = framePointer[2];
+        if (func == nullptr || !ScriptFunction::Is(func))
+        {
+            Js::Throw::FatalInternalError();
+        }
+        JavascriptError::ThrowWebAssemblyRuntimeError(ScriptFunction::FromVar(func)->GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+#endif
+
+    // Decodes the faulting heap access and updates the context to resume after it. Only touches
+    // the context and the code at the faulting pc, so it can also run from a signal handler.
+    static bool ResumeAfterOutOfBoundsArrayRef(PEXCEPTION_POINTERS exceptionInfo, bool isWasmOnly, ScriptContext* scriptContext)
+    {
+        BYTE* pc = (BYTE*)exceptionInfo->ExceptionRecord->ExceptionAddress;
+        ArrayAccessDecoder::InstructionData instrData = ArrayAccessDecoder::CheckValidInstr(pc, exceptionInfo);
+        // Check If the instruction is valid
+        if (instrData.isInvalidInstr)
+        {
+            return false;
+        }
+
+        // If we didn't find the array buffer, ignore
+        if (!instrData.bufferValue)
+        {
+            return false;
+        }
+
+        if (isWasmOnly)
+        {
+#ifdef DISABLE_SEH
+            // Push the address of the next instruction as the return address, so the unwinder
+            // attributes the throw to the JITed frame. JITed code keeps rsp 16-byte aligned.
+            PCONTEXT context = exceptionInfo->ContextRecord;
+            if ((context->Rsp & 0xF) != 0)
+            {
+                return false;
+            }
+            DWORD64 resumeAddress = context->Rip + instrData.instrSizeInByte;
+            context->Rsp -= sizeof(DWORD64);
+            *(DWORD64*)context->Rsp = resumeAddress;
+            context->Rdi = context->Rbp;
+            context->Rsi = resumeAddress;
+            context->Rip = (DWORD64)ThrowWasmOutOfBoundsTrap;
+            return true;
+#else
+            JavascriptError::ThrowWebAssemblyRuntimeError(scriptContext, WASMERR_ArrayIndexOutOfRange);
+#endif
+        }
+
+        // SIMD loads/stores do bounds checks.
+        if (instrData.isSimd)
+        {
+            return false;
+        }
+
+        // Set the dst reg if the instr type is load
+        if (instrData.isLoad)
+        {
+            Var exceptionInfoReg = exceptionInfo->ContextRecord;
+            Var* exceptionInfoIntReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Rax)); // offset in the contextRecord for RAX , the assert below checks for any change in the exceptionInfo struct
+            Var* exceptionInfoFloatReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Xmm0));// offset in the contextRecord for XMM0 , the assert below checks for any change in the exceptionInfo struct
+            Assert((DWORD64)*exceptionInfoIntReg == exceptionInfo->ContextRecord->Rax);
+            Assert((uint64)*exceptionInfoFloatReg == exceptionInfo->ContextRecord->Xmm0.Low);
+
+            if (instrData.isLoad)
+            {
+                double nanVal = JavascriptNumber::NaN;
+                if (instrData.isFloat64)
+                {
+                    double* destRegLocation = (double*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
+                    *destRegLocation = nanVal;
+                }
+                else if (instrData.isFloat32)
+                {
+                    float* destRegLocation = (float*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
+                    *destRegLocation = (float)nanVal;
+                }
+                else
+                {
+                    uint64* destRegLocation = (uint64*)((uint64)exceptionInfoIntReg + 8 * (instrData.dstReg));
+                    *destRegLocation = 0;
+                }
+            }
+        }
+        // Add the bytes read to Rip and set it as new Rip
+        exceptionInfo->ContextRecord->Rip = exceptionInfo->ContextRecord->Rip + instrData.instrSizeInByte;
+
+        return true;
+    }
+
     bool ResumeForOutOfBoundsArrayRefs(int exceptionCode, ExceptionFilterHelper& helper)
     {
         if (exceptionCode != STATUS_ACCESS_VIOLATION)
@@ -2338,65 +2442,7 @@ void __cdecl _alloca_probe_16()
             }
         }
 
-        PEXCEPTION_POINTERS exceptionInfo = helper.GetExceptionInfo();
-        BYTE* pc = (BYTE*)exceptionInfo->ExceptionRecord->ExceptionAddress;
-        ArrayAccessDecoder::InstructionData instrData = ArrayAccessDecoder::CheckValidInstr(pc, exceptionInfo);
-        // Check If the instruction is valid
-        if (instrData.isInvalidInstr)
-        {
-            return false;
-        }
-
-        // If we didn't find the array buffer, ignore
-        if (!instrData.bufferValue)
-        {
-            return false;
-        }
-
-        if (isWasmOnly)
-        {
-            JavascriptError::ThrowWebAssemblyRuntimeError(func->GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
-        }
-
-        // SIMD loads/stores do bounds checks.
-        if (instrData.isSimd)
-        {
-            return false;
-        }
-
-        // Set the dst reg if the instr type is load
-        if (instrData.isLoad)
-        {
-            Var exceptionInfoReg = exceptionInfo->ContextRecord;
-            Var* exceptionInfoIntReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Rax)); // offset in the contextRecord for RAX , the assert below checks for any change in the exceptionInfo struct
-            Var* exceptionInfoFloatReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Xmm0));// offset in the contextRecord for XMM0 , the assert below checks for any change in the exceptionInfo struct
-            Assert((DWORD64)*exceptionInfoIntReg == exceptionInfo->ContextRecord->Rax);
-            Assert((uint64)*exceptionInfoFloatReg == exceptionInfo->ContextRecord->Xmm0.Low);
-
-            if (instrData.isLoad)
-            {
-                double nanVal = JavascriptNumber::NaN;
-                if (instrData.isFloat64)
-                {
-                    double* destRegLocation = (double*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
-                    *destRegLocation = nanVal;
-                }
-                else if (instrData.isFloat32)
-                {
-                    float* destRegLocation = (float*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
-                    *destRegLocation = (float)nanVal;
-                }
-                else
-                {
-                    uint64* destRegLocation = (uint64*)((uint64)exceptionInfoIntReg + 8 * (instrData.dstReg));
-                    *destRegLocation = 0;
-                }
-            }
-        }
-        // Add the bytes read to Rip and set it as new Rip
-        exceptionInfo->ContextRecord->Rip = exceptionInfo->ContextRecord->Rip + instrData.instrSizeInByte;
-
-        return true;
+        return ResumeAfterOutOfBoundsArrayRef(helper.GetExceptionInfo(), isWasmOnly, func->GetScriptContext());
     }
 #endif
 #endif
@@ -2420,6 +2466,36 @@ void __cdecl _alloca_probe_16()
         return EXCEPTION_CONTINUE_SEARCH;
     }
 
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    BOOL JavascriptFunction::AccessViolationFilter(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        // Called from the SIGSEGV handler, on any thread. Unlike CallRootEventFilter this must not
+        // take locks or read memory that may not be mapped, so the fault is recognised from the
+        // registered code segments and buffer reservations alone. 8GB reservations only back
+        // WebAssembly memory.
+#if ENABLE_NATIVE_CODEGEN
+        if (exceptionInfo->ExceptionRecord->ExceptionCode != STATUS_ACCESS_VIOLATION)
+        {
+            return FALSE;
+        }
+        // Only JITed code relies on the reservation for its bound checks
+        if (CodeSegmentRanges::Find((uintptr_t)exceptionInfo->ExceptionRecord->ExceptionAddress) == 0)
+        {
+            return FALSE;
+        }
+        size_t reservationSize = VirtualBufferReservations::Find(exceptionInfo->ExceptionRecord->ExceptionInformation[1]);
+        if (reservationSize == 0)
+        {
+            return FALSE;
+        }
+        return ResumeAfterOutOfBoundsArrayRef(exceptionInfo, reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH, nullptr);
+#else
+        // Bound checks are only removed from JITed code
+        return FALSE;
+#endif
+    }
+#endif
+
 #if DBG
     void JavascriptFunction::VerifyEntryPoint()
     {
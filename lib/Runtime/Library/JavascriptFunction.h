@@ -228,6 +228,10 @@ namespace Js
         void VerifyEntryPoint();
 
         static bool IsBuiltinProperty(Var objectWithProperty, PropertyIds propertyId);
+#endif
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+        // Registered with the PAL to recover from out-of-bounds virtual ArrayBuffer accesses
+        static BOOL AccessViolationFilter(PEXCEPTION_POINTERS exceptionInfo);
 #endif
         private:
             static int CallRootEventFilter(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo);
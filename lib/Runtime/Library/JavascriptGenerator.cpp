@@ -15,7 +15,7 @@ namespace Js
     JavascriptGenerator* JavascriptGenerator::New(Recycler* recycler, DynamicType* generatorType, Arguments& args, ScriptFunction* scriptFunction)
     {
 #if GLOBAL_ENABLE_WRITE_BARRIER
-        if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+        if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
         {
             JavascriptGenerator* obj = RecyclerNewFinalized(
                 recycler, JavascriptGenerator, generatorType, args, scriptFunction);
@@ -54,7 +54,7 @@ namespace Js
         Assert(this->frame == nullptr);
         this->frame = frame;
 #if GLOBAL_ENABLE_WRITE_BARRIER
-        if (CONFIG_FLAG(ForceSoftwareWriteBarrier))
+        if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER())
         {
             this->GetScriptContext()->GetRecycler()->RegisterPendingWriteBarrierBlock(frame, bytes);
         }
@@ -64,7 +64,7 @@ namespace Js
 #if GLOBAL_ENABLE_WRITE_BARRIER
     void JavascriptGenerator::Finalize(bool isShutdown)
     {
-        if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && !isShutdown)
+        if (CONFIG_FORCE_SOFTWARE_WRITE_BARRIER() && !isShutdown)
         {
             if (this->frame)
             {
@@ -86,7 +86,7 @@ namespace Js
         Field(ScriptContextPolymorphicInlineCache*) toStringTagCache;
         Field(ScriptContextPolymorphicInlineCache*) toJSONCache;
 #if ENABLE_PROFILE_INFO
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_SERIALIZATION) || defined(RUNTIME_DATA_COLLECTION)
         Field(DynamicProfileInfoList*) profileInfoList;
 #endif
 #endif
@@ -426,7 +426,7 @@ namespace Js
 #ifdef ENABLE_WASM
         Field(DynamicObject*) webAssemblyObject;
         Field(JavascriptFunction*) webAssemblyQueryResponseFunction;
-        Field(JavascriptFunction*) webAssemblyCompileFunction;
+        Field(JavascriptFunction*) webAssemblyCompileJobFunction;
         Field(JavascriptFunction*) webAssemblyInstantiateBoundFunction;
 #endif
 
@@ -810,7 +810,7 @@ namespace Js
         DynamicType * GetWebAssemblyTableType() const { return webAssemblyTableType; }
 #ifdef ENABLE_WASM
         JavascriptFunction* GetWebAssemblyQueryResponseFunction() const { return webAssemblyQueryResponseFunction; }
-        JavascriptFunction* GetWebAssemblyCompileFunction() const { return webAssemblyCompileFunction; }
+        JavascriptFunction* GetWebAssemblyCompileJobFunction() const { return webAssemblyCompileJobFunction; }
         JavascriptFunction* GetWebAssemblyInstantiateBoundFunction() const { return webAssemblyInstantiateBoundFunction; }
 #endif
 
@@ -14,7 +14,7 @@ namespace Js
     JavascriptMap* JavascriptMap::New(ScriptContext* scriptContext)
     {
         JavascriptMap* map = scriptContext->GetLibrary()->CreateMap();
-        map->map = RecyclerNew(scriptContext->GetRecycler(), MapDataMap, scriptContext->GetRecycler());
+        map->table.Initialize(scriptContext->GetRecycler());
 
         return map;
     }
@@ -38,9 +38,9 @@ namespace Js
         return static_cast<JavascriptMap *>(aValue);
     }
 
-    JavascriptMap::MapDataList::Iterator JavascriptMap::GetIterator()
+    JavascriptMap::MapDataTable::Iterator JavascriptMap::GetIterator()
     {
-        return list.GetIterator();
+        return table.GetIterator();
     }
 
     Var JavascriptMap::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -70,15 +70,15 @@ namespace Js
 
         Var iterable = (args.Info.Count > 1) ? args[1] : library->GetUndefined();
 
-        if (mapObject->map != nullptr)
+        if (mapObject->table.IsInitialized())
         {
             JavascriptError::ThrowTypeErrorVar(scriptContext, JSERR_ObjectIsAlreadyInitialized, _u("Map"), _u("Map"));
         }
 
-        /* Ensure mapObject->map is created before trying to fetch the adder function. If Map.prototype.set has
+        /* Ensure mapObject->table is initialized before trying to fetch the adder function. If Map.prototype.set has
            its getter set to another Map method (such as Map.prototype.get) and we try to get the function before
            the map is initialized, it will cause a null dereference. See github#2747 */
-        mapObject->map = RecyclerNew(scriptContext->GetRecycler(), MapDataMap, scriptContext->GetRecycler());
+        mapObject->table.Initialize(scriptContext->GetRecycler());
 
         RecyclableObject* iter = nullptr;
         RecyclableObject* adder = nullptr;
@@ -349,27 +349,20 @@ namespace Js
 
     void JavascriptMap::Clear()
     {
-        list.Clear();
-        map->Clear();
+        table.Clear(GetScriptContext()->GetRecycler());
     }
 
     bool JavascriptMap::Delete(Var key)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            list.Remove(node);
-            return map->Remove(key);
-        }
-        return false;
+        return table.Remove(key);
     }
 
     bool JavascriptMap::Get(Var key, Var* value)
     {
-        if (map->ContainsKey(key))
+        const MapDataKeyValuePair* data = table.Find(key);
+        if (data != nullptr)
         {
-            MapDataNode* node = map->Item(key);
-            *value = node->data.Value();
+            *value = data->Value();
             return true;
         }
         return false;
@@ -377,27 +370,17 @@ namespace Js
 
     bool JavascriptMap::Has(Var key)
     {
-        return map->ContainsKey(key);
+        return table.Has(key);
     }
 
     void JavascriptMap::Set(Var key, Var value)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            node->data = MapDataKeyValuePair(key, value);
-        }
-        else
-        {
-            MapDataKeyValuePair pair(key, value);
-            MapDataNode* node = list.Append(pair, GetScriptContext()->GetRecycler());
-            map->Add(key, node);
-        }
+        table.Add(key, MapDataKeyValuePair(key, value), true /*overwrite*/, GetScriptContext()->GetRecycler());
     }
 
     int JavascriptMap::Size()
     {
-        return map->Count();
+        return table.Count();
     }
 
     BOOL JavascriptMap::GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext)
@@ -459,7 +442,7 @@ namespace Js
     JavascriptMap* JavascriptMap::CreateForSnapshotRestore(ScriptContext* ctx)
     {
         JavascriptMap* res = ctx->GetLibrary()->CreateMap();
-        res->map = RecyclerNew(ctx->GetRecycler(), MapDataMap, ctx->GetRecycler());
+        res->table.Initialize(ctx->GetRecycler());
 
         return res;
     }
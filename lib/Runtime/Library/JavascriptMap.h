@@ -10,15 +10,12 @@ namespace Js
     {
     public:
         typedef JsUtil::KeyValuePair<Field(Var), Field(Var)> MapDataKeyValuePair;
-        typedef MapOrSetDataNode<MapDataKeyValuePair> MapDataNode;
-        typedef MapOrSetDataList<MapDataKeyValuePair> MapDataList;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> MapDataMap;
+        typedef MapOrSetDataTable<MapDataKeyValuePair> MapDataTable;
 
     private:
-        Field(MapDataList) list;
-        Field(MapDataMap*) map;
+        Field(MapDataTable) table;
 
-        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptMap, DynamicObject, list);
+        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptMap, DynamicObject, table);
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JavascriptMap);
 
     public:
@@ -37,7 +34,7 @@ namespace Js
         void Set(Var key, Var value);
         int Size();
 
-        MapDataList::Iterator GetIterator();
+        MapDataTable::Iterator GetIterator();
 
         virtual BOOL GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext) override;
 
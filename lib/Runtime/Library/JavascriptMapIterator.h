@@ -17,7 +17,7 @@ namespace Js
     {
     private:
         Field(JavascriptMap*)                          m_map;
-        Field(JavascriptMap::MapDataList::Iterator)    m_mapIterator;
+        Field(JavascriptMap::MapDataTable::Iterator)   m_mapIterator;
         Field(JavascriptMapIteratorKind)               m_kind;
 
     protected:
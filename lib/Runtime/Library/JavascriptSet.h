@@ -9,15 +9,12 @@ namespace Js
     class JavascriptSet : public DynamicObject
     {
     public:
-        typedef MapOrSetDataNode<Var> SetDataNode;
-        typedef MapOrSetDataList<Var> SetDataList;
-        typedef JsUtil::BaseDictionary<Var, SetDataNode*, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> SetDataSet;
+        typedef MapOrSetDataTable<Var> SetDataTable;
 
     private:
-        Field(SetDataList) list;
-        Field(SetDataSet*) set;
+        Field(SetDataTable) table;
 
-        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptSet, DynamicObject, list);
+        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptSet, DynamicObject, table);
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JavascriptSet);
 
     public:
@@ -35,7 +32,7 @@ namespace Js
         bool Has(Var value);
         int Size();
 
-        SetDataList::Iterator GetIterator();
+        SetDataTable::Iterator GetIterator();
 
         virtual BOOL GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext) override;
 
@@ -350,6 +350,16 @@ namespace Js
     {
         AssertMsg( IsValidIndexValue(index), "Must specify valid character");
 
+        if (!this->IsFinalized())
+        {
+            // Read one byte strings without widening them
+            const byte *oneByteBuffer = OneByteString::TryGetOneByteBuffer(this);
+            if (oneByteBuffer != nullptr)
+            {
+                return oneByteBuffer[index];
+            }
+        }
+
         const char16 *str = this->GetString();
         return str[index];
     }
@@ -1082,6 +1092,12 @@ namespace Js
 
         if (position < pThis->GetLengthAsSignedInt())
         {
+            const byte* oneByteInput = OneByteString::TryGetOneByteBuffer(pThis);
+            if (oneByteInput != nullptr)
+            {
+                return OneByteString::IndexOf(oneByteInput, len, searchString, position);
+            }
+
             const char16* searchStr = searchString->GetString();
             const char16* inputStr = pThis->GetString();
             if (searchLen == 1)
@@ -3035,6 +3051,15 @@ namespace Js
 
     bool JavascriptString::Equals(Var aLeft, Var aRight)
     {
+        if (aLeft != aRight)
+        {
+            JavascriptString * leftString = JavascriptString::UnsafeFromVar(aLeft);
+            JavascriptString * rightString = JavascriptString::UnsafeFromVar(aRight);
+            if (OneByteString::TryGetOneByteBuffer(leftString) != nullptr || OneByteString::TryGetOneByteBuffer(rightString) != nullptr)
+            {
+                return OneByteString::Equals(leftString, rightString);
+            }
+        }
         return JavascriptStringHelpers<JavascriptString>::Equals(aLeft, aRight);
     }
 
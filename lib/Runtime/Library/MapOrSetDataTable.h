@@ -0,0 +1,353 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Insertion ordered hash table backing ES6 Map and Set objects. The entries live in a
+// single array in insertion order, and each bucket heads a chain of entry indices through
+// that array, so an entry costs no allocation of its own and iteration is a linear walk.
+// Removed entries keep their slot (with a null key) until the table is rehashed.
+//
+// Iterators must stay valid no matter what modifications are made to the table while
+// iterating, without the table tracking them. A rehash or a clear therefore never changes
+// the storage an iterator points to; it moves the table to a new storage and leaves a link
+// to it in the old one, along with the indices of the entries that were dropped on the way.
+// An iterator that finds its storage obsolete follows the links and adjusts its position.
+
+namespace Js
+{
+    template <typename TData>
+    class MapOrSetDataTable
+    {
+    private:
+        typedef SameValueZeroComparer<Var> KeyComparer;
+
+        static const int32 NoEntry = -1;
+        static const uint32 InitialCapacity = 4;
+        static const uint32 MaxCapacity = 1 << 30;
+
+        struct Entry
+        {
+            Field(TData) data;
+            Field(hash_t) hash;
+            Field(int32) nextInChain;
+        };
+
+        struct Storage
+        {
+            Field(Entry*) entries;
+            Field(int32*) buckets;              // index of the last entry added to each chain
+            Field(uint32) capacity;             // entries; there are half as many buckets
+            Field(uint32) usedCount;            // entries used so far, including removed ones
+            Field(uint32) liveCount;
+
+            // Set once the table has moved on to a newer storage
+            Field(Storage*) nextStorage;
+            Field(uint32*) removedIndices;      // ascending indices of the entries dropped when moving on
+            Field(uint32) removedCount;
+            Field(bool) cleared;
+
+            static Storage* New(Recycler* recycler, uint32 capacity)
+            {
+                Assert(Math::IsPow2(capacity) && capacity >= InitialCapacity && capacity <= MaxCapacity);
+
+                const uint32 bucketCount = capacity / 2;
+                Entry* entries = RecyclerNewArrayZ(recycler, Entry, capacity);
+                int32* buckets = RecyclerNewArrayLeaf(recycler, int32, bucketCount);
+                for (uint32 i = 0; i < bucketCount; i++)
+                {
+                    buckets[i] = NoEntry;
+                }
+
+                Storage* storage = RecyclerNewStructZ(recycler, Storage);
+                storage->entries = entries;
+                storage->buckets = buckets;
+                storage->capacity = capacity;
+                return storage;
+            }
+
+            bool IsRemoved(uint32 index) const
+            {
+                return GetKey(entries[index].data) == nullptr;
+            }
+
+            // Maps the position of an iterator in this storage to its position in nextStorage
+            uint32 GetIndexInNextStorage(uint32 index) const
+            {
+                Assert(nextStorage != nullptr);
+                if (cleared)
+                {
+                    return 0;
+                }
+
+                // Count the dropped entries before index
+                uint32 left = 0;
+                uint32 right = removedCount;
+                while (left < right)
+                {
+                    const uint32 middle = left + (right - left) / 2;
+                    if (removedIndices[middle] < index)
+                    {
+                        left = middle + 1;
+                    }
+                    else
+                    {
+                        right = middle;
+                    }
+                }
+                return index - left;
+            }
+
+            void Append(const TData& data, hash_t hash)
+            {
+                Assert(usedCount < capacity);
+
+                const uint32 bucket = GetBucket(hash, capacity / 2);
+                const uint32 index = usedCount++;
+                Entry& entry = entries[index];
+                entry.data = data;
+                entry.hash = hash;
+                entry.nextInChain = buckets[bucket];
+                buckets[bucket] = (int32)index;
+                liveCount++;
+            }
+
+            void MoveTo(Storage* newStorage, uint32* removed, uint32 count, bool isClear)
+            {
+                nextStorage = newStorage;
+                removedIndices = removed;
+                removedCount = count;
+                cleared = isClear;
+
+                // Iterators only need the links from now on
+                entries = nullptr;
+                buckets = nullptr;
+            }
+        };
+
+        Field(Storage*) storage;
+
+        static Var GetKey(Var data) { return data; }
+        template <typename TKey, typename TValue>
+        static Var GetKey(const JsUtil::KeyValuePair<TKey, TValue>& data) { return data.Key(); }
+
+        static void SetRemoved(Field(Var)& data) { data = nullptr; }
+        template <typename TKey, typename TValue>
+        static void SetRemoved(JsUtil::KeyValuePair<TKey, TValue>& data) { data = JsUtil::KeyValuePair<TKey, TValue>(nullptr, nullptr); }
+
+        static hash_t GetHashCode(Var key)
+        {
+            // The key hashes can keep all their entropy in a few bits, e.g. small integers are hashed
+            // as doubles and only differ in the high bits, so mix them before taking the low bits.
+            uint32 hash = (uint32)KeyComparer::GetHashCode(key);
+            hash ^= hash >> 16;
+            hash *= 0x85ebca6b;
+            hash ^= hash >> 13;
+            hash *= 0xc2b2ae35;
+            hash ^= hash >> 16;
+            return hash;
+        }
+
+        static uint32 GetBucket(hash_t hash, uint32 bucketCount)
+        {
+            return hash & (bucketCount - 1);
+        }
+
+        int32 FindEntry(Var key, hash_t hash) const
+        {
+            const Storage* current = storage;
+            for (int32 i = current->buckets[GetBucket(hash, current->capacity / 2)]; i != NoEntry; i = current->entries[i].nextInChain)
+            {
+                const Entry& entry = current->entries[i];
+                if (entry.hash == hash)
+                {
+                    Var entryKey = GetKey(entry.data);
+                    if (entryKey != nullptr && (entryKey == key || KeyComparer::Equals(entryKey, key)))
+                    {
+                        return i;
+                    }
+                }
+            }
+            return NoEntry;
+        }
+
+        void Rehash(uint32 newCapacity, Recycler* recycler)
+        {
+            Storage* oldStorage = storage;
+
+            // Allocate everything before changing anything, so that running out of memory leaves the table as it was
+            Storage* newStorage = Storage::New(recycler, newCapacity);
+            const uint32 removedCount = oldStorage->usedCount - oldStorage->liveCount;
+            uint32* removed = removedCount != 0 ? RecyclerNewArrayLeaf(recycler, uint32, removedCount) : nullptr;
+
+            uint32 next = 0;
+            for (uint32 i = 0; i < oldStorage->usedCount; i++)
+            {
+                if (oldStorage->IsRemoved(i))
+                {
+                    removed[next++] = i;
+                }
+                else
+                {
+                    const Entry& entry = oldStorage->entries[i];
+                    newStorage->Append(entry.data, entry.hash);
+                }
+            }
+            Assert(next == removedCount);
+
+            oldStorage->MoveTo(newStorage, removed, removedCount, false);
+            storage = newStorage;
+        }
+
+    public:
+        MapOrSetDataTable(VirtualTableInfoCtorEnum) { }
+        MapOrSetDataTable() : storage(nullptr) { }
+
+        class Iterator
+        {
+            Field(Storage*) storage;
+            Field(uint32) index;            // next entry to look at
+            Field(uint32) current;
+        public:
+            Iterator() : storage(nullptr), index(0), current(0) { }
+            Iterator(MapOrSetDataTable<TData>* table) : storage(table->storage), index(0), current(0) { }
+
+            bool Next()
+            {
+                if (storage == nullptr)
+                {
+                    return false;
+                }
+
+                while (storage->nextStorage != nullptr)
+                {
+                    index = storage->GetIndexInNextStorage(index);
+                    storage = storage->nextStorage;
+                }
+
+                while (index < storage->usedCount)
+                {
+                    const uint32 i = index++;
+                    if (!storage->IsRemoved(i))
+                    {
+                        current = i;
+                        return true;
+                    }
+                }
+
+                storage = nullptr;
+                return false;
+            }
+
+            const TData& Current() const
+            {
+                return storage->entries[current].data;
+            }
+        };
+
+        void Initialize(Recycler* recycler)
+        {
+            Assert(!IsInitialized());
+            storage = Storage::New(recycler, InitialCapacity);
+        }
+
+        bool IsInitialized() const
+        {
+            return storage != nullptr;
+        }
+
+        int Count() const
+        {
+            return (int)storage->liveCount;
+        }
+
+        bool Has(Var key) const
+        {
+            return FindEntry(key, GetHashCode(key)) != NoEntry;
+        }
+
+        // Returns the data of the entry for key, or nullptr if there is none
+        const Field(TData)* Find(Var key) const
+        {
+            const int32 index = FindEntry(key, GetHashCode(key));
+            return index == NoEntry ? nullptr : &storage->entries[index].data;
+        }
+
+        // Adds an entry for key, or replaces the data of the existing entry if overwrite is set.
+        // Returns whether a new entry was added.
+        bool Add(Var key, const TData& data, bool overwrite, Recycler* recycler)
+        {
+            Assert(key != nullptr && GetKey(data) == key);
+
+            const hash_t hash = GetHashCode(key);
+            const int32 index = FindEntry(key, hash);
+            if (index != NoEntry)
+            {
+                if (overwrite)
+                {
+                    storage->entries[index].data = data;
+                }
+                return false;
+            }
+
+            if (storage->usedCount == storage->capacity)
+            {
+                // Grow if at least half of the entries are live, otherwise drop the removed ones and
+                // shrink while at most a quarter of the entries would be live
+                uint32 newCapacity = storage->capacity;
+                if (storage->liveCount >= newCapacity / 2)
+                {
+                    if (newCapacity == MaxCapacity)
+                    {
+                        Js::Throw::OutOfMemory();
+                    }
+                    newCapacity *= 2;
+                }
+                else
+                {
+                    while (newCapacity > InitialCapacity && storage->liveCount < newCapacity / 4)
+                    {
+                        newCapacity /= 2;
+                    }
+                }
+                Rehash(newCapacity, recycler);
+            }
+
+            storage->Append(data, hash);
+            return true;
+        }
+
+        bool Remove(Var key)
+        {
+            const int32 index = FindEntry(key, GetHashCode(key));
+            if (index == NoEntry)
+            {
+                return false;
+            }
+
+            // The entry keeps its slot, and its place in the chain, until the next rehash. Removing
+            // never allocates; the table shrinks when it next runs out of slots.
+            SetRemoved(storage->entries[index].data);
+            storage->liveCount--;
+            return true;
+        }
+
+        void Clear(Recycler* recycler)
+        {
+            if (storage->usedCount == 0)
+            {
+                return;
+            }
+
+            Storage* newStorage = Storage::New(recycler, InitialCapacity);
+            storage->MoveTo(newStorage, nullptr, 0, true);
+            storage = newStorage;
+        }
+
+        Iterator GetIterator()
+        {
+            return Iterator(this);
+        }
+    };
+}
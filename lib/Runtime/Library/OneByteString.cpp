@@ -0,0 +1,208 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    inline OneByteString::OneByteString(const byte * buffer, charcount_t length, StaticType * type) :
+        JavascriptString(type),
+        oneByteBuffer(buffer)
+    {
+        this->SetLength(length);
+    }
+
+    bool OneByteString::ShouldUseFor(charcount_t length)
+    {
+        // The object is one pointer larger than a LiteralString, short strings don't gain anything
+        return CONFIG_FLAG_RELEASE(OneByteStrings) && length > 1 && (int)length >= (int)CONFIG_FLAG_RELEASE(MinOneByteStringLength);
+    }
+
+    OneByteString * OneByteString::NewUninitialized(charcount_t length, ScriptContext * scriptContext, _Out_ byte ** buffer)
+    {
+        AssertMsg(IsValidCharCount(length), "length is out of range");
+
+        Recycler * recycler = scriptContext->GetRecycler();
+        byte * oneByteBuffer = RecyclerNewArrayLeaf(recycler, byte, length);
+        *buffer = oneByteBuffer;
+        return RecyclerNew(recycler, OneByteString, oneByteBuffer, length, scriptContext->GetLibrary()->GetStringTypeStatic());
+    }
+
+    JavascriptString * OneByteString::NewFromLatin1(__in_ecount(length) const char16 * content, charcount_t length, ScriptContext * scriptContext)
+    {
+        Assert(ShouldUseFor(length));
+
+        byte * buffer;
+        OneByteString * str = NewUninitialized(length, scriptContext, &buffer);
+        for (charcount_t i = 0; i < length; i++)
+        {
+            Assert(content[i] <= 0xFF);
+            buffer[i] = (byte)content[i];
+        }
+        return str;
+    }
+
+    void OneByteString::WidenCopy(__out_ecount(length) char16 * dst, __in_ecount(length) const byte * src, charcount_t length)
+    {
+        for (charcount_t i = 0; i < length; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+
+    const char16 * OneByteString::Widen(__in_ecount(length) const byte * src, charcount_t length, Recycler * recycler)
+    {
+        char16 * buffer = RecyclerNewArrayLeaf(recycler, char16, SafeSzSize(length));
+        WidenCopy(buffer, src, length);
+        buffer[length] = _u('\0');
+        return buffer;
+    }
+
+    const byte * OneByteString::TryGetOneByteBuffer(JavascriptString * str)
+    {
+        OneByteString * oneByteString = OneByteString::TryFromVar(str);
+        if (oneByteString != nullptr)
+        {
+            return oneByteString->oneByteBuffer;
+        }
+
+        // JsCreateString keeps ASCII strings in a LiteralStringWithPropertyStringPtr
+        LiteralStringWithPropertyStringPtr * literalString = LiteralStringWithPropertyStringPtr::TryFromVar(str);
+        if (literalString != nullptr)
+        {
+            return literalString->GetOneByteBuffer();
+        }
+        return nullptr;
+    }
+
+    bool OneByteString::Equals(JavascriptString * left, JavascriptString * right)
+    {
+        if (left->GetLength() != right->GetLength())
+        {
+            return false;
+        }
+
+        const charcount_t length = left->GetLength();
+        const byte * leftBytes = TryGetOneByteBuffer(left);
+        const byte * rightBytes = TryGetOneByteBuffer(right);
+        if (leftBytes != nullptr && rightBytes != nullptr)
+        {
+            return memcmp(leftBytes, rightBytes, length) == 0;
+        }
+
+        if (leftBytes == nullptr && rightBytes == nullptr)
+        {
+            return wmemcmp(left->GetString(), right->GetString(), length) == 0;
+        }
+
+        // Compare the one byte side with the other side's char16 buffer, without widening it
+        const byte * bytes = leftBytes != nullptr ? leftBytes : rightBytes;
+        const char16 * chars = leftBytes != nullptr ? right->GetString() : left->GetString();
+        for (charcount_t i = 0; i < length; i++)
+        {
+            if (bytes[i] != chars[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename TChar>
+    static int OneByteIndexOf(__in_ecount(length) const byte * input, charcount_t length, __in_ecount(searchLength) const TChar * search, charcount_t searchLength, charcount_t position)
+    {
+        Assert(searchLength > 0 && position <= length);
+
+        // A character outside of the Latin-1 range can't match. The other search characters
+        // don't need the check, they simply never compare equal to a byte.
+        if (search[0] > 0xFF || searchLength > length - position)
+        {
+            return -1;
+        }
+
+        const byte first = (byte)search[0];
+        const byte * current = input + position;
+        const byte * last = input + (length - searchLength);
+        while (current <= last)
+        {
+            current = (const byte *)memchr(current, first, (size_t)(last - current) + 1);
+            if (current == nullptr)
+            {
+                return -1;
+            }
+
+            charcount_t i = 1;
+            while (i < searchLength && current[i] == search[i])
+            {
+                i++;
+            }
+            if (i == searchLength)
+            {
+                return (int)(current - input);
+            }
+            current++;
+        }
+        return -1;
+    }
+
+    int OneByteString::IndexOf(__in_ecount(length) const byte * input, charcount_t length, JavascriptString * searchString, charcount_t position)
+    {
+        const byte * searchBytes = TryGetOneByteBuffer(searchString);
+        if (searchBytes != nullptr)
+        {
+            return OneByteIndexOf(input, length, searchBytes, searchString->GetLength(), position);
+        }
+        return OneByteIndexOf(input, length, searchString->GetString(), searchString->GetLength(), position);
+    }
+
+    const char16* OneByteString::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return this->UnsafeGetBuffer();
+        }
+
+        const char16 * buffer = Widen(this->oneByteBuffer, this->GetLength(), this->GetRecycler());
+        this->SetBuffer(buffer);
+
+        // Everything reads the char16 buffer from now on, let the one byte buffer go
+        this->oneByteBuffer = nullptr;
+
+        return buffer;
+    }
+
+    void OneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+        Assert(this->oneByteBuffer != nullptr);
+
+        // Widen straight into the destination, e.g. when flattening a concat string
+        WidenCopy(buffer, this->oneByteBuffer, this->GetLength());
+    }
+
+    size_t OneByteString::GetAllocatedByteCount() const
+    {
+        if (!this->IsFinalized())
+        {
+            return this->GetLength();
+        }
+        return __super::GetAllocatedByteCount();
+    }
+
+    bool OneByteString::Is(Var var)
+    {
+        return RecyclableObject::Is(var) && VirtualTableInfo<OneByteString>::HasVirtualTable(RecyclableObject::FromVar(var));
+    }
+
+    OneByteString* OneByteString::TryFromVar(Var var)
+    {
+        return OneByteString::Is(var)
+            ? reinterpret_cast<OneByteString*>(var)
+            : nullptr;
+    }
+}
@@ -0,0 +1,50 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // String whose characters are all in the Latin-1 range, stored with one byte per character.
+    // The char16 buffer is only built when something asks for it through GetSz; from then on the
+    // string behaves like a LiteralString and the one byte buffer is dropped.
+    class OneByteString sealed : public JavascriptString
+    {
+    private:
+        Field(const byte *) oneByteBuffer;      // nullptr once the string has been widened
+
+        OneByteString(const byte * buffer, charcount_t length, StaticType * type);
+
+        static OneByteString * NewUninitialized(charcount_t length, ScriptContext * scriptContext, _Out_ byte ** buffer);
+
+    protected:
+        DEFINE_VTABLE_CTOR(OneByteString, JavascriptString);
+
+    public:
+        static bool ShouldUseFor(charcount_t length);
+
+        static JavascriptString * NewFromLatin1(__in_ecount(length) const char16 * content, charcount_t length, ScriptContext * scriptContext);
+
+        static void WidenCopy(__out_ecount(length) char16 * dst, __in_ecount(length) const byte * src, charcount_t length);
+        static const char16 * Widen(__in_ecount(length) const byte * src, charcount_t length, Recycler * recycler);
+
+        // Returns the one byte contents of str, or nullptr if str is not kept at one byte per character or has been widened
+        static const byte * TryGetOneByteBuffer(JavascriptString * str);
+
+        static bool Equals(JavascriptString * left, JavascriptString * right);
+        static int IndexOf(__in_ecount(length) const byte * input, charcount_t length, JavascriptString * searchString, charcount_t position);
+
+        virtual const char16* GetSz() override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+        virtual size_t GetAllocatedByteCount() const override;
+
+        static bool Is(Var var);
+        static OneByteString* TryFromVar(Var var);
+
+        virtual VTableValue DummyVirtualFunctionToHinderLinkerICF()
+        {
+            return VTableValue::VtableOneByteString;
+        }
+    };
+}
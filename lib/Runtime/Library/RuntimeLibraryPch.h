@@ -27,6 +27,7 @@
 #include "Library/ProfileString.h"
 #include "Library/SingleCharString.h"
 #include "Library/SubString.h"
+#include "Library/OneByteString.h"
 #include "Library/BufferStringBuilder.h"
 
 #include "Library/BoundFunction.h"
@@ -46,7 +47,7 @@
 #include "Library/JavascriptGenerator.h"
 
 #include "Library/SameValueComparer.h"
-#include "Library/MapOrSetDataList.h"
+#include "Library/MapOrSetDataTable.h"
 #include "Library/JavascriptMap.h"
 #include "Library/JavascriptSet.h"
 #include "Library/JavascriptWeakMap.h"
@@ -52,22 +52,57 @@ namespace Js
         }
 #endif
 
-        if (indexToWaiterList != nullptr)
+        if (waiterListTable != nullptr)
         {
-            // TODO: the map should be empty here?
-            // or we need to wake all the waiters from current context?
-            indexToWaiterList->Map([](uint index, WaiterList *waiters)
+            waiterListTable->Cleanup();
+            HeapDelete(waiterListTable);
+            waiterListTable = nullptr;
+        }
+    }
+
+    WaiterList *WaiterListTable::GetWaiterList(uint index)
+    {
+        // Wait and wake only work on Int32Array elements, so the low bits of the byte index are always 0
+        Stripe &stripe = stripes[(index / sizeof(int32)) % StripeCount];
+        AutoCriticalSection autoCS(&stripe.csForAccess);
+
+        if (stripe.indexToWaiterList == nullptr)
+        {
+            stripe.indexToWaiterList = HeapNew(IndexToWaitersMap, &HeapAllocator::Instance);
+        }
+
+        WaiterList * waiters = nullptr;
+        if (!stripe.indexToWaiterList->TryGetValue(index, &waiters))
+        {
+            waiters = HeapNew(WaiterList);
+            stripe.indexToWaiterList->Add(index, waiters);
+        }
+        return waiters;
+    }
+
+    void WaiterListTable::Cleanup()
+    {
+        for (uint i = 0; i < StripeCount; i++)
+        {
+            Stripe &stripe = stripes[i];
+            AutoCriticalSection autoCS(&stripe.csForAccess);
+            if (stripe.indexToWaiterList != nullptr)
             {
-                if (waiters != nullptr)
+                // TODO: the map should be empty here?
+                // or we need to wake all the waiters from current context?
+                stripe.indexToWaiterList->Map([](uint index, WaiterList *waiters)
                 {
-                    waiters->Cleanup();
-                    HeapDelete(waiters);
-                    waiters = nullptr;
-                }
-            });
-
-            HeapDelete(indexToWaiterList);
-            indexToWaiterList = nullptr;
+                    if (waiters != nullptr)
+                    {
+                        waiters->Cleanup();
+                        HeapDelete(waiters);
+                        waiters = nullptr;
+                    }
+                });
+
+                HeapDelete(stripe.indexToWaiterList);
+                stripe.indexToWaiterList = nullptr;
+            }
         }
     }
 
@@ -343,28 +378,26 @@ namespace Js
 #endif
     }
 
-    CriticalSection SharedArrayBuffer::csSharedArrayBuffer;
-
     WaiterList *SharedArrayBuffer::GetWaiterList(uint index)
     {
         if (sharedContents != nullptr)
         {
-            // REVIEW: only lock creating the map and pass the lock to the map?
-            //         use one lock per instance?
-            AutoCriticalSection autoCS(&csSharedArrayBuffer);
-
-            if (sharedContents->indexToWaiterList == nullptr)
-            {
-                sharedContents->indexToWaiterList = HeapNew(IndexToWaitersMap, &HeapAllocator::Instance);
-            }
-
-            WaiterList * waiters = nullptr;
-            if (!sharedContents->indexToWaiterList->TryGetValue(index, &waiters))
+            WaiterListTable *waiterListTable = sharedContents->waiterListTable;
+            if (waiterListTable == nullptr)
             {
-                waiters = HeapNew(WaiterList);
-                sharedContents->indexToWaiterList->Add(index, waiters);
+                // Agents on other threads may race to create the table, the first one to publish it wins
+                WaiterListTable *newTable = HeapNew(WaiterListTable);
+                waiterListTable = (WaiterListTable *)InterlockedCompareExchangePointer((PVOID *)&sharedContents->waiterListTable, newTable, nullptr);
+                if (waiterListTable == nullptr)
+                {
+                    waiterListTable = newTable;
+                }
+                else
+                {
+                    HeapDelete(newTable);
+                }
             }
-            return waiters;
+            return waiterListTable->GetWaiterList(index);
         }
 
         Assert(false);
@@ -513,41 +546,54 @@ namespace Js
 
     bool WaiterList::AddAndSuspendWaiter(DWORD_PTR waiter, uint32 timeout)
     {
-#ifdef _WIN32
         Assert(m_waiters != nullptr);
         Assert(waiter != NULL);
         Assert(!Contains(waiter));
-
+#ifdef _WIN32
         AgentOfBuffer agent(waiter, CreateEvent(NULL, TRUE, FALSE, NULL));
         m_waiters->Add(agent);
 
         csForAccess.Leave();
         DWORD result = WaitForSingleObject(agent.event, timeout);
         csForAccess.Enter();
-        return result == WAIT_OBJECT_0;
+
+        // A wake racing with the timeout has already removed this agent and counted it as woken
+        bool awoken = result == WAIT_OBJECT_0 || !Contains(waiter);
+        if (awoken)
+        {
+            CloseHandle(agent.event);
+        }
+        return awoken;
 #else
-        // TODO for xplat
-        return false;
+        volatile int32 wakeFlag = 0;
+        AgentOfBuffer agent(waiter, &wakeFlag);
+        m_waiters->Add(agent);
+
+        csForAccess.Leave();
+        PlatformAgnostic::Thread::WaitForAddressChange(&wakeFlag, 0, timeout);
+        csForAccess.Enter();
+
+        // The flag is only set under the lock, by the wake that also removed this agent from the list
+        return wakeFlag != 0;
 #endif
     }
 
     void WaiterList::RemoveWaiter(DWORD_PTR waiter)
     {
-#ifdef _WIN32
         Assert(m_waiters != nullptr);
         for (int i = m_waiters->Count() - 1; i >= 0; i--)
         {
             if (m_waiters->Item(i).identity == waiter)
             {
+#ifdef _WIN32
                 CloseHandle(m_waiters->Item(i).event);
+#endif
                 m_waiters->RemoveAt(i);
                 return;
             }
         }
 
         Assert(false);
-#endif
-        // TODO for xplat
     }
 
     uint32 WaiterList::RemoveAndWakeWaiters(int32 count)
@@ -555,16 +601,20 @@ namespace Js
         Assert(m_waiters != nullptr);
         Assert(count >= 0);
         uint32 removed = 0;
-#ifdef _WIN32
         while (count > 0 && m_waiters->Count() > 0)
         {
             AgentOfBuffer agent = m_waiters->Item(0);
             m_waiters->RemoveAt(0);
             count--; removed++;
+#ifdef _WIN32
             SetEvent(agent.event);
             // This agent will be closed when their respective call to wait has returned
-        }
+#else
+            // Each agent parks on its own flag so that they are woken in the order they started waiting
+            *agent.wakeFlag = 1;
+            PlatformAgnostic::Thread::WakeAddressWaiters(agent.wakeFlag, 1);
 #endif
+        }
         return removed;
     }
 
@@ -13,11 +13,32 @@ namespace Js
     typedef JsUtil::List<DWORD_PTR, HeapAllocator> SharableAgents;
     typedef JsUtil::BaseDictionary<uint, WaiterList *, HeapAllocator> IndexToWaitersMap;
 
+    // Waiter lists of a buffer, striped by index so that agents waiting on different indices don't serialize on one lock.
+    class WaiterListTable
+    {
+    public:
+        WaiterList *GetWaiterList(uint index);
+        void Cleanup();
+
+    private:
+        static const uint StripeCount = 16;
+
+        struct Stripe
+        {
+            Stripe() : indexToWaiterList(nullptr) {}
+
+            IndexToWaitersMap *indexToWaiterList;  // Map of agents waiting on a particular index.
+            CriticalSection csForAccess;
+        };
+
+        Stripe stripes[StripeCount];
+    };
+
     class SharedContents
     {
     public:
         BYTE  *buffer;             // Points to a heap allocated RGBA buffer, can be null
-        IndexToWaitersMap *indexToWaiterList;  // Map of agents waiting on a particular index.
+        WaiterListTable *waiterListTable;  // Created by the first agent to wait or wake on the buffer.
         uint32 bufferLength;       // Number of bytes allocated
     private:
         // Addref/release counter for current buffer, this is needed as the current buffer will be shared among different workers
@@ -38,7 +59,7 @@ namespace Js
         void Cleanup();
 
         SharedContents(BYTE* b, uint32 l)
-            : buffer(b), bufferLength(l), refCount(1), indexToWaiterList(nullptr)
+            : buffer(b), bufferLength(l), refCount(1), waiterListTable(nullptr)
 #if DBG
             , allowedAgents(nullptr)
 #endif
@@ -100,8 +121,6 @@ namespace Js
 
     protected:
         FieldNoBarrier(SharedContents *) sharedContents;
-
-        static CriticalSection csSharedArrayBuffer;
     };
 
     class JavascriptSharedArrayBuffer : public SharedArrayBuffer
@@ -126,12 +145,21 @@ namespace Js
     struct AgentOfBuffer
     {
     public:
+#ifdef _WIN32
         AgentOfBuffer() :identity(NULL), event(NULL) {}
         AgentOfBuffer(DWORD_PTR agent, HANDLE e) :identity(agent), event(e) {}
+#else
+        AgentOfBuffer() :identity(NULL), wakeFlag(nullptr) {}
+        AgentOfBuffer(DWORD_PTR agent, volatile int32 *w) :identity(agent), wakeFlag(w) {}
+#endif
         static bool AgentCanSuspend(ScriptContext *scriptContext);
 
         DWORD_PTR identity;
+#ifdef _WIN32
         HANDLE event;
+#else
+        volatile int32 *wakeFlag;  // On the waiting agent's stack, set to 1 by the agent waking it
+#endif
     };
 
     typedef JsUtil::List<AgentOfBuffer, HeapAllocator> Waiters;
@@ -2439,6 +2439,103 @@ namespace Js
         }
     }
 
+    // Radix sort keys that order like the element values: unsigned integers as they are, signed
+    // integers with the sign bit flipped, and floating point values with all bits flipped when
+    // negative and the sign bit set otherwise, which also puts -0 before +0. NaNs have no key.
+    template<typename T> struct TypedArraySortKey
+    {
+        typedef T Key;
+        static const bool CanBeNaN = false;
+        static Key ToKey(Key bits) { return bits; }
+        static Key FromKey(Key key) { return key; }
+    };
+
+    template<typename T, typename TKey> struct TypedArraySignedSortKey
+    {
+        typedef TKey Key;
+        static const bool CanBeNaN = false;
+        static Key ToKey(Key bits) { return (Key)(bits ^ SignBit); }
+        static Key FromKey(Key key) { return (Key)(key ^ SignBit); }
+    private:
+        static const Key SignBit = (Key)((Key)1 << (sizeof(Key) * 8 - 1));
+    };
+
+    template<typename T, typename TKey> struct TypedArrayFloatSortKey
+    {
+        typedef TKey Key;
+        static const bool CanBeNaN = true;
+        static Key ToKey(Key bits) { return (bits & SignBit) ? (Key)~bits : (Key)(bits | SignBit); }
+        static Key FromKey(Key key) { return (key & SignBit) ? (Key)(key & ~SignBit) : (Key)~key; }
+    private:
+        static const Key SignBit = (Key)1 << (sizeof(Key) * 8 - 1);
+    };
+
+    template<> struct TypedArraySortKey<int8> : TypedArraySignedSortKey<int8, uint8> {};
+    template<> struct TypedArraySortKey<int16> : TypedArraySignedSortKey<int16, uint16> {};
+    template<> struct TypedArraySortKey<int32> : TypedArraySignedSortKey<int32, uint32> {};
+    template<> struct TypedArraySortKey<int64> : TypedArraySignedSortKey<int64, uint64> {};
+    template<> struct TypedArraySortKey<float> : TypedArrayFloatSortKey<float, uint32> {};
+    template<> struct TypedArraySortKey<double> : TypedArrayFloatSortKey<double, uint64> {};
+    template<> struct TypedArraySortKey<bool> : TypedArraySortKey<uint8> {};
+    template<> struct TypedArraySortKey<char16> : TypedArraySortKey<uint16> {};
+
+    template<typename T> bool TypedArraySortElementsHelper(_Inout_updates_bytes_(length * sizeof(T)) BYTE* buffer, uint32 length)
+    {
+        typedef TypedArraySortKey<T> SortKey;
+        typedef typename SortKey::Key Key;
+        CompileAssert(sizeof(Key) == sizeof(T));
+
+        T* elements = reinterpret_cast<T*>(buffer);
+        Key* keys = reinterpret_cast<Key*>(buffer);
+
+        if (SortKey::CanBeNaN)
+        {
+            // NaNs go to the end and don't take part in the sort
+            uint32 count = 0;
+            for (uint32 i = 0; i < length; i++)
+            {
+                if (!NumberUtilities::IsNan((double)elements[i]))
+                {
+                    Key key = keys[i];
+                    keys[i] = keys[count];
+                    keys[count++] = key;
+                }
+            }
+            length = count;
+        }
+
+        if (length < 2)
+        {
+            return true;
+        }
+
+        Key* scratch = nullptr;
+        if (sizeof(Key) > 1)
+        {
+            scratch = HeapNewNoThrowArray(Key, length);
+            if (scratch == nullptr)
+            {
+                return false;
+            }
+        }
+
+        for (uint32 i = 0; i < length; i++)
+        {
+            keys[i] = SortKey::ToKey(keys[i]);
+        }
+        JsUtil::RadixSort(keys, scratch, length);
+        for (uint32 i = 0; i < length; i++)
+        {
+            keys[i] = SortKey::FromKey(keys[i]);
+        }
+
+        if (scratch != nullptr)
+        {
+            HeapDeleteArray(length, scratch);
+        }
+        return true;
+    }
+
     Var TypedArrayBase::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -2471,6 +2568,18 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
+        // Without a comparison function the elements are sorted by value, which a radix sort does in a
+        // few linear passes. The passes rely on the elements not changing under them, so shared
+        // buffers keep using the comparison sort.
+        if (compareFn == nullptr && length >= MinRadixSortLength && !typedArrayBase->GetArrayBuffer()->IsSharedArrayBuffer())
+        {
+            SortElementsFunction elementSort = typedArrayBase->GetSortElementsFunction();
+            if (elementSort(typedArrayBase->GetByteBuffer(), length))
+            {
+                return typedArrayBase;
+            }
+        }
+
         // Get the elements comparison function for the type of this TypedArray
         void* elementCompare = reinterpret_cast<void*>(typedArrayBase->GetCompareElementsFunction());
 
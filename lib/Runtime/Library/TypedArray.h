@@ -11,6 +11,7 @@ namespace Js
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBufferBase* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascriptLibrary);
 
     template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2);
+    template<typename T> bool TypedArraySortElementsHelper(_Inout_updates_bytes_(length * sizeof(T)) BYTE* buffer, uint32 length);
 
     class TypedArrayBase : public ArrayBufferParent
     {
@@ -200,6 +201,11 @@ namespace Js
         typedef int(__cdecl* CompareElementsFunction)(void*, const void*, const void*);
         virtual CompareElementsFunction GetCompareElementsFunction() = 0;
 
+        // Sorts by value without a comparison function, returns false if it runs out of memory
+        typedef bool(*SortElementsFunction)(BYTE*, uint32);
+        virtual SortElementsFunction GetSortElementsFunction() = 0;
+        static const uint32 MinRadixSortLength = 64;
+
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         Field(int32) BYTES_PER_ELEMENT;
         Field(uint32) byteOffset;
@@ -504,6 +510,11 @@ namespace Js
             return &TypedArrayCompareElementsHelper<TypeName>;
         }
 
+        SortElementsFunction GetSortElementsFunction()
+        {
+            return &TypedArraySortElementsHelper<TypeName>;
+        }
+
     public:
         virtual VTableValue DummyVirtualFunctionToHinderLinkerICF();
     };
@@ -566,6 +577,11 @@ namespace Js
             return &TypedArrayCompareElementsHelper<char16>;
         }
 
+        SortElementsFunction GetSortElementsFunction()
+        {
+            return &TypedArraySortElementsHelper<char16>;
+        }
+
     public:
         virtual VTableValue DummyVirtualFunctionToHinderLinkerICF()
         {
@@ -26,9 +26,9 @@ Var WebAssembly::EntryCompile(RecyclableObject* function, CallInfo callInfo, ...
             JavascriptError::ThrowTypeError(scriptContext, WASMERR_NeedBufferSource);
         }
 
-        WebAssemblySource src(args[1], true, scriptContext);
-        WebAssemblyModule* wasmModule = WebAssemblyModule::CreateModule(scriptContext, &src);
-        return JavascriptPromise::CreateResolvedPromise(wasmModule, scriptContext);
+        ArrayBuffer* bytes = WebAssemblySource::CopyBufferSource(args[1], scriptContext);
+        Var boundArgs[] = { scriptContext->GetLibrary()->GetWebAssemblyCompileJobFunction(), scriptContext->GetLibrary()->GetUndefined(), bytes };
+        return CreateCompileJobPromise(boundArgs, _countof(boundArgs), scriptContext);
     }
     catch (JavascriptException & e)
     {
@@ -36,6 +36,21 @@ Var WebAssembly::EntryCompile(RecyclableObject* function, CallInfo callInfo, ...
     }
 }
 
+Var WebAssembly::EntryCompileJob(RecyclableObject* function, CallInfo callInfo, ...)
+{
+    PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
+
+    ARGUMENTS(args, callInfo);
+    AssertMsg(args.Info.Count > 0, "Should always have implicit 'this'");
+    ScriptContext* scriptContext = function->GetScriptContext();
+
+    Assert(!(callInfo.Flags & CallFlags_New));
+
+    AssertOrFailFast(args.Info.Count > 1);
+    WebAssemblySource src(GetCompileJobBytes(args, 1, scriptContext), true, scriptContext);
+    return WebAssemblyModule::CreateModule(scriptContext, &src);
+}
+
 Var WebAssembly::EntryCompileStreaming(RecyclableObject* function, CallInfo callInfo, ...)
 {
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -58,7 +73,7 @@ Var WebAssembly::EntryCompileStreaming(RecyclableObject* function, CallInfo call
         if (responsePromise)
         {
             // Once we've resolved everything, create the module
-            return JavascriptPromise::CreateThenPromise((JavascriptPromise*)responsePromise, library->GetWebAssemblyCompileFunction(), library->GetThrowerFunction(), scriptContext);
+            return JavascriptPromise::CreateThenPromise((JavascriptPromise*)responsePromise, library->GetWebAssemblyCompileJobFunction(), library->GetThrowerFunction(), scriptContext);
         }
         JavascriptError::ThrowTypeError(scriptContext, WASMERR_NeedResponse);
     }
@@ -78,7 +93,6 @@ Var WebAssembly::EntryInstantiate(RecyclableObject* function, CallInfo callInfo,
 
     Assert(!(callInfo.Flags & CallFlags_New));
 
-    Var resultObject = nullptr;
     try
     {
         if (args.Info.Count < 2)
@@ -94,21 +108,13 @@ Var WebAssembly::EntryInstantiate(RecyclableObject* function, CallInfo callInfo,
 
         if (WebAssemblyModule::Is(args[1]))
         {
-            resultObject = WebAssemblyInstance::CreateInstance(WebAssemblyModule::FromVar(args[1]), importObject);
+            Var instance = WebAssemblyInstance::CreateInstance(WebAssemblyModule::FromVar(args[1]), importObject);
+            return JavascriptPromise::CreateResolvedPromise(instance, scriptContext);
         }
-        else
-        {
-            WebAssemblySource src(args[1], true, scriptContext);
-            WebAssemblyModule* wasmModule = WebAssemblyModule::CreateModule(scriptContext, &src);
 
-            WebAssemblyInstance* instance = WebAssemblyInstance::CreateInstance(wasmModule, importObject);
-
-            resultObject = JavascriptOperators::NewJavascriptObjectNoArg(scriptContext);
-
-            JavascriptOperators::OP_SetProperty(resultObject, PropertyIds::module, wasmModule, scriptContext);
-            JavascriptOperators::OP_SetProperty(resultObject, PropertyIds::instance, instance, scriptContext);
-        }
-        return JavascriptPromise::CreateResolvedPromise(resultObject, scriptContext);
+        ArrayBuffer* bytes = WebAssemblySource::CopyBufferSource(args[1], scriptContext);
+        Var boundArgs[] = { scriptContext->GetLibrary()->GetWebAssemblyInstantiateBoundFunction(), scriptContext->GetLibrary()->GetUndefined(), importObject, bytes };
+        return CreateCompileJobPromise(boundArgs, _countof(boundArgs), scriptContext);
     }
     catch (JavascriptException & e)
     {
@@ -143,13 +149,7 @@ Var WebAssembly::EntryInstantiateStreaming(RecyclableObject* function, CallInfo
             {
                 importObject = args[2];
             }
-            // Since instantiate takes extra arguments, we have to create a bound function to carry the importsObject until the response is resolved
-            // Because function::bind() binds arguments from the left first, we have to calback a different function to reverse the order of the arguments
-            Var boundArgs[] = { library->GetWebAssemblyInstantiateBoundFunction(), args[0], importObject };
-            CallInfo boundCallInfo(CallFlags_Value, 3);
-            ArgumentReader myargs(&boundCallInfo, boundArgs);
-            RecyclableObject* boundFunction = BoundFunction::New(scriptContext, myargs);
-            return JavascriptPromise::CreateThenPromise((JavascriptPromise*)responsePromise, boundFunction, library->GetThrowerFunction(), scriptContext);
+            return JavascriptPromise::CreateThenPromise((JavascriptPromise*)responsePromise, CreateInstantiateJobFunction(importObject, scriptContext), library->GetThrowerFunction(), scriptContext);
         }
         JavascriptError::ThrowTypeError(scriptContext, WASMERR_NeedResponse);
     }
@@ -165,13 +165,22 @@ Var WebAssembly::EntryInstantiateBound(RecyclableObject* function, CallInfo call
 
     ARGUMENTS(args, callInfo);
     AssertMsg(args.Info.Count > 0, "Should always have implicit 'this'");
+    ScriptContext* scriptContext = function->GetScriptContext();
+
     Assert(!(callInfo.Flags & CallFlags_New));
 
-    Var thisVar = args[0];
-    Var importObj = callInfo.Count > 1 ? args[1] : function->GetScriptContext()->GetLibrary()->GetUndefined();
-    Var bufferSrc = callInfo.Count > 2 ? args[2] : function->GetScriptContext()->GetLibrary()->GetUndefined();
+    AssertOrFailFast(callInfo.Count > 2);
+    Var importObj = args[1];
+
+    WebAssemblySource src(GetCompileJobBytes(args, 2, scriptContext), true, scriptContext);
+    WebAssemblyModule* wasmModule = WebAssemblyModule::CreateModule(scriptContext, &src);
 
-    return CALL_ENTRYPOINT_NOASSERT(EntryInstantiate, function, CallInfo(CallFlags_Value, 3), thisVar, bufferSrc, importObj);
+    WebAssemblyInstance* instance = WebAssemblyInstance::CreateInstance(wasmModule, importObj);
+
+    Var resultObject = JavascriptOperators::NewJavascriptObjectNoArg(scriptContext);
+    JavascriptOperators::OP_SetProperty(resultObject, PropertyIds::module, wasmModule, scriptContext);
+    JavascriptOperators::OP_SetProperty(resultObject, PropertyIds::instance, instance, scriptContext);
+    return resultObject;
 }
 
 Var WebAssembly::EntryValidate(RecyclableObject* function, CallInfo callInfo, ...)
@@ -280,6 +289,43 @@ Var WebAssembly::TryResolveResponse(RecyclableObject* function, Var thisArg, Var
     return responsePromise;
 }
 
+Var WebAssembly::CreateCompileJobPromise(Var* boundArgs, uint boundArgCount, ScriptContext* scriptContext)
+{
+    // Decoding the module is left to a promise job, so the calling script runs to completion first.
+    // The job still decodes on the script thread, before the host gets back to its event loop: the module
+    // and its function bodies live on the script context's recycler, so the decoder can't run in the background.
+    // The copied bytes are bound to the job function rather than used to resolve a promise, which would look up
+    // a then property on them and hand them to script.
+    CallInfo boundCallInfo(CallFlags_Value, boundArgCount);
+    ArgumentReader myargs(&boundCallInfo, boundArgs);
+    RecyclableObject* jobFunction = BoundFunction::New(scriptContext, myargs);
+
+    JavascriptLibrary* library = scriptContext->GetLibrary();
+    JavascriptPromise* jobPromise = (JavascriptPromise*)JavascriptPromise::CreateResolvedPromise(library->GetUndefined(), scriptContext);
+    return JavascriptPromise::CreateThenPromise(jobPromise, jobFunction, library->GetThrowerFunction(), scriptContext);
+}
+
+ArrayBuffer* WebAssembly::GetCompileJobBytes(Arguments& args, uint bytesIndex, ScriptContext* scriptContext)
+{
+    // compile and instantiate bind the bytes they copied, which are followed by the undefined the job promise resolved with.
+    // compileStreaming and instantiateStreaming get the response's ArrayBuffer, which script may still hold, so copy it here.
+    if (args.Info.Count > bytesIndex + 1)
+    {
+        return ArrayBuffer::FromVar(args[bytesIndex]);
+    }
+    return WebAssemblySource::CopyBufferSource(args[bytesIndex], scriptContext);
+}
+
+RecyclableObject* WebAssembly::CreateInstantiateJobFunction(Var importObject, ScriptContext* scriptContext)
+{
+    // Since instantiate takes extra arguments, we have to create a bound function to carry the importsObject until the bytes are available
+    // Because function::bind() binds arguments from the left first, we have to calback a different function to reverse the order of the arguments
+    Var boundArgs[] = { scriptContext->GetLibrary()->GetWebAssemblyInstantiateBoundFunction(), scriptContext->GetLibrary()->GetUndefined(), importObject };
+    CallInfo boundCallInfo(CallFlags_Value, 3);
+    ArgumentReader myargs(&boundCallInfo, boundArgs);
+    return BoundFunction::New(scriptContext, myargs);
+}
+
 uint32
 WebAssembly::ToNonWrappingUint32(Var val, ScriptContext * ctx)
 {
@@ -19,6 +19,7 @@ class WebAssembly
     public:
         static FunctionInfo Compile;
         static FunctionInfo CompileStreaming;
+        static FunctionInfo CompileJob;
         static FunctionInfo Validate;
         static FunctionInfo Instantiate;
         static FunctionInfo InstantiateStreaming;
@@ -27,10 +28,12 @@ class WebAssembly
     };
     static Var EntryCompile(RecyclableObject* function, CallInfo callInfo, ...);
     static Var EntryCompileStreaming(RecyclableObject* function, CallInfo callInfo, ...);
+    // Compiles the bytes of compile and compileStreaming in a promise job
+    static Var EntryCompileJob(RecyclableObject* function, CallInfo callInfo, ...);
     static Var EntryValidate(RecyclableObject* function, CallInfo callInfo, ...);
     static Var EntryInstantiate(RecyclableObject* function, CallInfo callInfo, ...);
     static Var EntryInstantiateStreaming(RecyclableObject* function, CallInfo callInfo, ...);
-    // The import object is the first argument, then the buffer source
+    // The import object is the first argument, then the bytes
     static Var EntryInstantiateBound(RecyclableObject* function, CallInfo callInfo, ...);
     static Var EntryQueryResponse(RecyclableObject* function, CallInfo callInfo, ...);
 
@@ -41,6 +44,9 @@ class WebAssembly
 private:
     static bool IsResponseObject(Var responseObject, ScriptContext* scriptContext);
     static Var TryResolveResponse(RecyclableObject* function, Var thisArg, Var responseArg);
+    static Var CreateCompileJobPromise(Var* boundArgs, uint boundArgCount, ScriptContext* scriptContext);
+    static ArrayBuffer* GetCompileJobBytes(Arguments& args, uint bytesIndex, ScriptContext* scriptContext);
+    static RecyclableObject* CreateInstantiateJobFunction(Var importObject, ScriptContext* scriptContext);
 #endif
 };
 
@@ -12,7 +12,7 @@
 
 namespace Js
 {
-WebAssemblyModule::WebAssemblyModule(Js::ScriptContext* scriptContext, const byte* binaryBuffer, uint binaryBufferLength, DynamicType * type) :
+WebAssemblyModule::WebAssemblyModule(Js::ScriptContext* scriptContext, const byte* binaryBuffer, uint binaryBufferLength, Var binaryBufferOwner, DynamicType * type) :
     DynamicObject(type),
     m_hasMemory(false),
     m_hasTable(false),
@@ -34,6 +34,7 @@ WebAssemblyModule::WebAssemblyModule(Js::ScriptContext* scriptContext, const byt
     m_startFuncIndex(Js::Constants::UninitializedValue),
     m_binaryBuffer(binaryBuffer),
     m_binaryBufferLength(binaryBufferLength),
+    m_binaryBufferOwner(binaryBufferOwner),
     m_customSections(nullptr)
 {
     m_alloc = HeapNew(ArenaAllocator, _u("WebAssemblyModule"), scriptContext->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory);
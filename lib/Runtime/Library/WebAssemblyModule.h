@@ -69,7 +69,7 @@ class WebAssemblyModule : public DynamicObject
         class WebAssemblySource* src);
 
 public:
-    WebAssemblyModule(Js::ScriptContext* scriptContext, const byte* binaryBuffer, uint binaryBufferLength, DynamicType * type);
+    WebAssemblyModule(Js::ScriptContext* scriptContext, const byte* binaryBuffer, uint binaryBufferLength, Var binaryBufferOwner, DynamicType * type);
 
     const byte* GetBinaryBuffer() const { return m_binaryBuffer; }
     uint GetBinaryBufferLength() const { return m_binaryBufferLength; }
@@ -174,6 +174,8 @@ class WebAssemblyModule : public DynamicObject
     // The binary buffer is recycler allocated, tied the lifetime of the buffer to the module
     Field(const byte*) m_binaryBuffer;
     Field(uint) m_binaryBufferLength;
+    // Unless it belongs to an ArrayBuffer copied by WebAssembly.compile/instantiate, which the module keeps alive instead
+    Field(Var) m_binaryBufferOwner;
     Field(uint32) m_memoryInitSize;
     Field(uint32) m_memoryMaxSize;
     Field(uint32) m_tableInitSize;
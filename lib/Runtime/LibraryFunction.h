@@ -79,6 +79,11 @@ LIBRARY_FUNCTION(Math,          Fround,             1,    BIF_TypeSpecUnaryToFlo
 LIBRARY_FUNCTION(JavascriptString,        PadStart,           2,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , JavascriptString::EntryInfo::PadStart)
 LIBRARY_FUNCTION(JavascriptString,        PadEnd,             2,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , JavascriptString::EntryInfo::PadEnd)
 LIBRARY_FUNCTION(JavascriptObject,        HasOwnProperty,     2,    BIF_UseSrc0                                           , JavascriptObject::EntryInfo::HasOwnProperty)
+LIBRARY_FUNCTION(JavascriptMap,           Get,                2,    BIF_UseSrc0                                           , JavascriptMap::EntryInfo::Get)
+LIBRARY_FUNCTION(JavascriptMap,           Has,                2,    BIF_UseSrc0                                           , JavascriptMap::EntryInfo::Has)
+LIBRARY_FUNCTION(JavascriptMap,           Set,                3,    BIF_UseSrc0 | BIF_IgnoreDst                           , JavascriptMap::EntryInfo::Set)
+LIBRARY_FUNCTION(JavascriptSet,           Add,                2,    BIF_UseSrc0 | BIF_IgnoreDst                           , JavascriptSet::EntryInfo::Add)
+LIBRARY_FUNCTION(JavascriptSet,           Has,                2,    BIF_UseSrc0                                           , JavascriptSet::EntryInfo::Has)
 
 // Note: 1st column is currently used only for debug tracing.
 
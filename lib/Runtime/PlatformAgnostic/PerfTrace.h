@@ -12,7 +12,18 @@
 // some metadata must be provided describing what memory address ranges
 // correspond to what compiled function.
 //
+// Two ways are supported: a perf-<pid>.map symbol file written on SIGUSR2,
+// and, with -PerfJitDump, a jit-<pid>.dump file that records the code bytes
+// and line tables of every function as it is jitted (see the jitdump
+// specification in the Linux perf sources).
+//
 
+namespace Js
+{
+    class FunctionBody;
+    class FunctionEntryPointInfo;
+    class LoopEntryPointInfo;
+}
 
 namespace PlatformAgnostic
 {
@@ -27,6 +38,10 @@ class PerfTrace
 
     static void WritePerfMap();
 
+    static bool IsJitDumpEnabled();
+    static void LogMethodNativeLoadEvent(Js::FunctionBody* body, Js::FunctionEntryPointInfo* entryPoint);
+    static void LogLoopBodyLoadEvent(Js::FunctionBody* body, Js::LoopEntryPointInfo* entryPoint, uint16 loopNumber);
+
     static volatile sig_atomic_t mapsRequested;
 };
 
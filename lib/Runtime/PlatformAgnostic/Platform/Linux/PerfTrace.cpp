@@ -9,6 +9,13 @@
 #include <signal.h>
 #include <errno.h>
 #include <unistd.h>
+#if ENABLE_NATIVE_CODEGEN && defined(__linux__)
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
 
 using namespace Js;
 
@@ -147,6 +154,339 @@ void  PerfTrace::WritePerfMap()
     PerfTrace::mapsRequested = 0;
 }
 
+#if ENABLE_NATIVE_CODEGEN && defined(__linux__)
+
+//
+// jitdump file format, version 1. The file is a header followed by records; perf inject --jit
+// turns each code load record into an ELF image with the code bytes and the line table from the
+// debug info record that precedes it. Code freed by the engine needs no record: a later load at
+// the same address has a later timestamp and takes over the range from then on.
+//
+static const uint32 JitDumpMagic = 0x4A695444;
+static const uint32 JitDumpVersion = 1;
+
+enum JitDumpRecordType : uint32
+{
+    JitDumpRecordType_CodeLoad = 0,
+    JitDumpRecordType_DebugInfo = 2
+};
+
+struct JitDumpFileHeader
+{
+    uint32 magic;
+    uint32 version;
+    uint32 totalSize;
+    uint32 elfMachine;
+    uint32 pad1;
+    uint32 processId;
+    uint64 timestamp;
+    uint64 flags;
+};
+
+struct JitDumpRecordHeader
+{
+    uint32 id;
+    uint32 totalSize;
+    uint64 timestamp;
+};
+
+// Followed by the null terminated function name and the code bytes
+struct JitDumpCodeLoadRecord
+{
+    JitDumpRecordHeader header;
+    uint32 processId;
+    uint32 threadId;
+    uint64 vma;
+    uint64 codeAddress;
+    uint64 codeSize;
+    uint64 codeIndex;
+};
+
+// Followed by entryCount entries
+struct JitDumpDebugInfoRecord
+{
+    JitDumpRecordHeader header;
+    uint64 codeAddress;
+    uint64 entryCount;
+};
+
+// Followed by the null terminated source file name
+struct JitDumpDebugEntry
+{
+    uint64 address;
+    uint32 lineNumber;
+    uint32 discriminator;
+};
+
+CompileAssert(sizeof(JitDumpFileHeader) == 40);
+CompileAssert(sizeof(JitDumpCodeLoadRecord) == 56);
+CompileAssert(sizeof(JitDumpDebugInfoRecord) == 32);
+CompileAssert(sizeof(JitDumpDebugEntry) == 16);
+
+static CriticalSection jitDumpCs;
+static FILE * jitDumpFile = nullptr;
+static bool jitDumpOpenAttempted = false;
+static uint64 jitDumpCodeIndex = 0;
+
+// The timestamps have to come from the clock perf record uses, -k mono
+static uint64 GetJitDumpTimestamp()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64)now.tv_sec * 1000000000 + (uint64)now.tv_nsec;
+}
+
+static uint32 GetJitDumpElfMachine()
+{
+#if defined(_M_X64)
+    return EM_X86_64;
+#elif defined(_M_IX86)
+    return EM_386;
+#elif defined(_M_ARM64)
+    return EM_AARCH64;
+#elif defined(_M_ARM)
+    return EM_ARM;
+#else
+    return EM_NONE;
+#endif
+}
+
+//
+// Opens /tmp/jit-<pid>.dump on the first jitted function. Must be called under jitDumpCs.
+//
+static bool EnsureJitDumpFile()
+{
+    if (jitDumpOpenAttempted)
+    {
+        return jitDumpFile != nullptr;
+    }
+    jitDumpOpenAttempted = true;
+
+    const size_t JITDUMP_FILENAME_MAX_LENGTH = 30;
+    char jitDumpFilename[JITDUMP_FILENAME_MAX_LENGTH];
+    snprintf(jitDumpFilename, JITDUMP_FILENAME_MAX_LENGTH, "/tmp/jit-%d.dump", getpid());
+
+    int fd = open(jitDumpFilename, O_CREAT | O_TRUNC | O_RDWR, 0666);
+    if (fd == -1)
+    {
+        return false;
+    }
+
+    // perf record only learns where the file is from an executable mapping of it, which is
+    // kept for the lifetime of the process
+    void * marker = mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+    if (marker == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+
+    FILE * file = fdopen(fd, "wb");
+    if (file == nullptr)
+    {
+        munmap(marker, sysconf(_SC_PAGESIZE));
+        close(fd);
+        return false;
+    }
+
+    JitDumpFileHeader header = { 0 };
+    header.magic = JitDumpMagic;
+    header.version = JitDumpVersion;
+    header.totalSize = sizeof(JitDumpFileHeader);
+    header.elfMachine = GetJitDumpElfMachine();
+    header.processId = (uint32)getpid();
+    header.timestamp = GetJitDumpTimestamp();
+    fwrite(&header, sizeof(header), 1, file);
+    fflush(file);
+
+    jitDumpFile = file;
+    return true;
+}
+
+//
+// Returns the UTF-8 encoded source file of the function, or nullptr if it has none.
+// The caller frees the result with HeapDeleteArray(*length, result).
+//
+static char * GetJitDumpSourceFileName(FunctionBody * body, size_t * length)
+{
+    if (body->GetSourceContextInfo()->IsDynamic())
+    {
+        return nullptr;
+    }
+
+    const char16 * url = body->GetSourceContextInfo()->url;
+    if (url == nullptr)
+    {
+        return nullptr;
+    }
+
+    const charcount_t urlLength = (charcount_t)min(wcslen(url), (size_t)UINT_MAX / 3 - 1);
+    *length = urlLength * 3 + 1;
+    utf8char_t * fileName = HeapNewNoThrowArray(utf8char_t, *length);
+    if (fileName != nullptr)
+    {
+        utf8::EncodeIntoAndNullTerminate(fileName, url, urlLength);
+    }
+    return (char *)fileName;
+}
+
+//
+// Writes the line table of the entry point, built from the native offset maps of its statements
+//
+static void WriteJitDumpDebugInfo(FunctionBody * body, EntryPointInfo * entryPoint, uint64 timestamp)
+{
+    if (entryPoint->GetNativeOffsetMapCount() == 0)
+    {
+        return;
+    }
+
+    size_t fileNameBufferLength = 0;
+    char * fileName = GetJitDumpSourceFileName(body, &fileNameBufferLength);
+    if (fileName == nullptr)
+    {
+        return;
+    }
+
+    // One entry for the function itself and one for each statement range
+    const uint entryCapacity = (uint)entryPoint->GetNativeOffsetMapCount() + 1;
+    JitDumpDebugEntry * entries = HeapNewNoThrowArray(JitDumpDebugEntry, entryCapacity);
+    if (entries != nullptr)
+    {
+        const uint64 codeAddress = (uint64)entryPoint->GetNativeAddress();
+        uint entryCount = 0;
+        auto addEntry = [&](uint32 offset, ULONG lineNumber)
+        {
+            if (lineNumber == 0 || (entryCount != 0 && entries[entryCount - 1].lineNumber == lineNumber))
+            {
+                return;
+            }
+            if (entryCount != 0 && entries[entryCount - 1].address == codeAddress + offset)
+            {
+                // Empty range, the later statement wins
+                entryCount--;
+            }
+            entries[entryCount].address = codeAddress + offset;
+            entries[entryCount].lineNumber = (uint32)lineNumber;
+            entries[entryCount].discriminator = 0;
+            entryCount++;
+        };
+
+        addEntry(0, body->GetLineNumber());
+        entryPoint->MapNativeOffsetMaps([&](uint32 statementIndex, uint32 begin, uint32 end)
+        {
+            addEntry(begin, statementIndex == 0 ? body->GetLineNumber() : body->GetSourceLineNumber(statementIndex));
+        });
+
+        const size_t fileNameSize = strlen(fileName) + 1;
+        JitDumpDebugInfoRecord record;
+        record.header.id = JitDumpRecordType_DebugInfo;
+        record.header.totalSize = (uint32)(sizeof(record) + entryCount * (sizeof(JitDumpDebugEntry) + fileNameSize));
+        record.header.timestamp = timestamp;
+        record.codeAddress = codeAddress;
+        record.entryCount = entryCount;
+
+        fwrite(&record, sizeof(record), 1, jitDumpFile);
+        for (uint i = 0; i < entryCount; i++)
+        {
+            fwrite(&entries[i], sizeof(JitDumpDebugEntry), 1, jitDumpFile);
+            fwrite(fileName, fileNameSize, 1, jitDumpFile);
+        }
+
+        HeapDeleteArray(entryCapacity, entries);
+    }
+
+    HeapDeleteArray(fileNameBufferLength, (utf8char_t *)fileName);
+}
+
+//
+// Writes the debug info and code load records of a jitted entry point. The name follows
+// the perf-<pid>.map naming, e.g. "foo(FullJIT)" or "foo(Loop2)".
+//
+static void WriteJitDumpCodeLoad(FunctionBody * body, EntryPointInfo * entryPoint, const char * suffix)
+{
+    const char16 * displayName = body->GetExternalDisplayName();
+    const charcount_t displayNameLength = (charcount_t)min(wcslen(displayName), (size_t)UINT_MAX / 3 - 1);
+    const size_t suffixSize = strlen(suffix) + 1;
+    const size_t nameBufferLength = displayNameLength * 3 + suffixSize;
+    utf8char_t * name = HeapNewNoThrowArray(utf8char_t, nameBufferLength);
+    if (name == nullptr)
+    {
+        return;
+    }
+
+    const size_t displayNameSize = utf8::EncodeInto(name, displayName, displayNameLength);
+    memcpy(name + displayNameSize, suffix, suffixSize);
+    const size_t nameSize = displayNameSize + suffixSize;
+
+    {
+        AutoCriticalSection autoJitDumpCs(&jitDumpCs);
+        if (EnsureJitDumpFile())
+        {
+            const uint64 timestamp = GetJitDumpTimestamp();
+            WriteJitDumpDebugInfo(body, entryPoint, timestamp);
+
+            JitDumpCodeLoadRecord record;
+            record.header.id = JitDumpRecordType_CodeLoad;
+            record.header.totalSize = (uint32)(sizeof(record) + nameSize + entryPoint->GetCodeSize());
+            record.header.timestamp = timestamp;
+            record.processId = (uint32)getpid();
+            record.threadId = (uint32)syscall(SYS_gettid);
+            record.vma = (uint64)entryPoint->GetNativeAddress();
+            record.codeAddress = record.vma;
+            record.codeSize = entryPoint->GetCodeSize();
+            record.codeIndex = jitDumpCodeIndex++;
+
+            fwrite(&record, sizeof(record), 1, jitDumpFile);
+            fwrite(name, nameSize, 1, jitDumpFile);
+            fwrite((void *)entryPoint->GetNativeAddress(), entryPoint->GetCodeSize(), 1, jitDumpFile);
+            fflush(jitDumpFile);
+        }
+    }
+
+    HeapDeleteArray(nameBufferLength, name);
+}
+
+bool PerfTrace::IsJitDumpEnabled()
+{
+    return CONFIG_FLAG_RELEASE(PerfJitDump);
+}
+
+void PerfTrace::LogMethodNativeLoadEvent(FunctionBody* body, FunctionEntryPointInfo* entryPoint)
+{
+    if (IsJitDumpEnabled())
+    {
+        WriteJitDumpCodeLoad(body, entryPoint,
+            entryPoint->GetJitMode() == ExecutionMode::SimpleJit ? "(SimpleJIT)" : "(FullJIT)");
+    }
+}
+
+void PerfTrace::LogLoopBodyLoadEvent(FunctionBody* body, LoopEntryPointInfo* entryPoint, uint16 loopNumber)
+{
+    if (IsJitDumpEnabled())
+    {
+        char suffix[20];
+        snprintf(suffix, sizeof(suffix), "(Loop%u)", (uint)loopNumber + 1);
+        WriteJitDumpCodeLoad(body, entryPoint, suffix);
+    }
+}
+
+#else
+
+bool PerfTrace::IsJitDumpEnabled()
+{
+    return false;
+}
+
+void PerfTrace::LogMethodNativeLoadEvent(FunctionBody* body, FunctionEntryPointInfo* entryPoint)
+{
+}
+
+void PerfTrace::LogLoopBodyLoadEvent(FunctionBody* body, LoopEntryPointInfo* entryPoint, uint16 loopNumber)
+{
+}
+
+#endif // ENABLE_NATIVE_CODEGEN && defined(__linux__)
+
 }
 
 #endif // PERFMAP_TRACE_ENABLED
\ No newline at end of file
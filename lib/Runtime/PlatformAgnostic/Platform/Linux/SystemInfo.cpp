@@ -6,6 +6,8 @@
 #include "Common.h"
 #include "ChakraPlatform.h"
 #include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace PlatformAgnostic
 {
@@ -19,4 +21,51 @@ namespace PlatformAgnostic
         *totalAS = limit.rlim_cur;
         return true;
     }
+
+    bool SystemInfo::GetSystemCpuTimes(ULONGLONG *idleTime, ULONGLONG *totalTime)
+    {
+        // The first line of /proc/stat has the time all processors spent in each state, in clock ticks:
+        // cpu  user nice system idle iowait irq softirq steal guest guest_nice
+        int fd = open("/proc/stat", O_RDONLY);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        char buffer[256];
+        ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+        close(fd);
+        if (length <= 4 || memcmp(buffer, "cpu ", 4) != 0)
+        {
+            return false;
+        }
+        buffer[length] = '\0';
+
+        uint64 times[8] = { 0 };
+        const char *p = buffer + 4;
+        for (size_t i = 0; i < _countof(times); i++)
+        {
+            while (*p == ' ')
+            {
+                p++;
+            }
+            if (*p < '0' || *p > '9')
+            {
+                break;
+            }
+            while (*p >= '0' && *p <= '9')
+            {
+                times[i] = times[i] * 10 + (*p++ - '0');
+            }
+        }
+
+        // Guest time is already accounted for in user time. Count I/O wait as idle, the processor is available.
+        *idleTime = times[3] + times[4];
+        *totalTime = 0;
+        for (size_t i = 0; i < _countof(times); i++)
+        {
+            *totalTime += times[i];
+        }
+        return *totalTime != 0;
+    }
 }
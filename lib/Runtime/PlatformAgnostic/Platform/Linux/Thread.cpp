@@ -8,6 +8,14 @@
 
 #include <stdint.h>
 
+#if defined(__linux__)
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
 namespace PlatformAgnostic
 {
     Thread::ThreadHandle Thread::Create(unsigned stack_size,
@@ -34,4 +42,57 @@ namespace PlatformAgnostic
 
         return reinterpret_cast<ThreadHandle>(CreateThread(0, stack_size, start_address, arg_list, flag, 0));
     }
+
+    bool Thread::WaitForAddressChange(volatile int32_t *address, int32_t compareValue, uint32_t timeoutMs)
+    {
+#if defined(__linux__)
+        const int64 nsPerSecond = 1000000000;
+        struct timespec deadline;
+        if (timeoutMs != INFINITE)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            int64 deadlineNs = deadline.tv_nsec + (int64)(timeoutMs % 1000) * 1000000;
+            deadline.tv_sec += timeoutMs / 1000 + deadlineNs / nsPerSecond;
+            deadline.tv_nsec = deadlineNs % nsPerSecond;
+        }
+
+        while (*address == compareValue)
+        {
+            struct timespec remaining;
+            struct timespec *waitTime = nullptr;
+            if (timeoutMs != INFINITE)
+            {
+                struct timespec now;
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                int64 remainingNs = (int64)(deadline.tv_sec - now.tv_sec) * nsPerSecond + (deadline.tv_nsec - now.tv_nsec);
+                if (remainingNs <= 0)
+                {
+                    return false;
+                }
+                remaining.tv_sec = remainingNs / nsPerSecond;
+                remaining.tv_nsec = remainingNs % nsPerSecond;
+                waitTime = &remaining;
+            }
+
+            // FUTEX_WAIT returns right away if the value already changed, and early on signals or spurious wakes,
+            // so the value decides whether the wait is over. The timeout is relative to CLOCK_MONOTONIC.
+            if (syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, compareValue, waitTime, nullptr, 0) == -1 && errno == ETIMEDOUT)
+            {
+                break;
+            }
+        }
+        return *address != compareValue;
+#else
+        // TODO: park on ulock or a condition variable on OSX
+        return *address != compareValue;
+#endif
+    }
+
+    void Thread::WakeAddressWaiters(volatile int32_t *address, int32_t count)
+    {
+#if defined(__linux__)
+        // Releases up to count threads parked on the address
+        syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#endif
+    }
 } // namespace PlatformAgnostic
@@ -6,6 +6,7 @@
 #include "Common.h"
 #include "ChakraPlatform.h"
 #include <sys/sysctl.h>
+#include <mach/mach.h>
 
 namespace PlatformAgnostic
 {
@@ -20,4 +21,22 @@ namespace PlatformAgnostic
         *totalAS = limit.rlim_cur;
         return true;
     }
+
+    bool SystemInfo::GetSystemCpuTimes(ULONGLONG *idleTime, ULONGLONG *totalTime)
+    {
+        host_cpu_load_info_data_t loadInfo;
+        mach_msg_type_number_t count = HOST_CPU_LOAD_INFO_COUNT;
+        if (host_statistics(mach_host_self(), HOST_CPU_LOAD_INFO, (host_info_t)&loadInfo, &count) != KERN_SUCCESS)
+        {
+            return false;
+        }
+
+        *idleTime = loadInfo.cpu_ticks[CPU_STATE_IDLE];
+        *totalTime = 0;
+        for (int i = 0; i < CPU_STATE_MAX; i++)
+        {
+            *totalTime += loadInfo.cpu_ticks[i];
+        }
+        return *totalTime != 0;
+    }
 }
@@ -25,6 +25,19 @@ void  PerfTrace::WritePerfMap()
     // TODO: Implement this on Windows?
 }
 
+bool PerfTrace::IsJitDumpEnabled()
+{
+    return false;
+}
+
+void PerfTrace::LogMethodNativeLoadEvent(FunctionBody* body, FunctionEntryPointInfo* entryPoint)
+{
+}
+
+void PerfTrace::LogLoopBodyLoadEvent(FunctionBody* body, LoopEntryPointInfo* entryPoint, uint16 loopNumber)
+{
+}
+
 }
 
 #endif // PERFMAP_TRACE_ENABLED
\ No newline at end of file
@@ -17,4 +17,19 @@ namespace PlatformAgnostic
         return true;
     }
 
+    bool SystemInfo::GetSystemCpuTimes(ULONGLONG *idleTime, ULONGLONG *totalTime)
+    {
+        FILETIME idle, kernel, user;
+        if (!GetSystemTimes(&idle, &kernel, &user))
+        {
+            return false;
+        }
+
+        // Kernel time includes idle time
+        *idleTime = ((uint64)idle.dwHighDateTime << 32) | idle.dwLowDateTime;
+        *totalTime = (((uint64)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime) +
+            (((uint64)user.dwHighDateTime << 32) | user.dwLowDateTime);
+        return true;
+    }
+
 }
@@ -425,6 +425,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Base/TempArenaAllocatorObject.h"
 #include "Language/ValueType.h"
 #include "Language/DynamicProfileInfo.h"
+#include "Language/AllocationSiteInfo.h"
 #include "Base/SourceContextInfo.h"
 #include "Language/InlineCache.h"
 #include "Language/InlineCachePointerArray.h"
@@ -3587,6 +3587,26 @@ VirtualProtectEx(
            IN DWORD flNewProtect,
            OUT PDWORD lpflOldProtect);
 
+#define WRITE_WATCH_FLAG_RESET          0x01
+
+PALIMPORT
+UINT
+PALAPI
+GetWriteWatch(
+          IN DWORD dwFlags,
+          IN PVOID lpBaseAddress,
+          IN SIZE_T dwRegionSize,
+          OUT PVOID *lpAddresses,
+          IN OUT ULONG_PTR *lpdwCount,
+          OUT LPDWORD lpdwGranularity);
+
+PALIMPORT
+UINT
+PALAPI
+ResetWriteWatch(
+          IN LPVOID lpBaseAddress,
+          IN SIZE_T dwRegionSize);
+
 typedef struct _MEMORYSTATUSEX {
   DWORD     dwLength;
   DWORD     dwMemoryLoad;
@@ -3607,7 +3627,7 @@ GlobalMemoryStatusEx(
 
 typedef struct _MEMORY_BASIC_INFORMATION {
     PVOID BaseAddress;
-    PVOID AllocationBase_PAL_Undefined;
+    PVOID AllocationBase;
     DWORD AllocationProtect;
     SIZE_T RegionSize;
     DWORD State;
@@ -5792,6 +5812,14 @@ PAL_InjectActivation(
     IN HANDLE hThread
 );
 
+typedef BOOL (*PAL_AccessViolationFilter)(PEXCEPTION_POINTERS pointers);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_SetAccessViolationFilter(
+    IN PAL_AccessViolationFilter pAccessViolationFilter);
+
 #define VER_PLATFORM_WIN32_WINDOWS        1
 #define VER_PLATFORM_WIN32_NT        2
 #define VER_PLATFORM_UNIX            10
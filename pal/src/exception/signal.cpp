@@ -68,6 +68,9 @@ static void sigbus_handler(int code, siginfo_t *siginfo, void *context);
 static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
                                   native_context_t *ucontext);
 
+static BOOL filter_access_violation(PEXCEPTION_POINTERS pointers,
+                                    native_context_t *ucontext);
+
 static void inject_activation_handler(int code, siginfo_t *siginfo, void *context);
 
 static void handle_signal(int signal_id, SIGFUNC sigfunc, struct sigaction *previousAction);
@@ -81,9 +84,33 @@ struct sigaction g_previous_sigfpe;
 struct sigaction g_previous_sigbus;
 struct sigaction g_previous_sigsegv;
 
+static PAL_AccessViolationFilter g_accessViolationFilter = NULL;
 
 /* public function definitions ************************************************/
 
+/*++
+Function :
+    PAL_SetAccessViolationFilter
+
+    Register a filter that gets the first chance to handle an access violation.
+    If the filter returns TRUE, the (possibly modified) context record is
+    written back and execution resumes there instead of the signal being
+    chained to the previous handler.
+
+Parameters :
+    pAccessViolationFilter - filter to call, or NULL to remove it
+
+    (no return value)
+--*/
+PALIMPORT
+VOID
+PALAPI
+PAL_SetAccessViolationFilter(
+    IN PAL_AccessViolationFilter pAccessViolationFilter)
+{
+    g_accessViolationFilter = pAccessViolationFilter;
+}
+
 /*++
 Function :
     SEHInitializeSignals
@@ -290,6 +317,11 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
+        if (filter_access_violation(&pointers, ucontext))
+        {
+            return;
+        }
+
         common_signal_handler(&pointers, code, ucontext);
     }
 
@@ -515,6 +547,48 @@ BOOL SEHGetSafeState(CPalThread *pthrCurrent)
     return pthrCurrent->sehInfo.safe_state;
 }
 
+/*++
+Function :
+    filter_access_violation
+
+    give the registered access violation filter a chance to recover from the fault
+
+Parameters :
+    PEXCEPTION_POINTERS pointers : exception information
+    native_context_t *ucontext : context structure given to signal handler
+
+Return :
+    TRUE if the filter handled the fault and ucontext was updated to resume
+    execution, FALSE otherwise
+--*/
+static BOOL filter_access_violation(PEXCEPTION_POINTERS pointers,
+                                    native_context_t *ucontext)
+{
+    PAL_AccessViolationFilter filter = g_accessViolationFilter;
+    if (filter == NULL || pointers->ExceptionRecord->ExceptionCode != EXCEPTION_ACCESS_VIOLATION)
+    {
+        return FALSE;
+    }
+
+    CONTEXT context;
+
+    // See common_signal_handler. The filter may also need the floating point
+    // registers, e.g. to set the destination of a faulting load.
+    RtlCaptureContext(&context);
+    CONTEXTFromNativeContext(ucontext, &context,
+                             CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_FLOATING_POINT);
+
+    pointers->ContextRecord = &context;
+
+    if (!filter(pointers))
+    {
+        return FALSE;
+    }
+
+    CONTEXTToNativeContext(&context, ucontext);
+    return TRUE;
+}
+
 /*++
 Function :
     common_signal_handler
@@ -41,6 +41,45 @@ Module Name:
 #include <mach/mach_init.h>
 #endif // HAVE_VM_ALLOCATE
 
+#if defined(__LINUX__)
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#include <linux/userfaultfd.h>
+#if defined(UFFDIO_WRITEPROTECT) && !defined(PAGEMAP_SCAN)
+// Kernel headers older than 6.7; the ABI is stable, so declare what we need. Support is checked at runtime.
+#define UFFD_FEATURE_WP_UNPOPULATED     (1 << 13)
+#define UFFD_FEATURE_WP_ASYNC           (1 << 15)
+#define PM_SCAN_WP_MATCHING             (1 << 0)
+#define PAGE_IS_WRITTEN                 (1 << 1)
+struct page_region { __u64 start; __u64 end; __u64 categories; };
+struct pm_scan_arg
+{
+    __u64 size; __u64 flags; __u64 start; __u64 end; __u64 walk_end; __u64 vec; __u64 vec_len;
+    __u64 max_pages; __u64 category_inverted; __u64 category_mask; __u64 category_anyof_mask; __u64 return_mask;
+};
+#define PAGEMAP_SCAN                    _IOWR('f', 16, struct pm_scan_arg)
+#endif
+#if defined(PAGEMAP_SCAN) && defined(UFFD_FEATURE_WP_ASYNC) && defined(UFFD_FEATURE_WP_UNPOPULATED) && defined(__NR_userfaultfd)
+#define HAVE_UFFD_WRITE_WATCH 1
+#endif
+#endif // __LINUX__
+
+#ifndef HAVE_UFFD_WRITE_WATCH
+#define HAVE_UFFD_WRITE_WATCH 0
+#endif
+
+#if defined(__LINUX__) && defined(MADV_HUGEPAGE) && !MMAP_IGNORES_HINT && !MMAP_DOESNOT_ALLOW_REMAP && !RESERVE_FROM_BACKING_FILE
+// Regions of at least a huge page are reserved at a huge page boundary, and their committed pages are advised
+// for transparent huge pages. Whether huge pages are used is still up to the system's transparent_hugepage setting.
+#define HAVE_HUGE_PAGE_HINTS 1
+#define VIRTUAL_HUGE_PAGE_SIZE ((SIZE_T)2 * 1024 * 1024)
+#define VIRTUAL_HUGE_PAGE_MASK (VIRTUAL_HUGE_PAGE_SIZE - 1)
+#else
+#define HAVE_HUGE_PAGE_HINTS 0
+#endif
+
 using namespace CorUnix;
 
 SET_DEFAULT_DEBUG_CHANNEL(VIRTUAL);
@@ -60,6 +99,157 @@ typedef struct FREE_BLOCK {
 static PCMI pVirtualMemoryLastFound;
 static PCMI pVirtualMemory;
 
+#if HAVE_UFFD_WRITE_WATCH
+// MEM_WRITE_WATCH emulation.
+//
+// Regions reserved with MEM_WRITE_WATCH are registered with a userfaultfd in asynchronous
+// write-protect mode: a write to a protected page just drops the protection inside the kernel,
+// no fault is ever delivered to us. PAGEMAP_SCAN reports the unprotected pages of a range as
+// written and can re-protect them atomically, which gives the per range semantics of
+// GetWriteWatch/ResetWriteWatch. Pages in an unknown state are reported as written.
+static int gWriteWatchUffd = -1;
+static int gWriteWatchPagemap = -1;
+
+static BOOL VIRTUALInitializeWriteWatch()
+{
+    int flags = O_CLOEXEC | O_NONBLOCK;
+#ifdef UFFD_USER_MODE_ONLY
+    // Asynchronous write-protect faults are resolved by the kernel, so we never need kernel mode faults
+    flags |= UFFD_USER_MODE_ONLY;
+#endif
+    int uffd = (int)syscall(__NR_userfaultfd, flags);
+    if (uffd < 0)
+    {
+        WARN("userfaultfd() failed, write watch is not available. Error(%d)=%s\n", errno, strerror(errno));
+        return FALSE;
+    }
+
+    struct uffdio_api api;
+    memset(&api, 0, sizeof(api));
+    api.api = UFFD_API;
+    api.features = UFFD_FEATURE_WP_ASYNC | UFFD_FEATURE_WP_UNPOPULATED;
+    if (ioctl(uffd, UFFDIO_API, &api) != 0)
+    {
+        WARN("UFFDIO_API failed, write watch is not available. Error(%d)=%s\n", errno, strerror(errno));
+        close(uffd);
+        return FALSE;
+    }
+
+    int pagemap = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (pagemap < 0)
+    {
+        WARN("Unable to open /proc/self/pagemap, write watch is not available. Error(%d)=%s\n", errno, strerror(errno));
+        close(uffd);
+        return FALSE;
+    }
+
+    gWriteWatchUffd = uffd;
+    gWriteWatchPagemap = pagemap;
+    return TRUE;
+}
+
+static BOOL VIRTUALIsWriteWatchSupported()
+{
+    static BOOL isSupported = VIRTUALInitializeWriteWatch();
+    return isSupported;
+}
+
+/****
+ *  VIRTUALWatchRange() -
+ *          Registers [startBoundary, startBoundary + memSize) for write watch.
+ *          Must be called again whenever the range is remapped, since a new mapping
+ *          is not registered. Writes to a range that fails to register would go unseen,
+ *          so callers must not make it writable.
+ */
+static BOOL VIRTUALWatchRange( UINT_PTR startBoundary, SIZE_T memSize )
+{
+    struct uffdio_register reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.range.start = startBoundary;
+    reg.range.len = memSize;
+    reg.mode = UFFDIO_REGISTER_MODE_WP;
+    if (ioctl(gWriteWatchUffd, UFFDIO_REGISTER, &reg) != 0)
+    {
+        WARN("UFFDIO_REGISTER failed! Error(%d)=%s\n", errno, strerror(errno));
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/****
+ *  VIRTUALResetWatchedRange() -
+ *          Write-protects the range so that the next write to each page is recorded.
+ */
+static BOOL VIRTUALResetWatchedRange( UINT_PTR startBoundary, SIZE_T memSize )
+{
+    struct uffdio_writeprotect wp;
+    memset(&wp, 0, sizeof(wp));
+    wp.range.start = startBoundary;
+    wp.range.len = memSize;
+    wp.mode = UFFDIO_WRITEPROTECT_MODE_WP;
+    if (ioctl(gWriteWatchUffd, UFFDIO_WRITEPROTECT, &wp) != 0)
+    {
+        ERROR("UFFDIO_WRITEPROTECT failed! Error(%d)=%s\n", errno, strerror(errno));
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/****
+ *  VIRTUALScanWatchedRange() -
+ *          Collects up to *pCount written pages of the range into pAddresses,
+ *          re-protecting the collected pages if bReset is set.
+ */
+static BOOL VIRTUALScanWatchedRange( UINT_PTR startBoundary, SIZE_T memSize, BOOL bReset,
+                                     PVOID *pAddresses, ULONG_PTR *pCount )
+{
+    const SIZE_T maxRegions = 64;
+    struct page_region regions[maxRegions];
+    UINT_PTR endBoundary = startBoundary + memSize;
+    UINT_PTR walkStart = startBoundary;
+    ULONG_PTR found = 0;
+
+    while (walkStart < endBoundary && found < *pCount)
+    {
+        struct pm_scan_arg arg;
+        memset(&arg, 0, sizeof(arg));
+        arg.size = sizeof(arg);
+        arg.flags = bReset ? PM_SCAN_WP_MATCHING : 0;
+        arg.start = walkStart;
+        arg.end = endBoundary;
+        arg.vec = (__u64)(UINT_PTR)regions;
+        arg.vec_len = maxRegions;
+        arg.max_pages = *pCount - found;
+        arg.category_mask = PAGE_IS_WRITTEN;
+        arg.return_mask = PAGE_IS_WRITTEN;
+
+        long regionCount = ioctl(gWriteWatchPagemap, PAGEMAP_SCAN, &arg);
+        if (regionCount < 0)
+        {
+            WARN("PAGEMAP_SCAN failed! Error(%d)=%s\n", errno, strerror(errno));
+            return FALSE;
+        }
+
+        for (long i = 0; i < regionCount; i++)
+        {
+            for (UINT_PTR page = regions[i].start; page < regions[i].end && found < *pCount; page += VIRTUAL_PAGE_SIZE)
+            {
+                pAddresses[found++] = (PVOID)page;
+            }
+        }
+
+        if (arg.walk_end <= walkStart)
+        {
+            break;
+        }
+        walkStart = arg.walk_end;
+    }
+
+    *pCount = found;
+    return TRUE;
+}
+#endif // HAVE_UFFD_WRITE_WATCH
+
 #if MMAP_IGNORES_HINT
 // The first node in our list of freed blocks.
 static FREE_BLOCK *pFreeMemory PAL_GLOBAL;
@@ -864,6 +1054,59 @@ static BOOL VIRTUALStoreAllocationInfo(
     return bRetVal;
 }
 
+#if HAVE_HUGE_PAGE_HINTS
+/******
+ *
+ *  VIRTUALReserveHugePageAlignedMemory() - Reserves a region that starts at a huge
+ *  page boundary, so that every aligned 2MB of it can be backed by a huge page.
+ *
+ *  Returns NULL if the padded region could not be reserved, the caller then falls
+ *  back to a regular reservation.
+ *
+ */
+static LPVOID VIRTUALReserveHugePageAlignedMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T MemSize)          /* Size of Region */
+{
+    SIZE_T paddedSize = MemSize + VIRTUAL_HUGE_PAGE_SIZE - VIRTUAL_PAGE_SIZE;
+    LPVOID pReserved = ReserveVirtualMemory(pthrCurrent, NULL, paddedSize);
+    if (pReserved == NULL)
+    {
+        return NULL;
+    }
+
+    // Give the unaligned head and tail of the padding back to the OS
+    UINT_PTR start = (UINT_PTR)pReserved;
+    UINT_PTR end = start + paddedSize;
+    UINT_PTR alignedStart = (start + VIRTUAL_HUGE_PAGE_MASK) & ~VIRTUAL_HUGE_PAGE_MASK;
+    UINT_PTR alignedEnd = alignedStart + MemSize;
+    if (alignedStart != start)
+    {
+        munmap((LPVOID)start, alignedStart - start);
+    }
+    if (alignedEnd != end)
+    {
+        munmap((LPVOID)alignedEnd, end - alignedEnd);
+    }
+
+    TRACE( "Reserved %zu bytes at huge page boundary %p.\n", MemSize, alignedStart );
+    return (LPVOID)alignedStart;
+}
+
+/******
+ *
+ *  VIRTUALIsHugePageRegion() - Whether the committed pages of a region are advised
+ *  for transparent huge pages.
+ *
+ */
+static BOOL VIRTUALIsHugePageRegion( CONST PCMI pInformation )
+{
+    return (pInformation->startBoundary & VIRTUAL_HUGE_PAGE_MASK) == 0 &&
+           pInformation->memSize >= VIRTUAL_HUGE_PAGE_SIZE &&
+           (pInformation->allocationType & MEM_WRITE_WATCH) == 0;
+}
+#endif // HAVE_HUGE_PAGE_HINTS
+
 /******
  *
  *  VIRTUALReserveMemory() - Helper function that actually reserves the memory.
@@ -901,6 +1144,14 @@ static LPVOID VIRTUALReserveMemory(
 
     InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
 
+#if HAVE_HUGE_PAGE_HINTS
+    if (pRetVal == NULL && lpAddress == NULL && MemSize >= VIRTUAL_HUGE_PAGE_SIZE &&
+        (flAllocationType & MEM_WRITE_WATCH) == 0)
+    {
+        pRetVal = VIRTUALReserveHugePageAlignedMemory(pthrCurrent, MemSize);
+    }
+#endif // HAVE_HUGE_PAGE_HINTS
+
     if (pRetVal == NULL)
     {
         // Try to reserve memory from the OS
@@ -929,6 +1180,16 @@ static LPVOID VIRTUALReserveMemory(
             munmap( pRetVal, MemSize );
             pRetVal = NULL;
         }
+#if HAVE_UFFD_WRITE_WATCH
+        else if ( ( flAllocationType & MEM_WRITE_WATCH ) && !VIRTUALWatchRange( StartBoundary, MemSize ) )
+        {
+            // GetWriteWatch would miss the writes to this region, fail the reservation instead
+            VIRTUALReleaseMemory( VIRTUALFindRegionInformation( StartBoundary ) );
+            pthrCurrent->SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+            munmap( pRetVal, MemSize );
+            pRetVal = NULL;
+        }
+#endif // HAVE_UFFD_WRITE_WATCH
     }
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
@@ -1197,10 +1458,31 @@ static LPVOID VIRTUALCommitMemory(
                 ERROR("mmap() failed! Error(%d)=%s\n", errno, strerror(errno));
                 goto error;
             }
+#if HAVE_HUGE_PAGE_HINTS
+            if (VIRTUALIsHugePageRegion(pInformation))
+            {
+                // The new mapping doesn't carry the advice over, give it again. The runs of a region merge
+                // back into one mapping once they are all committed, so a fully committed aligned 2MB range
+                // can be collapsed into a huge page. Failure only means huge pages aren't available.
+                madvise((void *) StartBoundary, MemSize, MADV_HUGEPAGE);
+            }
+#endif // HAVE_HUGE_PAGE_HINTS
             VIRTUALSetAllocState(MEM_COMMIT, runStart, runLength, pInformation);
 #if MMAP_DOESNOT_ALLOW_REMAP
             VIRTUALSetDirtyPages (0, runStart, runLength, pInformation);
 #endif // MMAP_DOESNOT_ALLOW_REMAP
+#if HAVE_UFFD_WRITE_WATCH
+            if ((pInformation->allocationType & MEM_WRITE_WATCH) &&
+                !VIRTUALWatchRange(StartBoundary, MemSize))
+            {
+                // GetWriteWatch would miss the writes to these pages, decommit them again and fail
+                mmap((void *) StartBoundary, MemSize, PROT_NONE,
+                     MAP_ANON | MAP_FIXED | MAP_PRIVATE, -1, 0);
+                VIRTUALSetAllocState(MEM_RESERVE, runStart, runLength, pInformation);
+                pthrCurrent->SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+                goto error;
+            }
+#endif // HAVE_UFFD_WRITE_WATCH
 
             if (nProtect == (PROT_WRITE | PROT_READ))
             {
@@ -1598,7 +1880,9 @@ static bool PAL_Initialize_Check_Once()
   VirtualAlloc
 
 Note:
-  MEM_TOP_DOWN, MEM_PHYSICAL, MEM_WRITE_WATCH are not supported.
+  MEM_TOP_DOWN, MEM_PHYSICAL are not supported.
+  MEM_WRITE_WATCH is only supported on Linux kernels with asynchronous
+  userfaultfd write-protect and PAGEMAP_SCAN (6.7+).
   Unsupported flags are ignored.
 
   Page size on i386 is set to 4k.
@@ -1629,15 +1913,21 @@ VirtualAlloc_(
 
     if ( ( flAllocationType & MEM_WRITE_WATCH )  != 0 )
     {
-        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
-        goto done;
+#if HAVE_UFFD_WRITE_WATCH
+        // Write watch state is tracked for whole regions, so it has to be requested when reserving
+        if ( ( flAllocationType & MEM_RESERVE ) == 0 || !VIRTUALIsWriteWatchSupported() )
+#endif // HAVE_UFFD_WRITE_WATCH
+        {
+            pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+            goto done;
+        }
     }
 
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE | MEM_WRITE_WATCH ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, or MEM_WRITE_WATCH.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -1717,7 +2007,11 @@ VirtualAlloc(
 
     if (reserve || commit)
     {
-        char *address = (char*) VirtualAlloc_(nullptr, dwSize, MEM_RESERVE, flProtect);
+        // Write watch has to be requested when the region is reserved
+        DWORD reserveType = MEM_RESERVE | (flAllocationType & MEM_WRITE_WATCH);
+        flAllocationType &= ~MEM_WRITE_WATCH;
+
+        char *address = (char*) VirtualAlloc_(nullptr, dwSize, reserveType, flProtect);
         if (!address) return nullptr;
 
         if (reserve)
@@ -1732,12 +2026,12 @@ VirtualAlloc(
             char *addr64 = address + (KB64 - diff);
 
             // try reserving from the same address space
-            address = (char*) VirtualAlloc_(addr64, dwSize, MEM_RESERVE, flProtect);
+            address = (char*) VirtualAlloc_(addr64, dwSize, reserveType, flProtect);
 
             if (!address)
             {   // looks like ``pushed new address + dwSize`` is not available
                 // try on a bigger surface
-                address = (char*) VirtualAlloc_(nullptr, dwSize + KB64, MEM_RESERVE, flProtect);
+                address = (char*) VirtualAlloc_(nullptr, dwSize + KB64, reserveType, flProtect);
                 if (!address) return nullptr;
 
                 diff = ((ULONG_PTR)address % KB64);
@@ -1746,7 +2040,7 @@ VirtualAlloc(
                 CPalThread *pthrCurrent = InternalGetCurrentThread();
                 InternalEnterCriticalSection(pthrCurrent, &virtual_realloc);
                 VirtualFree(address, 0, MEM_RELEASE);
-                address = (char*) VirtualAlloc_(addr64, dwSize, MEM_RESERVE, flProtect);
+                address = (char*) VirtualAlloc_(addr64, dwSize, reserveType, flProtect);
                 InternalLeaveCriticalSection(pthrCurrent, &virtual_realloc);
 
                 if (!address) return nullptr;
@@ -1901,6 +2195,14 @@ VirtualFree(
             VIRTUALSetDirtyPages( 1, index,
                                   nNumOfPagesToChange, pUnCommittedMem );
 #endif // MMAP_DOESNOT_ALLOW_REMAP
+#if HAVE_UFFD_WRITE_WATCH
+            if ( pUnCommittedMem->allocationType & MEM_WRITE_WATCH )
+            {
+                // Decommitted pages can't be written, and committing them registers them again
+                // (or fails), so a failure here doesn't lose any writes.
+                VIRTUALWatchRange( StartBoundary, MemSize );
+            }
+#endif // HAVE_UFFD_WRITE_WATCH
 
             goto VirtualFreeExit;
         }
@@ -2375,6 +2677,7 @@ VirtualQuery(
         TRACE( "RegionSize = %d.\n", RegionSize );
 
         /* Fill the structure.*/
+        lpBuffer->AllocationBase = (LPVOID)pEntry->startBoundary;
         lpBuffer->AllocationProtect = pEntry->accessProtection;
         lpBuffer->BaseAddress = (LPVOID)StartBoundary;
 
@@ -2384,7 +2687,9 @@ VirtualQuery(
         lpBuffer->RegionSize = RegionSize;
         lpBuffer->State =
             ( AllocationType == MEM_COMMIT ? MEM_COMMIT : MEM_RESERVE );
-        WARN( "Ignoring lpBuffer->Type. \n" );
+
+        /* Regions tracked here are anonymous mappings made by VirtualAlloc. */
+        lpBuffer->Type = MEM_PRIVATE;
     }
 
 ExitVirtualQuery:
@@ -2395,3 +2700,169 @@ VirtualQuery(
     PERF_EXIT(VirtualQuery);
     return sizeof( *lpBuffer );
 }
+
+/*++
+Function:
+  VIRTUALFindWatchedRegion
+
+  Returns the write watch region containing [lpBaseAddress, lpBaseAddress + dwRegionSize),
+  or NULL if the range is not entirely inside a region reserved with MEM_WRITE_WATCH.
+  NOTE: The caller must own the critical section.
+--*/
+static PCMI VIRTUALFindWatchedRegion( IN LPVOID lpBaseAddress, IN SIZE_T dwRegionSize )
+{
+    UINT_PTR StartBoundary = (UINT_PTR)lpBaseAddress & ~VIRTUAL_PAGE_MASK;
+    PCMI pEntry = VIRTUALFindRegionInformation( StartBoundary );
+
+    if ( !pEntry || !( pEntry->allocationType & MEM_WRITE_WATCH ) ||
+         (UINT_PTR)lpBaseAddress + dwRegionSize > pEntry->startBoundary + pEntry->memSize )
+    {
+        return NULL;
+    }
+    return pEntry;
+}
+
+/*++
+Function:
+  GetWriteWatch
+
+See MSDN doc.
+--*/
+UINT
+PALAPI
+GetWriteWatch(
+          IN DWORD dwFlags,
+          IN PVOID lpBaseAddress,
+          IN SIZE_T dwRegionSize,
+          OUT PVOID *lpAddresses,
+          IN OUT ULONG_PTR *lpdwCount,
+          OUT LPDWORD lpdwGranularity)
+{
+    UINT uRetVal = 1;
+    CPalThread *pthrCurrent;
+
+    PERF_ENTRY(GetWriteWatch);
+    ENTRY("GetWriteWatch(dwFlags=%#x, lpBaseAddress=%p, dwRegionSize=%u, lpAddresses=%p, "
+          "lpdwCount=%p, lpdwGranularity=%p)\n",
+          dwFlags, lpBaseAddress, dwRegionSize, lpAddresses, lpdwCount, lpdwGranularity);
+
+    pthrCurrent = InternalGetCurrentThread();
+
+    if ( ( dwFlags & ~WRITE_WATCH_FLAG_RESET ) != 0 || dwRegionSize == 0 ||
+         !lpAddresses || !lpdwCount || !lpdwGranularity )
+    {
+        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+        goto done;
+    }
+
+    {
+        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        PCMI pEntry = VIRTUALFindWatchedRegion( lpBaseAddress, dwRegionSize );
+        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+
+        if ( !pEntry )
+        {
+            pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+            goto done;
+        }
+    }
+
+#if HAVE_UFFD_WRITE_WATCH
+    {
+        UINT_PTR StartBoundary = (UINT_PTR)lpBaseAddress & ~VIRTUAL_PAGE_MASK;
+        SIZE_T MemSize = ( ((UINT_PTR)lpBaseAddress + dwRegionSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+                         StartBoundary;
+        BOOL bReset = ( dwFlags & WRITE_WATCH_FLAG_RESET ) != 0;
+
+        if ( !VIRTUALScanWatchedRange( StartBoundary, MemSize, bReset, lpAddresses, lpdwCount ) )
+        {
+            // We can't tell which pages were written; report the whole range (up to the
+            // caller's buffer size), which is always safe.
+            ULONG_PTR count = 0;
+            for ( UINT_PTR page = StartBoundary; page < StartBoundary + MemSize && count < *lpdwCount;
+                  page += VIRTUAL_PAGE_SIZE )
+            {
+                lpAddresses[count++] = (PVOID)page;
+            }
+            *lpdwCount = count;
+
+            if ( bReset && count != 0 && !VIRTUALResetWatchedRange( StartBoundary, count * VIRTUAL_PAGE_SIZE ) )
+            {
+                pthrCurrent->SetLastError( ERROR_INTERNAL_ERROR );
+                goto done;
+            }
+        }
+
+        *lpdwGranularity = VIRTUAL_PAGE_SIZE;
+        uRetVal = 0;
+    }
+#else
+    pthrCurrent->SetLastError( ERROR_NOT_SUPPORTED );
+#endif // HAVE_UFFD_WRITE_WATCH
+
+done:
+    LOGEXIT( "GetWriteWatch returning %u.\n", uRetVal );
+    PERF_EXIT(GetWriteWatch);
+    return uRetVal;
+}
+
+/*++
+Function:
+  ResetWriteWatch
+
+See MSDN doc.
+--*/
+UINT
+PALAPI
+ResetWriteWatch(
+          IN LPVOID lpBaseAddress,
+          IN SIZE_T dwRegionSize)
+{
+    UINT uRetVal = 1;
+    CPalThread *pthrCurrent;
+
+    PERF_ENTRY(ResetWriteWatch);
+    ENTRY("ResetWriteWatch(lpBaseAddress=%p, dwRegionSize=%u)\n", lpBaseAddress, dwRegionSize);
+
+    pthrCurrent = InternalGetCurrentThread();
+
+    if ( dwRegionSize == 0 )
+    {
+        pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+        goto done;
+    }
+
+    {
+        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        PCMI pEntry = VIRTUALFindWatchedRegion( lpBaseAddress, dwRegionSize );
+        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+
+        if ( !pEntry )
+        {
+            pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+            goto done;
+        }
+    }
+
+#if HAVE_UFFD_WRITE_WATCH
+    {
+        UINT_PTR StartBoundary = (UINT_PTR)lpBaseAddress & ~VIRTUAL_PAGE_MASK;
+        SIZE_T MemSize = ( ((UINT_PTR)lpBaseAddress + dwRegionSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+                         StartBoundary;
+
+        if ( !VIRTUALResetWatchedRange( StartBoundary, MemSize ) )
+        {
+            pthrCurrent->SetLastError( ERROR_INTERNAL_ERROR );
+            goto done;
+        }
+        uRetVal = 0;
+    }
+#else
+    pthrCurrent->SetLastError( ERROR_NOT_SUPPORTED );
+#endif // HAVE_UFFD_WRITE_WATCH
+
+done:
+    LOGEXIT( "ResetWriteWatch returning %u.\n", uRetVal );
+    PERF_EXIT(ResetWriteWatch);
+    return uRetVal;
+}
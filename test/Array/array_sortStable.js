@@ -0,0 +1,218 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort is a stable merge sort, and TypedArray.prototype.sort without a comparator
+// uses a radix sort on the raw elements for longer arrays.
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function pseudoRandom(seed) {
+    return function () {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed;
+    };
+}
+
+function checkStable(arr, keyName) {
+    for (var i = 1; i < arr.length; i++) {
+        var prev = arr[i - 1], cur = arr[i];
+        assert.isTrue(prev[keyName] < cur[keyName] || (prev[keyName] === cur[keyName] && prev.index < cur.index),
+            "elements " + (i - 1) + " and " + i + " are in stable order");
+    }
+}
+
+function makeRecords(length, keyCount, next) {
+    var arr = [];
+    for (var i = 0; i < length; i++) {
+        arr.push({ key: next() % keyCount, index: i });
+    }
+    return arr;
+}
+
+function numericCompare(a, b) {
+    if (a !== a) {
+        return b !== b ? 0 : 1;
+    }
+    if (b !== b) {
+        return -1;
+    }
+    if (a === 0 && b === 0) {
+        return (1 / a) - (1 / b) < 0 ? -1 : ((1 / a) === (1 / b) ? 0 : 1);
+    }
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+function checkTypedArraySort(ctor, values) {
+    var ta = new ctor(values);
+    var expected = Array.prototype.slice.call(ta).sort(numericCompare);
+    ta.sort();
+    assert.areEqual(expected.length, ta.length, ctor.name + " keeps its length");
+    for (var i = 0; i < ta.length; i++) {
+        assert.isTrue(Object.is(expected[i], ta[i]), ctor.name + " element " + i + " is " + expected[i] + " but was " + ta[i]);
+    }
+}
+
+var tests = [
+    {
+        name: "Sort with a comparator is stable",
+        body: function () {
+            var next = pseudoRandom(7);
+            [10, 31, 32, 33, 100, 513, 2000, 5000].forEach(function (length) {
+                var arr = makeRecords(length, 13, next);
+                arr.sort(function (a, b) { return a.key - b.key; });
+                checkStable(arr, "key");
+            });
+        }
+    },
+    {
+        name: "Default sort is stable for elements with the same string",
+        body: function () {
+            var next = pseudoRandom(11);
+            var arr = [];
+            for (var i = 0; i < 1000; i++) {
+                var record = { key: "k" + (next() % 37), index: i };
+                record.toString = function () { return this.key; };
+                arr.push(record);
+            }
+            arr.sort();
+            checkStable(arr, "key");
+        }
+    },
+    {
+        name: "Presorted, reversed and partially sorted input",
+        body: function () {
+            var length = 3000;
+            var ascending = [], descending = [], sawtooth = [];
+            for (var i = 0; i < length; i++) {
+                ascending.push(i);
+                descending.push(length - i);
+                sawtooth.push(i % 250);
+            }
+            var compare = function (a, b) { return a - b; };
+
+            var calls = 0;
+            ascending.sort(function (a, b) { calls++; return a - b; });
+            assert.isTrue(calls < length, "sorted input takes a linear number of comparisons, took " + calls);
+
+            descending.sort(compare);
+            sawtooth.sort(compare);
+            for (var i = 1; i < length; i++) {
+                assert.isTrue(ascending[i - 1] < ascending[i], "ascending input stays sorted");
+                assert.isTrue(descending[i - 1] < descending[i], "descending input gets sorted");
+                assert.isTrue(sawtooth[i - 1] <= sawtooth[i], "sawtooth input gets sorted");
+            }
+        }
+    },
+    {
+        name: "Throwing comparator keeps every element",
+        body: function () {
+            [20, 1000].forEach(function (length) {
+                var arr = [];
+                for (var i = 0; i < length; i++) {
+                    arr.push((i * 7919) % length);
+                }
+                var calls = 0;
+                assert.throws(function () {
+                    arr.sort(function (a, b) {
+                        if (++calls === length * 2) {
+                            throw new Error("stop");
+                        }
+                        return a - b;
+                    });
+                }, Error, "comparator exception is propagated", "stop");
+
+                var seen = arr.slice().sort(function (a, b) { return a - b; });
+                for (var i = 0; i < length; i++) {
+                    assert.areEqual(i, seen[i], "element " + i + " is still in the array");
+                }
+            });
+        }
+    },
+    {
+        name: "Inconsistent comparator keeps every element",
+        body: function () {
+            var next = pseudoRandom(3);
+            var arr = [];
+            for (var i = 0; i < 2000; i++) {
+                arr.push(i);
+            }
+            arr.sort(function () { return (next() % 3) - 1; });
+            arr.sort(function (a, b) { return a - b; });
+            for (var i = 0; i < arr.length; i++) {
+                assert.areEqual(i, arr[i], "element " + i + " is still in the array");
+            }
+        }
+    },
+    {
+        name: "Default sort compares native arrays as strings",
+        body: function () {
+            var ints = [10, 9, -1, -10, 100, 0, 2147483647, -2147483648, 1, 20];
+            ints.sort();
+            assert.areEqual("-1,-10,-2147483648,0,1,10,100,20,2147483647,9", ints.toString());
+
+            var floats = [1.5, -0.5, 10.25, 2, 0.125];
+            floats.sort();
+            assert.areEqual("-0.5,0.125,1.5,10.25,2", floats.toString());
+        }
+    },
+    {
+        name: "TypedArray sort orders elements numerically",
+        body: function () {
+            var next = pseudoRandom(5);
+            var integerCtors = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array];
+            [0, 1, 2, 63, 64, 65, 1000].forEach(function (length) {
+                var values = [];
+                for (var i = 0; i < length; i++) {
+                    values.push((next() - 0x40000000) * (next() % 2 ? 1 : 1 / 65536));
+                }
+                integerCtors.forEach(function (ctor) {
+                    checkTypedArraySort(ctor, values.map(Math.floor));
+                });
+            });
+
+            // Values that only differ in the high byte, and all equal values
+            checkTypedArraySort(Int32Array, [0x7f000000, -0x7f000000, 0x01000000, -1, 0, 1].concat(new Array(100).fill(0x10000000)));
+            checkTypedArraySort(Uint16Array, new Array(100).fill(5));
+        }
+    },
+    {
+        name: "TypedArray sort places -0 before +0 and NaN last",
+        body: function () {
+            var next = pseudoRandom(9);
+            [Float32Array, Float64Array].forEach(function (ctor) {
+                [10, 64, 500].forEach(function (length) {
+                    var values = [];
+                    for (var i = 0; i < length; i++) {
+                        switch (next() % 8) {
+                            case 0: values.push(NaN); break;
+                            case 1: values.push(-0); break;
+                            case 2: values.push(0); break;
+                            case 3: values.push(next() % 2 ? Infinity : -Infinity); break;
+                            default: values.push((next() - 0x40000000) / (next() % 1000 + 1)); break;
+                        }
+                    }
+                    checkTypedArraySort(ctor, values);
+                });
+            });
+        }
+    },
+    {
+        name: "TypedArray sort with a comparator still uses the comparator",
+        body: function () {
+            var ta = new Int32Array(100);
+            for (var i = 0; i < ta.length; i++) {
+                ta[i] = i;
+            }
+            ta.sort(function (a, b) { return b - a; });
+            for (var i = 0; i < ta.length; i++) {
+                assert.areEqual(ta.length - 1 - i, ta[i], "descending order from the comparator");
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
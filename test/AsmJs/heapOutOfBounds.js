@@ -0,0 +1,58 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+// Out-of-bounds heap accesses from JITed asm.js. With virtual buffers the bound checks are removed and
+// the accesses fault in the guard region; loads must still produce 0/NaN and stores must be dropped.
+function AsmModule(stdlib, foreign, heap) {
+    "use asm";
+    var HEAP8 = new stdlib.Int8Array(heap);
+    var HEAP32 = new stdlib.Int32Array(heap);
+    var HEAPF32 = new stdlib.Float32Array(heap);
+    var HEAPF64 = new stdlib.Float64Array(heap);
+    var fround = stdlib.Math.fround;
+
+    function loadI8(i) { i = i|0; return HEAP8[i >> 0]|0; }
+    function loadI32(i) { i = i|0; return HEAP32[i >> 2]|0; }
+    function loadF32(i) { i = i|0; return +HEAPF32[i >> 2]; }
+    function loadF64(i) { i = i|0; return +HEAPF64[i >> 3]; }
+    function storeI32(i, v) { i = i|0; v = v|0; HEAP32[i >> 2] = v; }
+    function storeF64(i, v) { i = i|0; v = +v; HEAPF64[i >> 3] = v; }
+    // The result depends on the loaded value reaching the right register
+    function sumI32(i) { i = i|0; return ((HEAP32[i >> 2]|0) + 1)|0; }
+    return { loadI8: loadI8, loadI32: loadI32, loadF32: loadF32, loadF64: loadF64,
+             storeI32: storeI32, storeF64: storeF64, sumI32: sumI32 };
+}
+
+const heapSize = 0x10000;
+const heap = new ArrayBuffer(heapSize);
+const m = AsmModule(this, {}, heap);
+let failures = 0;
+
+function expect(name, actual, expected) {
+    if (!Object.is(actual, expected)) {
+        print(`${name}: ${actual} !== ${expected}`);
+        ++failures;
+    }
+}
+
+for (let iter = 0; iter < 100; ++iter) {
+    for (const addr of [heapSize, heapSize + 8, 0x100000, 0x7FFFFFF8]) {
+        expect(`loadI8(${addr})`, m.loadI8(addr), 0);
+        expect(`loadI32(${addr})`, m.loadI32(addr), 0);
+        expect(`loadF32(${addr})`, m.loadF32(addr), NaN);
+        expect(`loadF64(${addr})`, m.loadF64(addr), NaN);
+        expect(`sumI32(${addr})`, m.sumI32(addr), 1);
+        m.storeI32(addr, 7);
+        m.storeF64(addr, 1.5);
+        expect(`loadI32(${addr}) after store`, m.loadI32(addr), 0);
+    }
+
+    m.storeI32(heapSize - 4, iter);
+    expect("loadI32(end - 4)", m.loadI32(heapSize - 4), iter);
+    expect("sumI32(end - 4)", m.sumI32(heapSize - 4), iter + 1);
+    m.storeF64(0, 0.5);
+    expect("loadF64(0)", m.loadF64(0), 0.5);
+}
+
+print(failures === 0 ? "PASSED" : "FAILED");
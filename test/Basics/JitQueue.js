@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Several script contexts queue many functions and loop bodies for the background jit at the same time.
+// Whichever order the jit queue picks them in, and whichever work items it drops when it is full, every
+// function must keep computing the same results.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var source =
+    "var fns = [];\n" +
+    "for (var i = 0; i < 40; i++) {\n" +
+    "    fns.push(new Function('a', 'b', 'return a * ' + i + ' + b;'));\n" +
+    "}\n" +
+    "function callAll(n) {\n" +
+    "    var sum = 0;\n" +
+    "    for (var j = 0; j < n; j++) {\n" +
+    "        sum = (sum + fns[j % fns.length](j, 1)) | 0;\n" +
+    "    }\n" +
+    "    return sum;\n" +
+    "}\n" +
+    "function hotLoop(n) {\n" +
+    "    var sum = 0;\n" +
+    "    for (var j = 0; j < n; j++) {\n" +
+    "        sum = (sum + (j & 7)) | 0;\n" +
+    "    }\n" +
+    "    return sum;\n" +
+    "}\n";
+
+function expectedCallAll(n) {
+    var sum = 0;
+    for (var j = 0; j < n; j++) {
+        sum = (sum + j * (j % 40) + 1) | 0;
+    }
+    return sum;
+}
+
+var tests = [
+    {
+        name: "Functions of one script context compute the same results while they are queued for the jit",
+        body: function () {
+            var context = WScript.LoadScript(source, "samethread");
+            for (var round = 0; round < 20; round++) {
+                assert.areEqual(expectedCallAll(400), context.callAll(400), "callAll in round " + round);
+            }
+            assert.areEqual(7 * 10000 / 2, context.hotLoop(10000), "hot loop body");
+        }
+    },
+    {
+        name: "Script contexts take turns in the jit queue",
+        body: function () {
+            var contexts = [];
+            for (var i = 0; i < 4; i++) {
+                contexts.push(WScript.LoadScript(source, "samethread"));
+            }
+
+            // One noisy context queues a lot of work, the others only a little
+            for (var round = 0; round < 20; round++) {
+                assert.areEqual(expectedCallAll(2000), contexts[0].callAll(2000), "noisy context in round " + round);
+                for (var i = 1; i < contexts.length; i++) {
+                    assert.areEqual(expectedCallAll(100), contexts[i].callAll(100), "context " + i + " in round " + round);
+                    assert.areEqual(7 * 1000 / 2, contexts[i].hotLoop(1000), "loop body of context " + i + " in round " + round);
+                }
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Function bodies parsed on the background threads must bind names and report errors exactly like the
+// main thread parser. Scripts are compiled with eval so that each one gets a fresh parse.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var tests = [
+    {
+        name: "Bodies parsed in the background bind to outer declarations",
+        body: function () {
+            var f = eval(
+                "var x = 1;\n" +
+                "function outer(a) {\n" +
+                "    let y = a + x;\n" +
+                "    function inner(b) { return b + y + x; }\n" +
+                "    return inner(a);\n" +
+                "}\n" +
+                "function other() { return typeof y; }\n" +
+                "[outer, other];");
+            assert.areEqual(7, f[0](3), "inner sees the block scoped y and the global x");
+            assert.areEqual("undefined", f[1](), "y does not leak out of outer");
+        }
+    },
+    {
+        name: "Regular expression literals in background parsed bodies",
+        body: function () {
+            var f = eval(
+                "function first(s) { return /a+b/.test(s); }\n" +
+                "function second(s) { return s.replace(/[0-9]+/g, '#'); }\n" +
+                "function third(s) { if (s) { return /x/.source; } else { return /y/.source; } }\n" +
+                "[first, second, third];");
+            assert.isTrue(f[0]("caab"), "first");
+            assert.areEqual("a#b#", f[1]("a12b3"), "second");
+            assert.areEqual("x", f[2](true), "third, if branch");
+            assert.areEqual("y", f[2](false), "third, else branch");
+        }
+    },
+    {
+        name: "The lexically first syntax error wins",
+        body: function () {
+            var source =
+                "function ok() { return 1; }\n" +
+                "function bad1() { var = 1; }\n" +
+                "function bad2() { return 1 +; }\n";
+            assert.throws(function () { eval(source); }, SyntaxError, "syntax error in a background parsed body", "Expected identifier");
+        }
+    },
+    {
+        name: "Many top level functions",
+        body: function () {
+            var source = "var results = [];\n";
+            for (var i = 0; i < 200; i++) {
+                source += "function f" + i + "(a) { var s = 0; for (var j = 0; j < a; j++) { s += j * " + i + "; } return s; }\n";
+                source += "results.push(f" + i + ");\n";
+            }
+            source += "results;";
+            var results = eval(source);
+            for (var i = 0; i < results.length; i++) {
+                assert.areEqual(6 * i, results[i](4), "f" + i);
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
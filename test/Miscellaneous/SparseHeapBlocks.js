@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Leave a few live objects in most heap blocks, then keep allocating. The sparse blocks are allocated from
+// last, the objects in them and the ones allocated after the collections must not be affected by the order.
+
+var failed = 0;
+function check(expected, actual, message) {
+    if (expected !== actual) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed++;
+    }
+}
+
+function make(i) {
+    switch (i % 3) {
+        case 0: return { index: i, name: "object " + i };
+        case 1: return [i, i + 1, i + 2, "array " + i];
+        default: return { index: i, a: i, b: i, c: i, d: i, e: i, f: i, g: i, h: i, name: "wide " + i };
+    }
+}
+
+function verify(o, i, message) {
+    if (i % 3 === 1) {
+        check("array " + i, o[3], message + " " + i);
+        check(i + 2, o[2], message + " " + i);
+    } else {
+        check(i, o.index, message + " " + i);
+        check((i % 3 === 0 ? "object " : "wide ") + i, o.name, message + " " + i);
+    }
+}
+
+var survivors = [];
+for (var round = 0; round < 5; round++) {
+    var all = [];
+    for (var i = 0; i < 20000; i++) {
+        all.push(make(i));
+    }
+    for (var i = 0; i < all.length; i += 97) {
+        survivors.push({ round: round, index: i, value: all[i] });
+    }
+    all = null;
+    CollectGarbage();
+
+    var fresh = [];
+    for (var i = 0; i < 5000; i++) {
+        fresh.push(make(i));
+    }
+    CollectGarbage();
+    for (var i = 0; i < fresh.length; i++) {
+        verify(fresh[i], i, "fresh object in round " + round);
+    }
+}
+
+for (var i = 0; i < survivors.length; i++) {
+    verify(survivors[i].value, survivors[i].index, "surviving object from round " + survivors[i].round);
+}
+
+if (failed === 0) {
+    WScript.Echo("PASSED");
+}
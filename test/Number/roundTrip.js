@@ -0,0 +1,102 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string and string to number conversions, which take fast paths for most inputs and fall
+// back to big number arithmetic for the rest.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var f64 = new Float64Array(1);
+var u32 = new Uint32Array(f64.buffer);
+
+// Deterministic xorshift so that failures reproduce
+var seed = 0x2545F491;
+function random32() {
+    seed ^= seed << 13;
+    seed ^= seed >>> 17;
+    seed ^= seed << 5;
+    return seed >>> 0;
+}
+
+function fromBits(hi, lo) {
+    u32[0] = lo;
+    u32[1] = hi;
+    return f64[0];
+}
+
+function checkRoundTrip(value) {
+    var str = String(value);
+    assert.areEqual(value, Number(str), "Number(String(" + str + "))");
+    assert.areEqual(value, parseFloat(value.toExponential()), "parseFloat(toExponential(" + str + "))");
+}
+
+var tests = [
+    {
+        name: "Random doubles convert back to themselves",
+        body: function () {
+            for (var i = 0; i < 20000; i++) {
+                var value = fromBits(random32() & 0x7FEFFFFF, random32());
+                checkRoundTrip(value);
+                checkRoundTrip(-value);
+            }
+        }
+    },
+    {
+        name: "Powers of two, their neighbors and denormals convert back to themselves",
+        body: function () {
+            for (var e = -1074, value = Number.MIN_VALUE; e <= 1023; e++, value *= 2) {
+                checkRoundTrip(value);
+                checkRoundTrip(value * (1 + Number.EPSILON));
+                checkRoundTrip(value * (1 - Number.EPSILON / 2));
+            }
+            for (var lo = 1; lo < 1000; lo++) {
+                checkRoundTrip(fromBits(0, lo));
+                checkRoundTrip(fromBits(0x000FFFFF, -lo >>> 0));
+            }
+            checkRoundTrip(Number.MAX_VALUE);
+            checkRoundTrip(Number.MIN_VALUE);
+        }
+    },
+    {
+        name: "Short decimals print as written",
+        body: function () {
+            var strings = ["0.1", "0.2", "0.3", "1.5", "123.456", "0.000001", "1e-7", "1.7976931348623157e+308", "5e-324",
+                "9007199254740991", "9007199254740992", "1e+21", "123456789012345680000", "0.30000000000000004",
+                "2.225073858507201e-308", "2.2250738585072014e-308"];
+            strings.forEach(function (str) {
+                assert.areEqual(str, String(Number(str)), str);
+            });
+        }
+    },
+    {
+        name: "Shortest digits are chosen the same way as before",
+        body: function () {
+            // Cases with several shortest representations, printed by previous versions
+            var strings = ["1.5015690094440362e-154", "-3.0704207905417145e-12", "-0.0032968392200837825", "1.0355620143196495",
+                "2.7430620343968444e+303", "-1.1e-7", "0.00020162660390750982", "1.7859173700038011e+308"];
+            strings.forEach(function (str) {
+                assert.areEqual(str, String(Number(str)), str);
+            });
+        }
+    },
+    {
+        name: "Strings round to the nearest double",
+        body: function () {
+            assert.areEqual(0, Number("2.4703282292062327e-324"), "Below half of the smallest denormal");
+            assert.areEqual(Number.MIN_VALUE, Number("2.4703282292062328e-324"), "Above half of the smallest denormal");
+            assert.areEqual(9007199254740992, Number("9007199254740993"), "Halfway, rounds to even");
+            assert.areEqual(9007199254740996, Number("9007199254740995"), "Halfway, rounds to even");
+            assert.areEqual(Number.MAX_VALUE, Number("1.7976931348623158e308"), "Below half an ulp past the largest double");
+            assert.areEqual(Infinity, Number("1.7976931348623159e308"), "Past half an ulp past the largest double");
+            assert.areEqual(fromBits(0x7FE00000, 0), Number("8.98846567431158e307"), "Power of two");
+            assert.areEqual(fromBits(0x000FFFFF, 0xFFFFFFFF), Number("2.2250738585072011e-308"), "Largest denormal");
+            assert.areEqual(1e23, Number("100000000000000000000000"), "1e23");
+            assert.areEqual(123456789012345680, Number("123456789012345678"), "18 digits");
+            assert.areEqual(-0.1, Number("-0.1000000000000000000"), "Trailing zeros past 19 digits");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Object literals whose objects survive collections are allocated by the jit in the card-tracked heap blocks.
+// Objects from those sites must keep their properties, and the objects stored into them later on must stay alive.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeRoute(i) {
+    return { path: "/route/" + i, handler: i, hits: 0, next: null };
+}
+
+function makeWideRoute(i) {
+    return {
+        p0: i, p1: i + 1, p2: i + 2, p3: i + 3, p4: i + 4, p5: i + 5, p6: i + 6, p7: i + 7, p8: i + 8, p9: i + 9,
+        p10: i + 10, p11: i + 11, p12: i + 12, p13: i + 13, p14: i + 14, p15: i + 15, p16: i + 16, p17: i + 17,
+        p18: i + 18, p19: i + 19, p20: i + 20, p21: i + 21, p22: i + 22, p23: i + 23, p24: i + 24, p25: i + 25
+    };
+}
+
+function makeTemporary(i) {
+    var t = { value: i, twice: i * 2 };
+    return t.value + t.twice;
+}
+
+function verifyRoutes(routes, hits, message) {
+    for (var i = 0; i < routes.length; i++) {
+        var route = routes[i];
+        assert.areEqual("/route/" + i, route.path, message + ": path of route " + i);
+        assert.areEqual(i, route.handler, message + ": handler of route " + i);
+        assert.areEqual(hits, route.hits, message + ": hits of route " + i);
+        if (i > 0) {
+            assert.areEqual(routes[i - 1], route.next.previous, message + ": link of route " + i);
+            assert.areEqual("link " + i, route.next.name, message + ": link name of route " + i);
+        }
+    }
+}
+
+var tests = [
+    {
+        name: "Long lived object literals keep their properties across collections",
+        body: function () {
+            var routes = [];
+            for (var round = 0; round < 10; round++) {
+                for (var i = 0; i < 500; i++) {
+                    routes.push(makeRoute(routes.length));
+                }
+                CollectGarbage();
+            }
+
+            // Store freshly allocated objects into the old ones, then collect
+            for (var i = 1; i < routes.length; i++) {
+                routes[i].next = { previous: routes[i - 1], name: "link " + i };
+                routes[i].hits++;
+            }
+            CollectGarbage();
+            verifyRoutes(routes, 1, "after the first collection");
+
+            for (var i = 0; i < routes.length; i++) {
+                routes[i].hits++;
+            }
+            CollectGarbage();
+            verifyRoutes(routes, 2, "after the second collection");
+        }
+    },
+    {
+        name: "Long lived object literals with auxiliary slots",
+        body: function () {
+            var routes = [];
+            for (var round = 0; round < 10; round++) {
+                for (var i = 0; i < 200; i++) {
+                    routes.push(makeWideRoute(routes.length));
+                }
+                CollectGarbage();
+            }
+            for (var i = 0; i < routes.length; i++) {
+                routes[i].p25 = { index: i };
+            }
+            CollectGarbage();
+            for (var i = 0; i < routes.length; i++) {
+                assert.areEqual(i, routes[i].p0, "first property of route " + i);
+                assert.areEqual(i + 24, routes[i].p24, "last number property of route " + i);
+                assert.areEqual(i, routes[i].p25.index, "stored object of route " + i);
+            }
+        }
+    },
+    {
+        name: "Short lived object literals",
+        body: function () {
+            for (var round = 0; round < 10; round++) {
+                var sum = 0;
+                for (var i = 0; i < 1000; i++) {
+                    sum += makeTemporary(i);
+                }
+                assert.areEqual(3 * 999 * 1000 / 2, sum, "sum in round " + round);
+                CollectGarbage();
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
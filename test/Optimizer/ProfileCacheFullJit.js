@@ -0,0 +1,22 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Runs hot until it is full jitted, from a script whose profile goes to the cache given with -ProfileCache. The tests
+// run this three times in a row:
+// - record fills the cache
+// - reuse loads the cached profile, which says hot was full jitted, so hot full JITs on its first call
+// - mismatch loads a different hot from the same url, its cached profile is rejected and hot goes through the tiers
+
+var mode = WScript.Arguments[0];
+var hot = mode === "mismatch" ?
+    "function hot(a, b) { return a + Math.abs(b); }" :
+    "function hot(a, b) { return a + b; }";
+var source =
+    hot + "\n" +
+    "var sum = 0;\n" +
+    "for (var i = 0; i < 100; i++) { sum = hot(sum, i); }\n" +
+    "WScript.Echo(sum);\n";
+
+WScript.LoadScript(source, "self", "ProfileCacheFullJitScript.js");
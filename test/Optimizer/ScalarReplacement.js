@@ -0,0 +1,77 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Object literals that don't escape are replaced by their property values in the jit. The results must not
+// change whether or not the literal is replaced, escapes on some paths, or is live across a bailout.
+
+var failed = 0;
+function check(expected, actual, message) {
+    if (expected !== actual) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed++;
+    }
+}
+
+function destructure(a, b) {
+    var { x, y } = { x: a, y: b };
+    return x * 10 + y;
+}
+
+function makePair(a, b) {
+    return { first: a, second: b };
+}
+function sumPair(a, b) {
+    var pair = makePair(a, b);
+    return pair.first + pair.second;
+}
+
+function update(a) {
+    var o = { count: a, step: 2 };
+    o.count = o.count + o.step;
+    o.count = o.count * o.step;
+    return o.count;
+}
+
+var escaped;
+function maybeEscape(a, leak) {
+    var o = { value: a };
+    if (leak) {
+        escaped = o;
+    }
+    return o.value;
+}
+
+function overflow(a) {
+    // The add overflows int32 on the last iterations and bails out while the literal is live
+    var o = { big: a, small: 1 };
+    var sum = o.big + o.big;
+    return sum + o.small;
+}
+
+function fromPrototype(a) {
+    var o = { own: a };
+    return o.own + (o.toString === Object.prototype.toString ? 1 : 0);
+}
+
+function literalOfLiterals(a) {
+    var outer = { inner: { v: a }, w: a + 1 };
+    return outer.inner.v + outer.w;
+}
+
+for (var i = 0; i < 200; i++) {
+    check(i * 10 + 3, destructure(i, 3), "destructure " + i);
+    check(i + i + 1, sumPair(i, i + 1), "sumPair " + i);
+    check((i + 2) * 2, update(i), "update " + i);
+    check(i, maybeEscape(i, i % 50 === 49), "maybeEscape " + i);
+    var big = i < 190 ? i : 0x3fffffff + i;
+    check(big + big + 1, overflow(big), "overflow " + i);
+    check(i + 1, fromPrototype(i), "fromPrototype " + i);
+    check(i + i + 1, literalOfLiterals(i), "literalOfLiterals " + i);
+}
+check(199, escaped.value, "escaped literal");
+
+if (failed === 0) {
+    WScript.Echo("PASSED");
+}
@@ -0,0 +1,35 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Traces which object literals the jit replaces by their property values, and why the others are kept.
+// Run with -bailout:21 to inject a bailout into canBailOut.
+
+function replaced(a, b) {
+    var o = { first: a, second: b };
+    return o.second;
+}
+
+function escapes(a) {
+    var o = { value: a };
+    return o;
+}
+
+function canBailOut(a) {
+    var o = { value: a };
+    var b = a;
+    return o.value + b;
+}
+
+var results = [];
+for (var i = 0; i < 3; i++) {
+    results.push(replaced(i, i + 1));
+}
+for (var i = 0; i < 3; i++) {
+    results.push(escapes(i).value);
+}
+for (var i = 0; i < 3; i++) {
+    results.push(canBailOut(i));
+}
+WScript.Echo(results.join(","));
@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse stores long Latin-1 string values with one byte per character. Those strings must behave
+// exactly like the ones stored with two bytes per character, before and after they get widened.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function parse(str) {
+    return JSON.parse(JSON.stringify(str));
+}
+
+var ascii = "The quick brown fox jumps over the lazy dog";
+var latin1 = "Français, naïve, über, ÿ and \u0080 characters";
+var wide = "Wide Ā  characters and 😀 surrogates";
+
+var tests = [
+    {
+        name: "Parsed strings have the same contents as their source",
+        body: function () {
+            [ascii, latin1, wide, "", "a", "short", ascii + latin1 + wide].forEach(function (source) {
+                var str = parse(source);
+                assert.areEqual(source.length, str.length, "length");
+                for (var i = 0; i < source.length; i++) {
+                    assert.areEqual(source.charCodeAt(i), str.charCodeAt(i), "charCodeAt(" + i + ")");
+                    assert.areEqual(source.charAt(i), str.charAt(i), "charAt(" + i + ")");
+                    assert.areEqual(source[i], str[i], "[" + i + "]");
+                }
+                assert.isTrue(isNaN(str.charCodeAt(source.length)), "charCodeAt past the end");
+                assert.areEqual("", str.charAt(source.length), "charAt past the end");
+                assert.areEqual(source, str, "equality");
+            });
+        }
+    },
+    {
+        name: "Escaped characters decide the width of the parsed string",
+        body: function () {
+            var str = JSON.parse('"escaped Latin-1 \\u00e9\\u00ff and \\n\\t\\"\\\\ characters"');
+            assert.areEqual("escaped Latin-1 éÿ and \n\t\"\\ characters", str);
+            str = JSON.parse('"escaped wide \\u0100 character at the end of the string"');
+            assert.areEqual(0x100, str.charCodeAt(13));
+            assert.areEqual("escaped wide Ā character at the end of the string", str);
+        }
+    },
+    {
+        name: "indexOf and includes find the same positions",
+        body: function () {
+            var str = parse(latin1);
+            var searches = ["F", "s", "ÿ", "ÿ and", "characters", latin1, latin1 + "!", "Ā", "naïve", "ve, ", "x", ""];
+            searches.forEach(function (search) {
+                for (var position = 0; position <= latin1.length + 1; position++) {
+                    assert.areEqual(latin1.indexOf(search, position), str.indexOf(search, position), "indexOf(" + search + ", " + position + ")");
+                    assert.areEqual(latin1.includes(search, position), str.includes(search, position), "includes(" + search + ", " + position + ")");
+                }
+                assert.areEqual(latin1.indexOf(search), str.indexOf(parse(search)), "one byte search string " + search);
+            });
+        }
+    },
+    {
+        name: "Comparisons between widths",
+        body: function () {
+            var oneByte = parse(ascii);
+            var other = parse(ascii);
+            assert.isTrue(oneByte === other, "one byte === one byte");
+            assert.isTrue(oneByte == ascii, "one byte == two bytes");
+            assert.isTrue(ascii === oneByte, "two bytes === one byte");
+            assert.isFalse(oneByte === parse(ascii.replace("z", "Z")), "different characters");
+            assert.isFalse(oneByte === ascii + " ", "different length");
+            assert.isFalse(parse(latin1.replace("ÿ", "y")) === latin1, "difference in the Latin-1 range");
+
+            var map = new Map();
+            map.set(oneByte, 1);
+            assert.areEqual(1, map.get(ascii), "Map key");
+            var obj = {};
+            obj[oneByte] = 2;
+            assert.areEqual(2, obj[ascii], "property name");
+        }
+    },
+    {
+        name: "Concatenation and other builtins widen the string",
+        body: function () {
+            var str = parse(latin1);
+            var concat = "<" + str + ">" + parse(wide);
+            assert.areEqual("<" + latin1 + ">" + wide, concat, "concat");
+            assert.areEqual(latin1.toUpperCase(), str.toUpperCase(), "toUpperCase");
+            assert.areEqual(latin1.split(", ").join("|"), str.split(", ").join("|"), "split");
+            assert.areEqual(latin1.substring(5, 20), str.substring(5, 20), "substring");
+            assert.areEqual(latin1.replace(/a/g, "A"), str.replace(/a/g, "A"), "replace");
+            assert.areEqual(JSON.stringify(latin1), JSON.stringify(str), "stringify");
+
+            // The string keeps working once it has been widened
+            assert.areEqual(latin1.indexOf("ÿ"), str.indexOf("ÿ"), "indexOf after widening");
+            assert.areEqual(latin1, str, "equality after widening");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,116 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Patterns that are matched often enough get promoted to the hot tier, which filters start positions using the pattern's
+// FIRST set. Results must be identical before and after promotion.
+//
+// Run with "-args bench -endargs" to print the time taken by each pattern instead of checking results.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var logLine = '127.0.0.1 - frank [10/Oct/2000:13:55:36 -0700] "GET /apache_pb.gif?user=frank&id=42 HTTP/1.0" 200 2326 ' +
+    '"http://www.example.com/start.html" "Mozilla/4.08 [en] (Win98; I ;Nav)"';
+var mixed = "  \t\t\n---,,,;;;  joe.bloggs+tag@mail.example.org ;;; " + "0x1F, 0777, 42e3 ;; " + "{\"key\": \"value\\\"s\"}" +
+    " \u00e9l\u00e8ve \u4e2d\u6587 ";
+var inputs = [
+    "",
+    logLine,
+    mixed,
+    logLine + "\n" + mixed + "\n" + logLine,
+    new Array(200).join(" ,;") + "needle=1",
+];
+
+var patterns = [
+    /\S+@\S+/,
+    /\S+@\S+/g,
+    /[^\s,;]+/g,
+    /[^"]+"/g,
+    /"(?:[^"\\]|\\.)*"/g,
+    /\[([^\]]+)\]/,
+    /(\S+) (\S+) (\S+) \[([^\]]+)\] "(\S+) (\S+) (\S+)" (\d+) (\d+)/,
+    /[^ \t]+=\d+/g,
+    /\w+[.:]\w+/g,
+    /[^\x00-\x7f]+/g,
+    /[^,;\s]+[;,]/g,
+    /\S+\s*$/,
+    /[^\n]+\n/gm,
+];
+
+function matchAll(re, input) {
+    re.lastIndex = 0;
+    if (!re.global) {
+        var m = re.exec(input);
+        return m === null ? "null" : m.index + ":" + m.join("|");
+    }
+
+    var results = [];
+    var m;
+    while ((m = re.exec(input)) !== null) {
+        results.push(m.index + ":" + m[0]);
+        if (m[0].length === 0) {
+            re.lastIndex++;
+        }
+    }
+    return results.join(",");
+}
+
+function coldResults(re) {
+    // Use a fresh copy so that the results are produced before any promotion
+    var copy = new RegExp(re.source, (re.global ? "g" : "") + (re.ignoreCase ? "i" : "") + (re.multiline ? "m" : ""));
+    return inputs.map(function (input) { return matchAll(copy, input); });
+}
+
+if (WScript.Arguments[0] === "bench") {
+    patterns.forEach(function (re) {
+        var start = Date.now();
+        for (var i = 0; i < 20000; i++) {
+            matchAll(re, inputs[i % inputs.length]);
+        }
+        print(re + ": " + (Date.now() - start) + "ms");
+    });
+} else {
+    var tests = [
+        {
+            name: "Promoted patterns produce the same matches as cold patterns",
+            body: function () {
+                patterns.forEach(function (re) {
+                    var expected = coldResults(re);
+                    for (var i = 0; i < 200; i++) {
+                        for (var j = 0; j < inputs.length; j++) {
+                            assert.areEqual(expected[j], matchAll(re, inputs[j]), re + " on input " + j + " at iteration " + i);
+                        }
+                    }
+                });
+            }
+        },
+        {
+            name: "Promoted patterns fail correctly at the end of the input",
+            body: function () {
+                var re = /[^,]+,/;
+                for (var i = 0; i < 200; i++) {
+                    assert.areEqual(null, re.exec(",,,,"), "Only filtered-out characters");
+                    assert.areEqual(null, re.exec("abc"), "No terminating comma");
+                    assert.areEqual("abc,", re.exec(",,abc,")[0], "Match after skipped characters");
+                }
+                assert.isFalse(re.test(",,,,,,,,,,"), "test() after promotion");
+                assert.areEqual(-1, ",,,,".search(re), "search() after promotion");
+            }
+        },
+        {
+            name: "Promoted global patterns honor lastIndex",
+            body: function () {
+                var re = /[^,]+/g;
+                for (var i = 0; i < 200; i++) {
+                    re.lastIndex = 3;
+                    var m = re.exec("ab,,cd,ef");
+                    assert.areEqual("cd", m[0], "Global match starting past a separator");
+                    assert.areEqual(6, re.lastIndex, "lastIndex after global match");
+                }
+            }
+        },
+    ];
+
+    testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
+}
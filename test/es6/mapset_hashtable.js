@@ -0,0 +1,247 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Map and Set stress tests -- growing, shrinking and clearing the table while iterating it,
+// and key equality for every kind of key in hot loops
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function pseudoRandom(seed) {
+    return function () {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed;
+    };
+}
+
+// Reference model following the spec: an entry list where deleted entries stay as holes
+function ModelMap() {
+    this.keys = [];
+    this.values = [];
+    this.live = [];
+}
+ModelMap.prototype.find = function (key) {
+    for (var i = 0; i < this.keys.length; i++) {
+        if (this.live[i] && (this.keys[i] === key || (this.keys[i] !== this.keys[i] && key !== key))) {
+            return i;
+        }
+    }
+    return -1;
+};
+ModelMap.prototype.set = function (key, value) {
+    var i = this.find(key);
+    if (i === -1) {
+        this.keys.push(key);
+        this.values.push(value);
+        this.live.push(true);
+    } else {
+        this.values[i] = value;
+    }
+};
+ModelMap.prototype.delete = function (key) {
+    var i = this.find(key);
+    if (i !== -1) {
+        this.live[i] = false;
+    }
+    return i !== -1;
+};
+ModelMap.prototype.clear = function () {
+    for (var i = 0; i < this.live.length; i++) {
+        this.live[i] = false;
+    }
+};
+ModelMap.prototype.size = function () {
+    return this.live.filter(function (l) { return l; }).length;
+};
+
+function mapHas(map, key) { return map.has(key); }
+function mapGet(map, key) { return map.get(key); }
+function mapSet(map, key, value) { map.set(key, value); }
+function setAdd(set, value) { set.add(value); }
+function setHas(set, value) { return set.has(value); }
+
+var tests = [
+    {
+        name: "Small integer keys that only differ in the high bits of their hash",
+        body: function () {
+            var map = new Map();
+            var set = new Set();
+            for (var i = 0; i < 20000; i++) {
+                mapSet(map, i * 1024, i);
+                setAdd(set, i * 1024);
+            }
+            assert.areEqual(20000, map.size, "all keys are distinct");
+            assert.areEqual(20000, set.size, "all values are distinct");
+            for (var i = 0; i < 20000; i++) {
+                assert.areEqual(i, mapGet(map, i * 1024), "map.get(" + i * 1024 + ")");
+                assert.isTrue(setHas(set, i * 1024), "set.has(" + i * 1024 + ")");
+                assert.isFalse(mapHas(map, i * 1024 + 1), "map.has(" + (i * 1024 + 1) + ")");
+            }
+        }
+    },
+    {
+        name: "Keys use SameValueZero in hot loops",
+        body: function () {
+            var map = new Map();
+            var obj = {};
+            var sym = Symbol();
+            for (var i = 0; i < 100; i++) {
+                mapSet(map, -0, "zero");
+                mapSet(map, NaN, "nan");
+                mapSet(map, 1.5, "double");
+                mapSet(map, "1.5", "string");
+                mapSet(map, obj, "object");
+                mapSet(map, sym, "symbol");
+                mapSet(map, 2147483648, "large");
+            }
+            assert.areEqual(7, map.size, "one entry for each key");
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual("zero", mapGet(map, 0), "+0 finds -0");
+                assert.areEqual("nan", mapGet(map, 0 / 0), "NaN finds NaN");
+                assert.areEqual("double", mapGet(map, 3 / 2), "double key");
+                assert.areEqual("string", mapGet(map, "1." + "5"), "string key compares by value");
+                assert.areEqual("object", mapGet(map, obj), "object key");
+                assert.areEqual("symbol", mapGet(map, sym), "symbol key");
+                assert.areEqual("large", mapGet(map, 2147483647 + 1), "large integer key");
+                assert.isFalse(mapHas(map, {}), "other objects are not keys");
+            }
+            assert.isTrue(Object.is(map.keys().next().value, 0), "-0 key is normalized to +0");
+
+            var set = new Set();
+            for (var i = 0; i < 100; i++) {
+                setAdd(set, NaN);
+                setAdd(set, -0);
+                setAdd(set, 0);
+            }
+            assert.areEqual(2, set.size, "NaN and 0");
+        }
+    },
+    {
+        name: "Iterators see the changes made while iterating",
+        body: function () {
+            var map = new Map();
+            for (var i = 0; i < 10; i++) {
+                map.set(i, i);
+            }
+
+            // Delete everything already visited, and add an entry for each one, forcing rehashes
+            var visited = [];
+            for (var entry of map) {
+                visited.push(entry[0]);
+                map.delete(entry[0]);
+                if (entry[0] < 100) {
+                    map.set(entry[0] + 100, 0);
+                }
+            }
+            assert.areEqual(20, visited.length, "the added entries are visited too");
+            for (var i = 0; i < 10; i++) {
+                assert.areEqual(i, visited[i], "original entries in order");
+                assert.areEqual(i + 100, visited[i + 10], "added entries in order");
+            }
+            assert.areEqual(0, map.size, "everything was deleted");
+
+            // Clear while iterating, then add entries
+            var set = new Set([1, 2, 3, 4, 5]);
+            var values = [];
+            set.forEach(function (value) {
+                values.push(value);
+                if (value === 2) {
+                    set.clear();
+                    set.add(10);
+                    set.add(11);
+                }
+            });
+            assert.areEqual("1,2,10,11", values.join(","), "entries added after a clear are visited");
+
+            // A finished iterator stays finished
+            var iterator = set.values();
+            while (!iterator.next().done) {
+            }
+            set.add(12);
+            assert.isTrue(iterator.next().done, "finished iterator does not resume");
+        }
+    },
+    {
+        name: "Interleaved iterators and random operations match the spec model",
+        body: function () {
+            var next = pseudoRandom(17);
+            var map = new Map();
+            var model = new ModelMap();
+            var iterators = [];
+
+            for (var step = 0; step < 5000; step++) {
+                var key = next() % 64;
+                var op = next() % 16;
+                if (op < 7) {
+                    map.set(key, step);
+                    model.set(key, step);
+                } else if (op < 13) {
+                    assert.areEqual(model.delete(key), map.delete(key), "delete(" + key + ") at step " + step);
+                } else if (op < 14) {
+                    if (next() % 8 === 0) {
+                        map.clear();
+                        model.clear();
+                    } else {
+                        iterators.push({ iterator: map.entries(), position: 0 });
+                    }
+                } else {
+                    // Advance an iterator and compare with the model
+                    if (iterators.length !== 0) {
+                        var it = iterators[next() % iterators.length];
+                        while (it.position < model.keys.length && !model.live[it.position]) {
+                            it.position++;
+                        }
+                        var result = it.iterator.next();
+                        if (it.position < model.keys.length) {
+                            assert.isFalse(result.done, "iterator is not done at step " + step);
+                            assert.areEqual(model.keys[it.position], result.value[0], "iterator key at step " + step);
+                            assert.areEqual(model.values[it.position], result.value[1], "iterator value at step " + step);
+                            it.position++;
+                        } else {
+                            assert.isTrue(result.done, "iterator is done at step " + step);
+                            iterators.splice(iterators.indexOf(it), 1);
+                        }
+                    }
+                }
+                assert.areEqual(model.size(), map.size, "size at step " + step);
+            }
+        }
+    },
+    {
+        name: "Table shrinks back after most entries are deleted",
+        body: function () {
+            var set = new Set();
+            for (var round = 0; round < 5; round++) {
+                for (var i = 0; i < 10000; i++) {
+                    setAdd(set, round * 10000 + i);
+                }
+                for (var i = 0; i < 9990; i++) {
+                    set.delete(round * 10000 + i);
+                }
+            }
+            assert.areEqual(50, set.size, "10 entries are left from each round");
+            var values = [];
+            set.forEach(function (value) { values.push(value); });
+            for (var round = 0; round < 5; round++) {
+                for (var i = 0; i < 10; i++) {
+                    assert.areEqual(round * 10000 + 9990 + i, values[round * 10 + i], "insertion order is kept");
+                }
+            }
+        }
+    },
+    {
+        name: "Inlined calls still check the receiver",
+        body: function () {
+            var map = new Map([[1, 2]]);
+            for (var i = 0; i < 50; i++) {
+                assert.areEqual(2, mapGet(map, 1), "map.get");
+            }
+            assert.throws(function () { mapGet({ get: Map.prototype.get }, 1); }, TypeError, "get on a non-Map");
+            assert.throws(function () { setAdd({ add: Set.prototype.add }, 1); }, TypeError, "add on a non-Set");
+            assert.areEqual("other", mapGet({ get: function () { return "other"; } }, 1), "other get functions are called");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,82 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Agents wait and are woken on their own index of a shared buffer, then all of them on one common index.
+// Pass a round count to use it as a benchmark, e.g. -args 10000 -endargs, and the elapsed time is reported.
+
+const agentCount = 8;
+const rounds = WScript.Arguments.length > 0 ? parseInt(WScript.Arguments[0]) : 200;
+const benchmark = WScript.Arguments.length > 0;
+
+// ia[0] counts the waits the agents are about to do, ia[1 + i] is the index of agent i, ia[agentCount + 1] is shared
+const sharedIndex = agentCount + 1;
+
+for (let i = 0; i < agentCount; i++) {
+    WScript.LoadScript(`
+        WScript.ReceiveBroadcast(function (sab) {
+            const ia = new Int32Array(sab);
+            let timedOut = 0;
+            for (let round = 0; round < ${rounds}; round++) {
+                Atomics.add(ia, 0, 1);
+                if (Atomics.wait(ia, ${i + 1}, round, 10000) === "timed-out") {
+                    timedOut++;
+                }
+            }
+            Atomics.add(ia, 0, 1);
+            if (Atomics.wait(ia, ${sharedIndex}, 0, 10000) === "timed-out") {
+                timedOut++;
+            }
+            WScript.Report("agent ${i} timed out " + timedOut);
+            WScript.Leaving();
+        });
+    `, 'crossthread');
+}
+
+const ia = new Int32Array(new SharedArrayBuffer(Int32Array.BYTES_PER_ELEMENT * (agentCount + 2)));
+WScript.Broadcast(ia.buffer);
+
+function waitForAgents(count) {
+    while (Atomics.load(ia, 0) < count) {
+    }
+}
+
+const start = Date.now();
+for (let round = 0; round < rounds; round++) {
+    waitForAgents(agentCount * (round + 1));
+    for (let i = 0; i < agentCount; i++) {
+        // An agent that has not started waiting yet sees the new value and returns "not-equal"
+        Atomics.store(ia, i + 1, round + 1);
+        Atomics.wake(ia, i + 1);
+    }
+}
+
+waitForAgents(agentCount * (rounds + 1));
+Atomics.store(ia, sharedIndex, 1);
+let woken = Atomics.wake(ia, sharedIndex);
+const elapsed = Date.now() - start;
+
+let failed = 0;
+if (woken > agentCount) {
+    print("FAILED: woke " + woken + " agents on the shared index");
+    failed++;
+}
+
+for (let reports = 0; reports < agentCount; reports++) {
+    let report;
+    while ((report = WScript.GetReport()) === null) {
+        WScript.Sleep(10);
+    }
+    if (!/timed out 0$/.test(report)) {
+        print("FAILED: " + report);
+        failed++;
+    }
+}
+
+if (benchmark) {
+    print(`${agentCount} agents, ${rounds} rounds: ${elapsed}ms, ${Math.round(agentCount * rounds / Math.max(elapsed, 1))} wakes/ms`);
+}
+if (failed === 0) {
+    print("PASSED");
+}
@@ -0,0 +1,147 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <unistd.h>
+
+extern "C" int PAL_InitializeChakraCore();
+
+extern "C" void *
+VirtualAlloc(
+       void *lpAddress,
+       size_t dwSize,
+       unsigned int flAllocationType,
+       unsigned int flProtect);
+
+extern "C" int
+VirtualFree(
+       void *lpAddress,
+       size_t dwSize,
+       unsigned int dwFreeType);
+
+extern "C" unsigned int
+GetWriteWatch(
+       unsigned int dwFlags,
+       void *lpBaseAddress,
+       size_t dwRegionSize,
+       void **lpAddresses,
+       uintptr_t *lpdwCount,
+       unsigned int *lpdwGranularity);
+
+extern "C" unsigned int
+ResetWriteWatch(
+       void *lpBaseAddress,
+       size_t dwRegionSize);
+
+#define PAGE_READWRITE          0x04
+#define MEM_COMMIT              0x1000
+#define MEM_RESERVE             0x2000
+#define MEM_DECOMMIT            0x4000
+#define MEM_RELEASE             0x8000
+#define MEM_WRITE_WATCH         0x200000
+#define WRITE_WATCH_FLAG_RESET  0x01
+
+#define PAGE_COUNT 16
+
+static size_t pageSize;
+static char *region;
+static void *addresses[PAGE_COUNT];
+
+#define CHECK(cond, testName)                           \
+    do                                                  \
+    {                                                   \
+        if (!(cond))                                    \
+        {                                               \
+            printf("Test Failed: %s (%s)\n",            \
+                testName, #cond);                       \
+            return 1;                                   \
+        }                                               \
+    } while(0)
+
+// Returns the number of written pages reported, or -1 if GetWriteWatch failed
+static int getWritten(unsigned int flags, uintptr_t maxCount = PAGE_COUNT)
+{
+    uintptr_t count = maxCount;
+    unsigned int granularity = 0;
+    if (GetWriteWatch(flags, region, PAGE_COUNT * pageSize, addresses, &count, &granularity) != 0 ||
+        granularity != pageSize)
+    {
+        return -1;
+    }
+    return (int)count;
+}
+
+static bool isReported(int count, size_t page)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (addresses[i] == region + page * pageSize)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main()
+{
+    CHECK(PAL_InitializeChakraCore() == 0, "init");
+    pageSize = (size_t)sysconf(_SC_PAGESIZE);
+
+    region = (char *)VirtualAlloc(nullptr, PAGE_COUNT * pageSize,
+        MEM_RESERVE | MEM_COMMIT | MEM_WRITE_WATCH, PAGE_READWRITE);
+    if (region == nullptr)
+    {
+        // Built without ENABLE_WRITE_WATCH, or the kernel doesn't support it
+        printf("SUCCESS");
+        return 0;
+    }
+
+    CHECK(ResetWriteWatch(region, PAGE_COUNT * pageSize) == 0, "reset");
+    CHECK(getWritten(0) == 0, "nothing written after reset");
+
+    region[1 * pageSize] = 1;
+    region[5 * pageSize + 7] = 1;
+    int count = getWritten(0);
+    CHECK(count == 2 && isReported(count, 1) && isReported(count, 5), "written pages");
+
+    // The reset flag reports the same pages and then clears them
+    count = getWritten(WRITE_WATCH_FLAG_RESET);
+    CHECK(count == 2 && isReported(count, 1) && isReported(count, 5), "written pages again");
+    CHECK(getWritten(0) == 0, "nothing written after get and reset");
+
+    // The count is capped by the caller's buffer
+    region[2 * pageSize] = 1;
+    region[3 * pageSize] = 1;
+    region[4 * pageSize] = 1;
+    CHECK(getWritten(WRITE_WATCH_FLAG_RESET, 2) == 2, "capped count");
+    count = getWritten(0);
+    CHECK(count == 1 && isReported(count, 4), "pages beyond the cap stay written");
+
+    // Recommitted pages are registered again, so writes to them are still seen
+    CHECK(ResetWriteWatch(region, PAGE_COUNT * pageSize) == 0, "reset before recommit");
+    CHECK(VirtualFree(region + 7 * pageSize, pageSize, MEM_DECOMMIT), "decommit");
+    CHECK(VirtualAlloc(region + 7 * pageSize, pageSize, MEM_COMMIT, PAGE_READWRITE) != nullptr, "recommit");
+    CHECK(ResetWriteWatch(region, PAGE_COUNT * pageSize) == 0, "reset after recommit");
+    region[7 * pageSize] = 1;
+    count = getWritten(0);
+    CHECK(count == 1 && isReported(count, 7), "written recommitted page");
+
+    // Ranges that weren't reserved with MEM_WRITE_WATCH are rejected
+    char *unwatched = (char *)VirtualAlloc(nullptr, pageSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    CHECK(unwatched != nullptr, "unwatched alloc");
+    uintptr_t unwatchedCount = 1;
+    unsigned int granularity;
+    CHECK(GetWriteWatch(0, unwatched, pageSize, addresses, &unwatchedCount, &granularity) != 0, "unwatched get");
+    CHECK(ResetWriteWatch(unwatched, pageSize) != 0, "unwatched reset");
+
+    VirtualFree(unwatched, 0, MEM_RELEASE);
+    VirtualFree(region, 0, MEM_RELEASE);
+
+    printf("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// WebAssembly.compile and WebAssembly.instantiate decode the module in a promise job.
+// The bytes are copied when the call is made, so changing the buffer afterward must not change the module.
+
+function createAddTwo() {
+  // (func (export "addTwo") (param i32 i32) (result i32) (i32.add (get_local 0) (get_local 1)))
+  const bytes = "\x00\x61\x73\x6d\x01\x00\x00\x00\x01\x07\x01\x60\x02\x7f\x7f\x01\x7f\x03\x02\x01\x00\x07\x0a\x01\x06\x61\x64\x64\x54\x77\x6f\x00\x00\x0a\x09\x01\x07\x00\x20\x00\x20\x01\x6a\x0b";
+  const view = new Uint8Array(bytes.length);
+  for (let i = 0; i < bytes.length; ++i) {
+    view[i] = bytes.charCodeAt(i);
+  }
+  return view;
+}
+const addOpcodeIndex = createAddTwo().lastIndexOf(0x6a);
+const subOpcode = 0x6b;
+
+let failed = 0;
+function check(expected, actual, message) {
+  if (expected !== actual) {
+    console.log(`FAILED: ${message}: expected ${expected}, got ${actual}`);
+    failed++;
+  }
+}
+
+const order = [];
+const tests = [];
+
+// The copied bytes must stay internal, not be resolved through a then property
+let leakedBuffer = null;
+Object.defineProperty(ArrayBuffer.prototype, "then", {
+  get() {
+    leakedBuffer = this;
+    return undefined;
+  },
+  configurable: true
+});
+
+{
+  const view = createAddTwo();
+  tests.push(WebAssembly.compile(view).then(module => {
+    order.push("compile");
+    const {exports: {addTwo}} = new WebAssembly.Instance(module);
+    check(5, addTwo(2, 3), "compile must use the bytes at the time of the call");
+  }));
+  view[addOpcodeIndex] = subOpcode;
+}
+
+{
+  const view = createAddTwo();
+  tests.push(WebAssembly.instantiate(view.buffer, {}).then(({module, instance}) => {
+    order.push("instantiate");
+    check(true, module instanceof WebAssembly.Module, "instantiate result module");
+    check(7, instance.exports.addTwo(3, 4), "instantiate must use the bytes at the time of the call");
+  }));
+  view.fill(0);
+}
+
+{
+  let threw = false;
+  let promise;
+  try {
+    promise = WebAssembly.compile(new Uint8Array([0, 1, 2, 3]));
+  } catch (e) {
+    threw = true;
+  }
+  check(false, threw, "compile of invalid bytes must not throw synchronously");
+  tests.push(promise.then(() => {
+    check(true, false, "compile of invalid bytes must reject");
+  }, e => {
+    order.push("reject");
+    check(true, e instanceof WebAssembly.CompileError, "compile of invalid bytes must reject with a CompileError");
+  }));
+}
+
+tests.push(WebAssembly.compile({}).then(() => {
+  check(true, false, "compile of a non buffer source must reject");
+}, e => {
+  check(true, e instanceof TypeError, "compile of a non buffer source must reject with a TypeError");
+}));
+
+order.push("script");
+
+Promise.all(tests).then(() => {
+  delete ArrayBuffer.prototype.then;
+  check(null, leakedBuffer, "the copied bytes must not be passed to script");
+  check("script", order[0], "script must run to completion before the modules are compiled");
+  check(4, order.length, "number of completed compilations");
+  if (failed === 0) {
+    console.log("PASSED");
+  }
+}, e => console.log(`FAILED: ${e}`));
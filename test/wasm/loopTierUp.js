@@ -0,0 +1,50 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Wasm functions with loops are scheduled for the jit on their first call and keep running in the
+// interpreter until the code is ready. The results must be the same before and after the switch.
+
+// (func (export "sum") (param i32) (result i32) (local i32)
+//   (block (loop
+//     (br_if 1 (i32.eqz (get_local 0)))
+//     (set_local 1 (i32.add (get_local 1) (get_local 0)))
+//     (set_local 0 (i32.sub (get_local 0) (i32.const 1)))
+//     (br 0)))
+//   (get_local 1))
+const bytes = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+  0x03, 0x02, 0x01, 0x00,
+  0x07, 0x07, 0x01, 0x03, 0x73, 0x75, 0x6d, 0x00, 0x00,
+  0x0a, 0x23, 0x01, 0x21, 0x01, 0x01, 0x7f,
+  0x02, 0x40, 0x03, 0x40,
+  0x20, 0x00, 0x45, 0x0d, 0x01,
+  0x20, 0x01, 0x20, 0x00, 0x6a, 0x21, 0x01,
+  0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00,
+  0x0c, 0x00, 0x0b, 0x0b,
+  0x20, 0x01, 0x0b
+]);
+
+let failed = 0;
+for (let i = 0; i < 3; ++i) {
+  // Each instance shares the function bodies of the module
+  const {exports: {sum}} = new WebAssembly.Instance(new WebAssembly.Module(bytes));
+  for (let n = 0; n < 2000; n += 7) {
+    const expected = (n * (n + 1) / 2) | 0;
+    const actual = sum(n);
+    if (actual !== expected) {
+      console.log(`FAILED: sum(${n}) expected ${expected}, got ${actual}`);
+      ++failed;
+    }
+  }
+  if (sum(100000) !== 705082704) {
+    console.log(`FAILED: sum(100000) expected 705082704, got ${sum(100000)}`);
+    ++failed;
+  }
+}
+
+if (failed === 0) {
+  console.log("PASSED");
+}
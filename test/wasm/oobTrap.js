@@ -0,0 +1,79 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+// Out-of-bounds accesses from JITed code. With -WasmFastArray the bound checks are removed and the
+// accesses fault in the guard region of the memory reservation; the trap must still surface as a
+// catchable WebAssembly.RuntimeError and leave the instance usable.
+const mod = new WebAssembly.Module(WebAssembly.wabt.convertWast2Wasm(`
+(module
+  (memory (export "mem") 1)
+  (func (export "i32_load") (param i32) (result i32) (i32.load (get_local 0)))
+  (func (export "i32_load8_u") (param i32) (result i32) (i32.load8_u (get_local 0)))
+  (func (export "f32_load") (param i32) (result f32) (f32.load (get_local 0)))
+  (func (export "f64_load") (param i32) (result f64) (f64.load (get_local 0)))
+  (func (export "i32_load_offset") (param i32) (result i32) (i32.load offset=0xFFFF (get_local 0)))
+  (func (export "i32_store") (param i32) (param i32) (i32.store (get_local 0) (get_local 1)))
+  (func (export "f64_store") (param i32) (param f64) (f64.store (get_local 0) (get_local 1)))
+  (func $inner (param i32) (result i32) (i32.load (get_local 0)))
+  (func (export "nested") (param i32) (result i32)
+    (i32.add (i32.const 1) (call $inner (get_local 0))))
+)`));
+const {exports} = new WebAssembly.Instance(mod);
+const pageSize = 0x10000;
+let failures = 0;
+
+function check(name, fn) {
+  try {
+    fn();
+    print(`${name}: should have trapped`);
+    ++failures;
+  } catch (e) {
+    if (!(e instanceof WebAssembly.RuntimeError)) {
+      print(`${name}: ${e}`);
+      ++failures;
+    }
+  }
+}
+
+function testOutOfBounds(memSize) {
+  for (const addr of [memSize, memSize + 1, memSize + pageSize, 0x7FFFFFFF, 0xFFFFFFFF | 0]) {
+    check(`i32_load(${addr})`, () => exports.i32_load(addr));
+    check(`i32_load8_u(${addr})`, () => exports.i32_load8_u(addr));
+    check(`f32_load(${addr})`, () => exports.f32_load(addr));
+    check(`f64_load(${addr})`, () => exports.f64_load(addr));
+    check(`i32_store(${addr})`, () => exports.i32_store(addr, 1));
+    check(`f64_store(${addr})`, () => exports.f64_store(addr, 1.5));
+    check(`nested(${addr})`, () => exports.nested(addr));
+  }
+  check("i32_load_offset", () => exports.i32_load_offset(memSize - 4));
+  // Partially out of bounds
+  check("i32_load(end - 2)", () => exports.i32_load(memSize - 2));
+  check("f64_load(end - 4)", () => exports.f64_load(memSize - 4));
+}
+
+function testInBounds(memSize) {
+  exports.i32_store(memSize - 4, 42);
+  if (exports.i32_load(memSize - 4) !== 42 || exports.nested(memSize - 4) !== 43) {
+    print(`in bounds access at ${memSize - 4} failed`);
+    ++failures;
+  }
+  exports.f64_store(0, 2.5);
+  if (exports.f64_load(0) !== 2.5) {
+    print("in bounds f64 access failed");
+    ++failures;
+  }
+}
+
+// Repeat so the functions get JITed and the fault path runs many times
+for (let i = 0; i < 100; ++i) {
+  testOutOfBounds(pageSize);
+  testInBounds(pageSize);
+}
+
+// Addresses that trapped must work once the memory has grown to cover them
+exports.mem.grow(2);
+testInBounds(3 * pageSize);
+testOutOfBounds(3 * pageSize);
+
+print(failures === 0 ? "PASSED" : "FAILED");